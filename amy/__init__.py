@@ -2,6 +2,7 @@
 from .constants import *
 from . import examples
 import collections
+import struct
 import time
 try:
     import c_amy as _amy  # The CPython C module; absent on MicroPython/web
@@ -35,10 +36,12 @@ def _capi_resolve(py_name, mp_name):
     return f if f is not None else _capi_missing(py_name)
 
 _send_wire = _capi_resolve('send_wire', 'amy_send')
+_send_wires = _capi_resolve('send_wires', 'amy_send_wires')
 _send_wire_from_sysex = _capi_resolve('send_wire_from_sysex', 'amy_send_wire_from_sysex')
 _ticks_ms = _capi_resolve('ticks_ms', 'amy_ticks_ms')
 _render_load = _capi_resolve('render_load', 'amy_render_load')
 _set_render_load_threshold = _capi_resolve('set_render_load_threshold', 'amy_set_render_load_threshold')
+_osc_arena_occupancy = _capi_resolve('osc_arena_occupancy', 'amy_osc_arena_occupancy')
 _bleep = _capi_resolve('bleep', 'amy_bleep')
 _sequencer_ticks = _capi_resolve('sequencer_ticks', 'amy_sequencer_ticks')
 _process_single_midi_byte = _capi_resolve('process_single_midi_byte', 'amy_process_single_midi_byte')
@@ -52,6 +55,10 @@ def send_wire(message):
     """Send a wire-protocol message to AMY"""
     return _send_wire(message)
 
+def send_wires(messages):
+    """Send several wire messages, one per line, to AMY as one batch"""
+    return _send_wires(messages)
+
 def send_wire_from_sysex(message):
     """Send a wire message as if from sysex (file-transfer routing applies)"""
     return _send_wire_from_sysex(message)
@@ -68,6 +75,10 @@ def set_render_load_threshold(threshold):
     """Set the render-load fraction that trips the overload failsafe (0 disables)"""
     return _set_render_load_threshold(threshold)
 
+def osc_arena_occupancy():
+    """Fraction of the preallocated osc state arena in use (0..1)"""
+    return _osc_arena_occupancy()
+
 def bleep(start=0):
     """Play the startup bleep"""
     return _bleep(start)
@@ -245,7 +256,7 @@ _KW_MAP_LIST = [   # Order matters because patch_string must come last.
     ('eg0_type', 'TI'), ('eg1_type', 'XI'), ('debug', 'DI'), ('chained_osc', 'cI'),
     ('mod_source', 'LL'),  ('eq', 'xL'), ('filter_type', 'GI'), ('ratio', 'IF'), ('latency_ms', 'NI'),
     ('dist_clip', 'GCI'), ('dist_fold', 'GFI'), ('dist_crush', 'GHL'), ('dist_drive', 'GDF'), ('dist_mix', 'GMF'),
-    ('algo_source', 'OL'), ('load_sample', 'zL'), ('transfer_file', 'zTL'), ('disk_sample', 'zFL'),
+    ('algo_source', 'OL'), ('load_sample', 'zL'), ('transfer_file', 'zTL'), ('disk_sample', 'zFL'), ('map_sample', 'zML'), ('read_sample', 'zRL'), ('compress_sample', 'zKI'),
     ('algorithm', 'oI'), ('chorus', 'kL'), ('reverb', 'hL'), ('echo', 'ML'), ('patch', 'KI'),
     ('external_channel', 'WI'), ('portamento', 'mI'), ('tempo', 'jF'), ('sequencer_run', 'zYI'),
     ('external_midi_sync', 'zCI'),
@@ -366,6 +377,191 @@ def send(**kwargs):
 
     send_raw(m)
 
+# Binary events: the same events message() makes, encoded for
+# amy_add_binary_event() instead of as a wire string, so AMY can take them
+# without parsing text.  See "Binary events" in parse.c for the layout.  The
+# fields, in order, with how each is stored: 'u' unsigned varint, 'i' zigzag
+# varint, 'f' little-endian float32; and how many elements, for the arrays.
+_BINARY_EVENT_FIELDS = [
+    ('time', 'u', 0), ('osc', 'u', 0), ('wave', 'u', 0), ('midi_note', 'f', 0), ('velocity', 'f', 0),
+    ('synth', 'u', 0), ('preset', 'i', 0),
+    ('amp_coefs', 'f', 10), ('freq_coefs', 'f', 10), ('filter_freq_coefs', 'f', 10), ('duty_coefs', 'f', 10),
+    ('pan_coefs', 'f', 10), ('resonance', 'f', 0), ('filter_type', 'u', 0),
+    ('patch_number', 'u', 0), ('mode', 'u', 0), ('feedback', 'f', 0), ('trigger_phase', 'f', 0),
+    ('pitch_bend', 'f', 0), ('ratio', 'f', 0), ('portamento_ms', 'u', 0),
+    ('chained_osc', 'u', 0), ('mod_source', 'u', 2), ('algorithm', 'u', 0), ('algo_source', 'i', 6),
+    ('bp_is_set', 'u', 2), ('eg0_times', 'u', 24), ('eg0_values', 'f', 24), ('eg1_times', 'u', 24),
+    ('eg1_values', 'f', 24), ('eg_type', 'u', 2),
+    ('sample_offset', 'u', 0), ('fit_ticks', 'f', 0), ('fit_search', 'u', 0), ('volume', 'f', 0),
+    ('tempo', 'f', 0), ('latency_ms', 'u', 0),
+    ('dist_type', 'u', 0), ('dist_drive', 'f', 0), ('dist_bits', 'u', 0), ('dist_rate', 'u', 0), ('dist_mix', 'f', 0),
+    ('synth_flags', 'u', 0), ('synth_level', 'f', 0), ('synth_delay_ms', 'u', 0), ('to_synth', 'u', 0),
+    ('grab_midi_notes', 'u', 0), ('pedal', 'u', 0), ('num_voices', 'u', 0), ('oscs_per_voice', 'u', 0),
+    ('note_source_channel', 'u', 0),
+    ('ticks', 'u', 3), ('reset_osc', 'u', 0), ('bus', 'u', 0),
+    ('eq_l', 'f', 0), ('eq_m', 'f', 0), ('eq_h', 'f', 0),
+    ('echo_level', 'f', 0), ('echo_delay_ms', 'f', 0), ('echo_max_delay_ms', 'f', 0), ('echo_feedback', 'f', 0),
+    ('echo_filter_coef', 'f', 0),
+    ('chorus_level', 'f', 0), ('chorus_max_delay', 'f', 0), ('chorus_lfo_freq', 'f', 0), ('chorus_depth', 'f', 0),
+    ('reverb_level', 'f', 0), ('reverb_liveness', 'f', 0), ('reverb_damping', 'f', 0), ('reverb_xover_hz', 'f', 0),
+]
+
+def _binary_list(arg, convert, length):
+    """A list arg, as message() takes it, to `length` elements, None for unset."""
+    vals = parse_list_or_comma_string(arg).split(',')
+    if len(vals) > length:
+        raise ValueError('Too many values in ' + str(arg))
+    return [convert(v) if v.strip() != '' else None for v in vals] + [None] * (length - len(vals))
+
+def _binary_breakpoints(fields, n, arg):
+    vals = parse_list_or_comma_string(arg)
+    if vals.startswith('..'):
+        raise ValueError('binary events don\'t take the \'..\' (integer dB) breakpoint form')
+    vals = _binary_list(vals, float, 48)
+    fields['eg%d_times' % n] = [None if t is None else max(0, int(t)) for t in vals[0::2]]
+    fields['eg%d_values' % n] = vals[1::2]
+    fields.setdefault('bp_is_set', [None, None])[n] = 1
+
+def _binary_spread(names):
+    """A list arg that fills several scalar fields (e.g. reverb's)."""
+    def _f(fields, arg):
+        for name, val in zip(names, _binary_list(arg, float, len(names))):
+            fields[name] = val
+    return _f
+
+def _binary_dist_crush(fields, arg):
+    bits, rate = _binary_list(arg, int, 2)
+    if bits == 0:
+        fields['dist_type'] = DIST_OFF
+        return
+    fields['dist_type'] = DIST_CRUSH
+    if bits is not None:
+        fields['dist_bits'] = min(bits, 24)
+    if rate is not None:
+        fields['dist_rate'] = rate
+
+def _binary_eg_type(n):
+    def _f(fields, arg):
+        fields.setdefault('eg_type', [None, None])[n] = int(arg)
+    return _f
+
+def _binary_scalar(name, convert):
+    def _f(fields, arg):
+        fields[name] = convert(arg)
+    return _f
+
+def _binary_array(name, convert, length):
+    def _f(fields, arg):
+        fields[name] = _binary_list(arg, convert, length)
+    return _f
+
+def _binary_coefs(name):
+    def _f(fields, arg):
+        fields[name] = _binary_list(parse_ctrl_coefs(arg), float, 10)
+    return _f
+
+# message() keywords, and what each sets in the event.  Those that aren't
+# event fields (sample transfers, MIDI mappings, patch strings ..) have no
+# binary form; use message() for them.
+_BINARY_KW = {
+    'time': _binary_scalar('time', int), 'ticks': _binary_array('ticks', int, 3),
+    'osc': _binary_scalar('osc', int), 'wave': _binary_scalar('wave', int), 'mode': _binary_scalar('mode', int),
+    'note': _binary_scalar('midi_note', float), 'vel': _binary_scalar('velocity', float),
+    'amp': _binary_coefs('amp_coefs'), 'freq': _binary_coefs('freq_coefs'), 'duty': _binary_coefs('duty_coefs'),
+    'pan': _binary_coefs('pan_coefs'), 'filter_freq': _binary_coefs('filter_freq_coefs'),
+    'feedback': _binary_scalar('feedback', float), 'reset': _binary_scalar('reset_osc', int),
+    'phase': _binary_scalar('trigger_phase', float), 'sample_offset': _binary_scalar('sample_offset', int),
+    'fit': _binary_scalar('fit_ticks', float), 'fit_search': _binary_scalar('fit_search', int),
+    'volume': _binary_scalar('volume', float), 'pitch_bend': _binary_scalar('pitch_bend', float),
+    'resonance': _binary_scalar('resonance', float),
+    'bp0': lambda f, a: _binary_breakpoints(f, 0, a), 'bp1': lambda f, a: _binary_breakpoints(f, 1, a),
+    'eg0': lambda f, a: _binary_breakpoints(f, 0, a), 'eg1': lambda f, a: _binary_breakpoints(f, 1, a),
+    'eg0_type': _binary_eg_type(0), 'eg1_type': _binary_eg_type(1),
+    'chained_osc': _binary_scalar('chained_osc', int), 'mod_source': _binary_array('mod_source', int, 2),
+    'eq': _binary_spread(['eq_l', 'eq_m', 'eq_h']), 'filter_type': _binary_scalar('filter_type', int),
+    'ratio': _binary_scalar('ratio', float), 'latency_ms': _binary_scalar('latency_ms', int),
+    'dist_clip': lambda f, a: f.__setitem__('dist_type', DIST_CLIP if float(a) != 0 else DIST_OFF),
+    'dist_fold': lambda f, a: f.__setitem__('dist_type', DIST_FOLD if float(a) != 0 else DIST_OFF),
+    'dist_crush': _binary_dist_crush,
+    'dist_drive': _binary_scalar('dist_drive', float), 'dist_mix': _binary_scalar('dist_mix', float),
+    'algo_source': _binary_array('algo_source', int, 6), 'algorithm': _binary_scalar('algorithm', int),
+    'chorus': _binary_spread(['chorus_level', 'chorus_max_delay', 'chorus_lfo_freq', 'chorus_depth']),
+    'reverb': _binary_spread(['reverb_level', 'reverb_liveness', 'reverb_damping', 'reverb_xover_hz']),
+    'echo': _binary_spread(['echo_level', 'echo_delay_ms', 'echo_max_delay_ms', 'echo_feedback', 'echo_filter_coef']),
+    'patch': _binary_scalar('patch_number', int), 'portamento': _binary_scalar('portamento_ms', int),
+    'tempo': _binary_scalar('tempo', float),
+    'synth': _binary_scalar('synth', int), 'pedal': _binary_scalar('pedal', int),
+    'synth_flags': _binary_scalar('synth_flags', int), 'num_voices': _binary_scalar('num_voices', int),
+    'oscs_per_voice': _binary_scalar('oscs_per_voice', int), 'synth_level': _binary_scalar('synth_level', float),
+    'to_synth': _binary_scalar('to_synth', int), 'grab_midi_notes': _binary_scalar('grab_midi_notes', int),
+    'note_source_channel': _binary_scalar('note_source_channel', int),
+    'synth_delay': _binary_scalar('synth_delay_ms', int),
+    'preset': _binary_scalar('preset', int), 'num_partials': _binary_scalar('preset', int),
+    'bus': _binary_scalar('bus', int),
+}
+
+def _varint(v):
+    b = bytearray()
+    while v >= 0x80:
+        b.append((v & 0x7f) | 0x80)
+        v >>= 7
+    b.append(v)
+    return b
+
+def _binary_value(kind, v):
+    if kind == 'f':
+        return struct.pack('<f', v)
+    if kind == 'i':
+        return _varint(((v << 1) ^ (v >> 31)) & 0xffffffff)
+    return _varint(v)
+
+# Construct a binary AMY event
+def binary_message(**kwargs):
+    """Like message(), but returns the event as a binary event (bytes) for
+    send_binary() or amy_add_binary_event().  Takes message()'s keywords that
+    set event fields, plus time= (the event's own playback time, in ms of
+    amy.ticks_ms())."""
+    fields = {}
+    for key, arg in kwargs.items():
+        if key not in _BINARY_KW:
+            raise ValueError('Keyword %s has no binary form' % key if key in _KW_MAP else 'Unknown keyword ' + key)
+        if arg is None:
+            if key != 'ticks':
+                raise ValueError('No arg for key ' + key)
+            continue
+        _BINARY_KW[key](fields, arg)
+    mask = 0
+    body = bytearray()
+    for bit, (name, kind, length) in enumerate(_BINARY_EVENT_FIELDS):
+        val = fields.get(name)
+        if val is None:
+            continue
+        if length:
+            elements = 0
+            for i, v in enumerate(val):
+                if v is not None:
+                    elements |= 1 << i
+            if not elements:
+                continue
+            body += _varint(elements)
+            for v in val:
+                if v is not None:
+                    body += _binary_value(kind, v)
+        else:
+            body += _binary_value(kind, val)
+        mask |= 1 << bit
+    return bytes(bytearray([AMY_BINARY_EVENT_VERSION]) + _varint(mask) + body)
+
+# Send an AMY event to amy as a binary event
+def send_binary(**kwargs):
+    return _amy.send_binary_event(binary_message(**kwargs))
+
+
+def send_binary_batch(events):
+    """Send binary events (a list of binary_message()s) as one batch: they
+    play as if sent one by one, but reach AMY's scheduler together."""
+    return _amy.send_binary_events(b''.join(events))
+
 
 # Plots a time domain and spectra of audio
 def show(data):
@@ -517,6 +713,28 @@ def disk_sample(wavfilename, preset=0, midinote=60):
     s = "%d,%s,%d" % (preset, wavfilename, midinote)
     send(disk_sample=s)
 
+def map_sample(wavfilename, preset=0, midinote=60):
+    """Like disk_sample, but plays the WAV file in place from memory-mapped
+    disk where the host can (desktop POSIX), so it loops and restarts like a
+    loaded sample without being read into RAM.  Streams it elsewhere."""
+    try:
+        from tulip import board
+        if board() == "WEB":
+            load_sample(wavfilename, preset, midinote)
+            return
+    except ImportError:
+        pass
+    s = "%d,%s,%d" % (preset, wavfilename, midinote)
+    send(map_sample=s)
+
+def read_sample(wavfilename, preset=0, midinote=60):
+    """Reads a WAV file on the AMY host's disk into RAM as a preset.  It plays
+    like a load_sample preset, but AMY remembers the file, so with a
+    sample_ram_budget set it can be evicted while it isn't playing, and is
+    read again when it's next played."""
+    s = "%d,%s,%d" % (preset, wavfilename, midinote)
+    send(read_sample=s)
+
 def transfer_file(source_filename, dest_filename=None):
     import os
     from math import ceil
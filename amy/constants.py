@@ -1,3 +1,5 @@
+PCM_C8_BLOCK=32
+PCM_C8_PAD=4
 MAX_FILENAME_LEN=127
 AMY_BLOCK_SIZE=128
 BLOCK_SIZE_BITS=7
@@ -15,17 +17,19 @@ AMY_PCM_TYPE_ROM=0
 AMY_PCM_TYPE_FILE=1
 AMY_PCM_TYPE_MEMORY=2
 AMY_PCM_TYPE_GAMMA=3
+AMY_PCM_TYPE_MAPPED=4
 PCM_FILE_BUFFER_MULT=8
+PCM_STREAM_RING_BUFFERS=4
+PCM_STREAM_HEAD_BUFFERS=2
 SAMPLE_FROM_OUTPUT=1
 SAMPLE_FROM_AUDIO_IN=2
 AMY_DEFAULT_NUM_BUSES=4
 AMY_DEFAULT_BUS=0
 AMY_MAX_CV_IN=2
-AMY_MAX_CORES=2
 AMY_MAX_CHANNELS=2
 AMY_NCHANS=2
-AMY_CORES=2
-AMY_CORES=1
+AMY_DUALCORE_CORES=2
+AMY_MAX_RENDER_THREADS=8
 AMY_MIDI_CHANNEL_DRUMS=10
 AMY_WIRE_COMMAND_LEN=256
 MALLOC_CAP_DEFAULT=0
@@ -68,6 +72,8 @@ NUM_MOD_SOURCES=2
 NUM_COMBO_COEFS=10
 MAX_MESSAGE_LEN=1024
 MAX_PARAM_LEN=256
+AMY_BINARY_EVENT_VERSION=1
+AMY_BINARY_EVENT_MAX_LEN=1024
 FILTER_NONE=0
 FILTER_LPF=1
 FILTER_BPF=2
@@ -163,3 +169,4 @@ AMYBOARD_MIDI_IN=21
 AMY_AUDIO_DEVICE_OUT=0
 AMY_AUDIO_DEVICE_IN=1
 AMY_NUM_MIDI_CHANNELS=16
+RENDER_LUT_MAX_LANES=8
@@ -36,7 +36,7 @@ def _read_wavetables(wavetable_files):
     return tables, wavetable_len
 
 
-def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetable_files=None):
+def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetable_files=None, compressed=False):
     from sf2utils.sf2parse import Sf2File
     import resampy
     import struct
@@ -77,7 +77,7 @@ def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetab
             s["loopstart"] = int(float(sample.start_loop) / float(sample.sample_rate / pcm_AMY_SAMPLE_RATE))
             s["loopend"] = int(float(sample.end_loop) / float(sample.sample_rate / pcm_AMY_SAMPLE_RATE))
             s["midinote"] = sample.original_pitch
-            offset = offset + resampled.shape[0]
+            offset = offset + (len(_c8_padded(samples_int16)) if compressed else resampled.shape[0])
             offsets.append(s)
         except AttributeError:
             print("skipping %s" % (sample.name))
@@ -89,7 +89,8 @@ def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetab
         wavetable_tables, wavetable_len = _read_wavetables(wavetable_files)
     wavetable_count = len(wavetable_tables)
     base_samples = len(offsets)
-    base_length = all_samples.shape[0]
+    base_length = offset if compressed else all_samples.shape[0]
+    wavetable_offset = 0 if compressed else base_length
 
     p = open("src/pcm_%s.h" % (name), "w")
     p.write("// Automatically generated by amy.headers.generate_pcm_header()\n")
@@ -102,20 +103,20 @@ def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetab
         p.write("#define PCM_WAVETABLE_BASE PCM_BASE_SAMPLES\n")
         p.write("#define PCM_WAVETABLE_SAMPLES %d\n" % (wavetable_count))
         p.write("#define PCM_WAVETABLE_LEN %d\n" % (wavetable_len))
-        p.write("#define PCM_LENGTH (PCM_BASE_LENGTH + (PCM_WAVETABLE_SAMPLES * PCM_WAVETABLE_LEN))\n")
+        _write_pcm_length_defines(p, compressed)
         p.write("#define PCM_MAP_ENTRIES (PCM_BASE_SAMPLES + PCM_WAVETABLE_SAMPLES)\n")
         p.write("#else\n")
         p.write("#define PCM_WAVETABLE_BASE PCM_BASE_SAMPLES\n")
         p.write("#define PCM_WAVETABLE_SAMPLES 0\n")
         p.write("#define PCM_WAVETABLE_LEN 0\n")
-        p.write("#define PCM_LENGTH PCM_BASE_LENGTH\n")
+        _write_pcm_length_defines(p, compressed, wavetables=False)
         p.write("#define PCM_MAP_ENTRIES PCM_BASE_SAMPLES\n")
         p.write("#endif\n")
     else:
         p.write("#define PCM_WAVETABLE_BASE PCM_BASE_SAMPLES\n")
         p.write("#define PCM_WAVETABLE_SAMPLES 0\n")
         p.write("#define PCM_WAVETABLE_LEN 0\n")
-        p.write("#define PCM_LENGTH PCM_BASE_LENGTH\n")
+        _write_pcm_length_defines(p, compressed, wavetables=False)
         p.write("#define PCM_MAP_ENTRIES PCM_BASE_SAMPLES\n")
     p.write("#include \"pcm_samples_%s.h\"\n" % (name))
     p.write("const uint16_t pcm_samples = PCM_MAP_ENTRIES;\n")
@@ -129,7 +130,7 @@ def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetab
         p.write("#if defined(AMY_WAVETABLE)\n")
         for i, (wavfile, wav_data) in enumerate(wavetable_tables):
             wav_index = base_samples + i
-            wav_offset = base_length + i * wavetable_len
+            wav_offset = wavetable_offset + i * wavetable_len
             wav_name = os.path.basename(wavfile)
             p.write("    /* [%d] WT */ {%d, %d, %d, %d, %d}, /* %s */\n" % (
                 wav_index, wav_offset, wavetable_len, 0, wavetable_len, 69, wav_name))
@@ -141,6 +142,11 @@ def generate_amy_pcm_header(sample_set, name, pcm_AMY_SAMPLE_RATE=22050, wavetab
     p = open("src/pcm_samples_%s.h" % (name), 'w')
     p.write("// Automatically generated by amy.headers.generate_pcm_header()\n")
     p.write("#ifndef __PCM_SAMPLES_H\n#define __PCM_SAMPLES_H\n")
+    if compressed:
+        _write_c8_pcm_samples(p, [_c8_padded(x) for x in int16s], wavetable_tables)
+        p.write("\n#endif  // __PCM_SAMPLES_H\n")
+        p.close()
+        return
     p.write("const int16_t pcm[PCM_LENGTH] PROGMEM = {")
 
     columns = 16
@@ -235,8 +241,78 @@ def _write_int16_carray(p, data, column=15):
         p.write("    %s,\n" % (",".join([("%d" % (d)).ljust(8) for d in data[-rem:]])))
 
 
+# ------------- Compressed ROM sets -------------
+#
+# With compressed=True the generators store the ROM drums (not the wavetables)
+# as pcm.c's compressed presets: an 8-bit code per sample in pcm_c8[], and a
+# shift per PCM_C8_BLOCK frames in pcm_c8_shift[], the sample being
+# code << shift.  That's about half the flash of int16, and pcm.c still reads
+# any frame directly, so the drums loop and stretch as before.  Each sample is
+# padded with silence to a whole number of blocks, so its shifts start at
+# offset / PCM_C8_BLOCK.  The wavetables stay int16 in pcm[], offset from 0.
+
+def _c8_encode(data):
+    # As pcm_c8_encode in pcm.c: the smallest shift (up to 8) that gets the
+    # block's samples into codes, and each sample rounded to its nearest code.
+    block = constants.PCM_C8_BLOCK
+    codes, shifts = [], []
+    for start in range(0, len(data), block):
+        chunk = [int(x) for x in data[start:start + block]]
+        lowest, highest = min(chunk + [0]), max(chunk + [0])
+        shift = 0
+        while shift < 8 and ((highest >> shift) > 127 or (lowest >> shift) < -128):
+            shift += 1
+        half = (1 << shift) >> 1
+        shifts.append(shift)
+        codes.extend(max(-128, min(127, (x + half) >> shift)) for x in chunk)
+    return codes, shifts
+
+
+def _c8_padded(data):
+    # data padded with zeros to a whole number of PCM_C8_BLOCK frames.
+    block = constants.PCM_C8_BLOCK
+    return [int(x) for x in data] + [0] * (-len(data) % block)
+
+
+def _write_pcm_length_defines(p, compressed, wavetables=True):
+    # PCM_LENGTH is pcm[]'s length: the drums and the wavetables, or with the
+    # drums compressed just the wavetables.
+    if compressed:
+        p.write("#define PCM_LENGTH %s\n" % ("(PCM_WAVETABLE_SAMPLES * PCM_WAVETABLE_LEN)" if wavetables else "0"))
+    elif wavetables:
+        p.write("#define PCM_LENGTH (PCM_BASE_LENGTH + (PCM_WAVETABLE_SAMPLES * PCM_WAVETABLE_LEN))\n")
+    else:
+        p.write("#define PCM_LENGTH PCM_BASE_LENGTH\n")
+
+
+def _write_c8_pcm_samples(p, base_datas, wavetable_tables):
+    # The body of a compressed pcm_samples_*.h: base_datas already padded.
+    pad = constants.PCM_C8_PAD
+    codes, shifts = [], []
+    for data in base_datas:
+        c, s = _c8_encode(data)
+        codes += c
+        shifts += s
+    p.write("#define PCM_COMPRESSED\n")
+    p.write("const int8_t pcm_c8[PCM_BASE_LENGTH + %d] PROGMEM = {\n" % pad)
+    _write_int16_carray(p, codes + [0] * pad)
+    p.write("};\n")
+    p.write("const uint8_t pcm_c8_shift[PCM_BASE_LENGTH / %d + %d] PROGMEM = {\n" % (constants.PCM_C8_BLOCK, pad))
+    _write_int16_carray(p, shifts + [0] * pad)
+    p.write("};\n")
+    p.write("#if PCM_LENGTH > 0\n")
+    p.write("const int16_t pcm[PCM_LENGTH] PROGMEM = {\n")
+    for wavfile, wav_data in wavetable_tables:
+        p.write("    // %s\n" % wavfile)
+        _write_int16_carray(p, [int(x) for x in wav_data])
+    p.write("};\n")
+    p.write("#else\n")
+    p.write("const int16_t pcm[1] PROGMEM = {0};\n")
+    p.write("#endif\n")
+
+
 def generate_gamma9001_headers(sounds_dir='sounds/gamma9001', bin_path='build/drums.bin',
-                               pcm_AMY_SAMPLE_RATE=22050):
+                               pcm_AMY_SAMPLE_RATE=22050, compressed=False):
     import json
     manifest = json.load(open(os.path.join(sounds_dir, 'manifest.json')))
     rom = [m for m in manifest if m['bank'] == GAMMA9001_ROM_BANK]
@@ -250,8 +326,9 @@ def generate_gamma9001_headers(sounds_dir='sounds/gamma9001', bin_path='build/dr
     for m in rom:
         data = _read_wav_mono16(os.path.join(sounds_dir, m['file']), pcm_AMY_SAMPLE_RATE)
         m['_offset'], m['_data'] = offset, data
-        offset += len(data)
+        offset += len(_c8_padded(data)) if compressed else len(data)
     base_length = offset
+    wavetable_offset = 0 if compressed else base_length
 
     p = open("src/pcm_gamma808.h", "w")
     p.write("// Automatically generated by amy.headers.generate_gamma9001_headers()\n")
@@ -263,13 +340,13 @@ def generate_gamma9001_headers(sounds_dir='sounds/gamma9001', bin_path='build/dr
     p.write("#define PCM_WAVETABLE_BASE PCM_BASE_SAMPLES\n")
     p.write("#define PCM_WAVETABLE_SAMPLES %d\n" % wavetable_count)
     p.write("#define PCM_WAVETABLE_LEN %d\n" % wavetable_len)
-    p.write("#define PCM_LENGTH (PCM_BASE_LENGTH + (PCM_WAVETABLE_SAMPLES * PCM_WAVETABLE_LEN))\n")
+    _write_pcm_length_defines(p, compressed)
     p.write("#define PCM_MAP_ENTRIES (PCM_BASE_SAMPLES + PCM_WAVETABLE_SAMPLES)\n")
     p.write("#else\n")
     p.write("#define PCM_WAVETABLE_BASE PCM_BASE_SAMPLES\n")
     p.write("#define PCM_WAVETABLE_SAMPLES 0\n")
     p.write("#define PCM_WAVETABLE_LEN 0\n")
-    p.write("#define PCM_LENGTH PCM_BASE_LENGTH\n")
+    _write_pcm_length_defines(p, compressed, wavetables=False)
     p.write("#define PCM_MAP_ENTRIES PCM_BASE_SAMPLES\n")
     p.write("#endif\n")
     p.write("#include \"pcm_samples_gamma808.h\"\n")
@@ -284,7 +361,7 @@ def generate_gamma9001_headers(sounds_dir='sounds/gamma9001', bin_path='build/dr
     p.write("#if defined(AMY_WAVETABLE)\n")
     for i, (wavfile, wav_data) in enumerate(wavetable_tables):
         p.write("    /* [%d] WT */ {%d, %d, %d, %d, %d}, /* %s */\n" % (
-            len(rom) + i, base_length + i * wavetable_len, wavetable_len, 0, wavetable_len, 69,
+            len(rom) + i, wavetable_offset + i * wavetable_len, wavetable_len, 0, wavetable_len, 69,
             os.path.basename(wavfile)))
     p.write("#endif\n")
     p.write("};\n")
@@ -294,15 +371,18 @@ def generate_gamma9001_headers(sounds_dir='sounds/gamma9001', bin_path='build/dr
     p = open("src/pcm_samples_gamma808.h", 'w')
     p.write("// Automatically generated by amy.headers.generate_gamma9001_headers()\n")
     p.write("#ifndef __PCM_SAMPLES_H\n#define __PCM_SAMPLES_H\n")
-    p.write("const int16_t pcm[PCM_LENGTH] PROGMEM = {\n")
-    for m in rom:
-        _write_int16_carray(p, m['_data'])
-    p.write("#if defined(AMY_WAVETABLE)\n")
-    for wavfile, wav_data in wavetable_tables:
-        p.write("    // %s\n" % wavfile)
-        _write_int16_carray(p, wav_data)
-    p.write("#endif\n")
-    p.write("};\n")
+    if compressed:
+        _write_c8_pcm_samples(p, [_c8_padded(m['_data']) for m in rom], wavetable_tables)
+    else:
+        p.write("const int16_t pcm[PCM_LENGTH] PROGMEM = {\n")
+        for m in rom:
+            _write_int16_carray(p, m['_data'])
+        p.write("#if defined(AMY_WAVETABLE)\n")
+        for wavfile, wav_data in wavetable_tables:
+            p.write("    // %s\n" % wavfile)
+            _write_int16_carray(p, wav_data)
+        p.write("#endif\n")
+        p.write("};\n")
     p.write("\n#endif  // __PCM_SAMPLES_H\n")
     p.close()
 
@@ -1217,7 +1297,9 @@ def generate_all():
 
 def main():
     if 'gamma9001' in sys.argv:
-        generate_gamma9001_headers()
+        # `python3 -m amy.headers gamma9001 compressed` stores the ROM drums
+        # compressed (see "Compressed ROM sets").
+        generate_gamma9001_headers(compressed='compressed' in sys.argv)
         return
     print("Generating all headers needed for AMY...")
     generate_all()
@@ -88,6 +88,12 @@ class AmyTest:
   ref_dir = './tests/ref'
   test_dir = './tests/tst'
 
+  # Why a float build can't be judged against this test's fixed-point ref,
+  # for the few tests whose ref bakes in fixed-point behavior.  Under
+  # AMY_TEST_RELATIVE_DB, such a test is reported as skipped, with this
+  # reason, rather than passed or failed.  None for every other test.
+  float_skip_reason = None
+
   def __init__(self):
     self.default_synths = False
 
@@ -120,6 +126,15 @@ class AmyTest:
     # Any value above this threshold counts as a failed test
     threshold = float(os.environ.get('AMY_TEST_THRESHOLD_DB', '-100.0'))
     test_passed = (rms_n <= threshold)
+    # tests/ref is rendered in fixed point.  A float build (AMY_USE_FLOAT)
+    # can't match it bit for bit, so AMY_TEST_RELATIVE_DB instead passes any
+    # test whose error is that far below its own signal.
+    relative = os.environ.get('AMY_TEST_RELATIVE_DB')
+    if relative is not None and self.float_skip_reason is not None:
+      # Neither passed nor failed.
+      return None, message + ' / skipped: ' + self.float_skip_reason
+    if relative is not None and not test_passed:
+      test_passed = (rms_n - rms_x <= float(relative))
     return test_passed, message
 
 
@@ -392,6 +407,12 @@ class TestInterpPartialsOutOfRange(AmyTest):
   amplify cross-platform libm float differences; what matters here is that the
   out-of-range path runs, not how it sounds."""
 
+  # The quiet extrapolated partials cross AMP_THRESH, where their oscs stop
+  # and go back to phase 0, up to a dozen blocks apart in fixed point and
+  # float.  The notes that reuse those oscs then have the ref's spectrum
+  # but not its phases.
+  float_skip_reason = 'partials reused after stopping at other blocks start in other phases'
+
   def run(self):
     amy_send_at(time=0, reset=amy.RESET_ALL_OSCS)
     amy_send_at(time=0, synth=1, num_voices=6, patch=256)
@@ -593,6 +614,11 @@ class TestChorus(AmyTest):
 class TestBrass(AmyTest):
   """One of the Juno-6 patches, spelled out."""
 
+  # Osc 1's release, filtered down near 90 Hz, falls under AMP_THRESH one
+  # block sooner in float, so the vibrato LFO (which only runs while osc 1
+  # does) starts the second note a block behind the ref's.
+  float_skip_reason = 'osc 1 stops a block sooner, shifting the vibrato on the second note'
+
   def run(self):
     #amy_send_at(time=0, osc=0, wave=amy.SAW_UP, amp='0.85,0,1,1,0,0', freq='130.81,1,0,0,0,0', filter_type=amy.FILTER_LPF,
     #         resonance=0.167, bp0='60,1,740,0.9,200,0', filter_freq='6000,0.5,0,0,1,0',
@@ -619,6 +645,9 @@ class TestBrass(AmyTest):
 class TestBrassAlt(AmyTest):
   """Reproduce TestBrass using the VCA on a SILENT osc."""
 
+  # As TestBrass: osc 0's filtered release stops the chain a block sooner.
+  float_skip_reason = 'the voice stops a block sooner, shifting the vibrato on the second note'
+
   def run(self):
     osc_freq_str = str(constants.ZERO_LOGFREQ_IN_HZ / 2)
     # Osc 1 is waveform, with vibrato mod but no amp env
@@ -1197,6 +1226,10 @@ class TestSynthDrumsLevel(AmyTest):
   per-drum gain in the mapping's velocity scale, NOT in amp, so a hit never
   rewrites the channel level (shorepine/amy drum-level fix)."""
 
+  # On the amp=1.8 hit the ref wraps around from -1 to +1 on a few samples,
+  # a fixed-point overflow; float clips them to -1.
+  float_skip_reason = 'the ref has fixed-point wraparound on the loudest hit'
+
   def __init__(self):
     super().__init__()
     self.default_synths = True
@@ -2262,6 +2295,93 @@ class TestFuzzWireParser(AmyTest):
                                       % (len(self.DIRECTED) + self.N_RANDOM, level))
 
 
+class TestBinaryEvents(AmyTest):
+  """Events sent as binary events (amy.send_binary) play exactly as the same
+  keywords sent as wire strings (amy.send) do, and decode to the wire string
+  they'd have been."""
+
+  PROGRAM = [
+      (0, dict(synth=1, num_voices=4, patch=1)),
+      (0, dict(osc=10, wave=amy.SAW_DOWN, amp={'const': 0.3, 'vel': 1, 'eg0': 1}, freq={'const': 110, 'note': 1},
+               filter_freq=[800, None, None, None, 2], resonance=2.5, filter_type=amy.FILTER_LPF24,
+               bp0='10,1,300,0.5,500,0', bp1=[0, 1, 1000, 0], pan=0.3)),
+      (0, dict(osc=11, wave=amy.SINE, freq=0.5, amp=1)),
+      (0, dict(osc=10, mod_source=11, duty={'const': 0.5, 'mod0': 0.2}, dist_crush=[8, 12000], dist_mix=0.5)),
+      (100, dict(synth=1, note=60, vel=0.8)),
+      (100, dict(osc=10, note=40, vel=1)),
+      (300, dict(synth=1, note=64, vel=0.6)),
+      (400, dict(pitch_bend=0.2, reverb=[0.3, 0.8, 0.5, 3000])),
+      (600, dict(synth=1, note=60, vel=0)),
+      (700, dict(osc=10, vel=0)),
+  ]
+
+  WIRE = [
+      (dict(osc=1, note=60, vel=1), 'v1n60l1Z'),
+      (dict(osc=2, freq=[220, 1], bp0='0,1,100,0'), 'v2f220,1A0,1,100,0Z'),
+      (dict(synth=1, num_voices=6, patch=257), 'K257i1iv6Z'),
+      (dict(osc=3, eq=[1, None, -3], ticks=[480, 0, 7]), 'H480,0,7v3x1,,-3Z'),
+  ]
+
+  def render(self, send):
+    _amy.stop()
+    _amy.start(0)
+    _reset_test_clock()
+    for time, kwargs in self.PROGRAM:
+      _render_test_clock_to_ms(time)
+      send(**kwargs)
+    return _finish_test_clock(1.0)
+
+  def test(self):
+    name = self.__class__.__name__
+    wire = self.render(amy.send)
+    binary = self.render(amy.send_binary)
+    if dB(rms(wire)) < -60:
+      return False, name + ': wire program rendered silence'
+    if not np.array_equal(wire, binary):
+      return False, name + ': binary events render differently (max diff %f)' % np.max(np.abs(wire - binary))
+    for kwargs, expected in self.WIRE:
+      got = _amy.binary_event_to_wire(amy.binary_message(**kwargs))
+      if got != expected:
+        return False, name + ': %s decodes to %s, not %s' % (kwargs, got, expected)
+    try:
+      amy.binary_message(osc=0, patch_string='v0w1Z')
+      return False, name + ': patch_string has no binary form, but was accepted'
+    except ValueError:
+      pass
+    nbytes = len(amy.binary_message(osc=0, note=60, vel=1))
+    return True, ('%-32s:' % name) + ' ok (%d-byte note-on)' % nbytes
+
+
+class TestBatches(AmyTest):
+  """Events sent as batches (amy.send_wires, amy.send_binary_batch) play
+  exactly as the same events sent one by one do."""
+
+  PROGRAM = TestBinaryEvents.PROGRAM
+
+  def render(self, send_batch):
+    _amy.stop()
+    _amy.start(0)
+    _reset_test_clock()
+    times = sorted(set(time for time, _ in self.PROGRAM))
+    for time in times:
+      _render_test_clock_to_ms(time)
+      send_batch([kwargs for t, kwargs in self.PROGRAM if t == time])
+    return _finish_test_clock(1.0)
+
+  def test(self):
+    name = self.__class__.__name__
+    one_by_one = self.render(lambda batch: [amy.send(**kwargs) for kwargs in batch])
+    wires = self.render(lambda batch: amy.send_wires('\n'.join(amy.message(**kwargs) for kwargs in batch)))
+    binary = self.render(lambda batch: amy.send_binary_batch([amy.binary_message(**kwargs) for kwargs in batch]))
+    if dB(rms(one_by_one)) < -60:
+      return False, name + ': program rendered silence'
+    if not np.array_equal(one_by_one, wires):
+      return False, name + ': send_wires renders differently (max diff %f)' % np.max(np.abs(one_by_one - wires))
+    if not np.array_equal(one_by_one, binary):
+      return False, name + ': send_binary_batch renders differently (max diff %f)' % np.max(np.abs(one_by_one - binary))
+    return True, ('%-32s:' % name) + ' ok'
+
+
 def main(argv):
   if len(argv) > 1 and argv[1] == 'quiet':
     quiet = True
@@ -2277,6 +2397,7 @@ def main(argv):
 
   oks = []
   errors = []
+  skips = []
 
   if do_all_tests:
     for testClass in AmyTest.__subclasses__():
@@ -2284,7 +2405,9 @@ def main(argv):
       is_ok, message = test_object.test()
       if not quiet:
         print(message)
-      if is_ok:
+      if is_ok is None:
+        skips.append(message)
+      elif is_ok:
         oks.append(message)
       else:
         errors.append(message)
@@ -2330,6 +2453,10 @@ def main(argv):
     for e in errors:
       f.write(e.split(' ')[0] + '\n')
 
+  if skips:
+    print(len(skips), "tests skipped:")
+    print('\n'.join(skips))
+
   if errors:
     print(len(oks), "tests pass,", len(errors), "tests failed:")
     print('\n'.join(errors))
@@ -0,0 +1,172 @@
+PCM_C8_BLOCK=32
+PCM_C8_PAD=4
+MAX_FILENAME_LEN=127
+AMY_BLOCK_SIZE=128
+BLOCK_SIZE_BITS=7
+AMY_BLOCK_SIZE=256
+BLOCK_SIZE_BITS=8
+AMY_SAMPLE_RATE=48000
+AMY_SAMPLE_RATE=48000
+AMY_SAMPLE_RATE=44100
+PCM_AMY_SAMPLE_RATE=22050
+AMY_TRANSFER_TYPE_NONE=0
+AMY_TRANSFER_TYPE_AUDIO=1
+AMY_TRANSFER_TYPE_FILE=2
+AMY_TRANSFER_TYPE_SAMPLE=3
+AMY_PCM_TYPE_ROM=0
+AMY_PCM_TYPE_FILE=1
+AMY_PCM_TYPE_MEMORY=2
+AMY_PCM_TYPE_GAMMA=3
+AMY_PCM_TYPE_MAPPED=4
+PCM_FILE_BUFFER_MULT=8
+PCM_STREAM_RING_BUFFERS=4
+PCM_STREAM_HEAD_BUFFERS=2
+SAMPLE_FROM_OUTPUT=1
+SAMPLE_FROM_AUDIO_IN=2
+AMY_DEFAULT_NUM_BUSES=4
+AMY_DEFAULT_BUS=0
+AMY_MAX_CV_IN=2
+AMY_MAX_CHANNELS=2
+AMY_NCHANS=2
+AMY_DUALCORE_CORES=2
+AMY_MAX_RENDER_THREADS=8
+AMY_MIDI_CHANNEL_DRUMS=10
+AMY_WIRE_COMMAND_LEN=256
+MALLOC_CAP_DEFAULT=0
+CHORUS_DEFAULT_LFO_FREQ=0.5
+CHORUS_DEFAULT_MOD_DEPTH=0.5
+CHORUS_DEFAULT_LEVEL=0
+CHORUS_DEFAULT_MAX_DELAY=320
+EQ_CENTER_LOW=800.0
+EQ_CENTER_MED=2500.0
+EQ_CENTER_HIGH=7000.0
+REVERB_DEFAULT_LEVEL=0
+REVERB_DEFAULT_LIVENESS=0.85
+REVERB_DEFAULT_DAMPING=0.5
+REVERB_DEFAULT_XOVER_HZ=3000.0
+ECHO_DEFAULT_LEVEL=0
+ECHO_DEFAULT_DELAY_MS=500.
+ECHO_DEFAULT_MAX_DELAY_MS=743.039
+ECHO_DEFAULT_FEEDBACK=0
+ECHO_DEFAULT_FILTER_COEF=0
+AMY_SEQUENCER_PPQ=48
+DELAY_LINE_LEN=512
+CLIP_D=0.1
+MAX_VOLUME=11.0
+AMP_THRESH=0.001
+AMP_THRESH_PLUS=0.0011
+SAMPLE_MAX=32767
+MAX_ALGO_OPS=6
+DEFAULT_NUM_BREAKPOINTS=8
+MAX_BREAKPOINTS=24
+MAX_BREAKPOINT_SETS=2
+THREAD_USLEEP=500
+AMY_BYTES_PER_SAMPLE=2
+MAX_VOICES_PER_INSTRUMENT=32
+FILT_NUM_DELAYS=4
+ZERO_HZ_LOG_VAL=-99.0
+ZERO_LOGFREQ_IN_HZ=440.0
+ZERO_MIDI_NOTE=69
+MIN_FILTER_LOGFREQ=-2.75
+NUM_MOD_SOURCES=2
+NUM_COMBO_COEFS=10
+MAX_MESSAGE_LEN=1024
+MAX_PARAM_LEN=256
+AMY_BINARY_EVENT_VERSION=1
+AMY_BINARY_EVENT_MAX_LEN=1024
+FILTER_NONE=0
+FILTER_LPF=1
+FILTER_BPF=2
+FILTER_HPF=3
+FILTER_LPF24=4
+FILTER_NOTCH=5
+FILTER_PHASER=6
+DIST_OFF=0
+DIST_CLIP=1
+DIST_FOLD=2
+DIST_CRUSH=3
+DIST_MAX_DRIVE=16.0
+SINE=0
+PULSE=1
+SAW_DOWN=2
+SAW_UP=3
+TRIANGLE=4
+NOISE=5
+KS=6
+PCM=7
+ALGO=8
+PARTIAL=9
+BYO_PARTIALS=10
+INTERP_PARTIALS=11
+AUDIO_IN0=12
+AUDIO_IN1=13
+AUDIO_EXT0=14
+AUDIO_EXT1=15
+AMY_MIDI=16
+PCM_LEFT=17
+PCM_RIGHT=18
+PCM_MIX=7
+WAVETABLE=19
+SILENT=20
+CUSTOM=21
+WAVE_OFF=22
+MODE_NONE=0
+PCM_PLAY_STOP=0
+PCM_PLAY=1
+PCM_LOOP=2
+PCM_LOOP_STOP=3
+PCM_LOOP_FOREVER=4
+PCM_LOOP_ONCE_INTERNAL=5
+SYNTH_OFF=0
+SYNTH_AUDIBLE=1
+SYNTH_INAUDIBLE=2
+SYNTH_IS_NORMAL=0
+SYNTH_IS_MOD_SOURCE=1
+SYNTH_IS_ALGO_SOURCE=2
+SYNTH_IS_CHAINED=3
+ENVELOPE_NORMAL=0
+ENVELOPE_LINEAR=1
+ENVELOPE_DX7=2
+ENVELOPE_TRUE_EXPONENTIAL=3
+TICKS_TICK=0
+TICKS_PERIOD=1
+TICKS_TAG=2
+RESET_SEQUENCER=4096
+RESET_ALL_OSCS=8192
+RESET_TIMEBASE=16384
+RESET_AMY=32768
+RESET_EVENTS=65536
+RESET_ALL_NOTES=131072
+RESET_SYNTHS=262144
+RESET_PATCH=524288
+RESET_QUEUE=1048576
+SYNTH_FLAGS_NOTES_VIA_MIDI=1
+SYNTH_FLAGS_IGNORE_NOTE_OFFS=2
+SYNTH_FLAGS_NEGATE_PEDAL=4
+SYNTH_FLAGS_NO_NOTE_WARNINGS=8
+true=1
+false=0
+AMY_OK=0
+PCM_STRETCH_GRAINS=2
+PCM_STRETCH_GRAIN=1024
+AMY_AUDIO_IS_NONE=0x00
+AMY_AUDIO_IS_I2S=0x01
+AMY_AUDIO_IS_USB_GADGET=0x02
+AMY_AUDIO_IS_MINIAUDIO=0x04
+AMY_MIDI_IS_NONE=0x0
+AMY_MIDI_IS_UART=0x01
+AMY_MIDI_IS_USB_GADGET=0x02
+AMY_MIDI_IS_MACOS=0x04
+AMY_MIDI_IS_WEBMIDI=0x08
+AMYBOARD_LRC=2
+AMYBOARD_BCLK=8
+AMYBOARD_DOUT=6
+AMYBOARD_DIN=9
+AMYBOARD_MCLK=3
+AMYBOARD_MIDI_OUT_TYPE_A=14
+AMYBOARD_MIDI_OUT_TYPE_B=15
+AMYBOARD_MIDI_IN=21
+AMY_AUDIO_DEVICE_OUT=0
+AMY_AUDIO_DEVICE_IN=1
+AMY_NUM_MIDI_CHANNELS=16
+RENDER_LUT_MAX_LANES=8
@@ -473,6 +473,15 @@ func set_render_load_threshold(threshold: float) -> void:
 	elif _synth:
 		_synth.call("set_render_load_threshold", threshold)
 
+## Fraction of the preallocated osc state arena in use (0..1)
+func osc_arena_occupancy() -> float:
+	if _is_web:
+		var v: Variant = JavaScriptBridge.eval("amy_c_api ? amy_c_api.osc_arena_occupancy() : null", true)
+		return 0.0 if v == null else float(v)
+	if _synth:
+		return _synth.call("osc_arena_occupancy")
+	return 0.0
+
 ## Play the startup bleep
 func bleep(start: int = 0) -> void:
 	if _is_web:
@@ -71,6 +71,10 @@ API = [
          args=[('message', 'str', None)], ret='void',
          doc='Send a wire-protocol message to AMY',
          platforms={'py', 'mp', 'web'}),
+    dict(py='send_wires', c='amy_add_messages',
+         args=[('messages', 'str', None)], ret='void',
+         doc='Send several wire messages, one per line, to AMY as one batch',
+         platforms={'py', 'mp', 'web'}),
     dict(py='send_wire_from_sysex', c='amy_send_wire_from_sysex',
          args=[('message', 'str', None)], ret='void',
          doc='Send a wire message as if from sysex (file-transfer routing applies)',
@@ -87,6 +91,10 @@ API = [
          args=[('threshold', 'f32', None)], ret='void',
          doc='Set the render-load fraction that trips the overload failsafe (0 disables)',
          platforms={'py', 'mp', 'web', 'gd'}),
+    dict(py='osc_arena_occupancy', c='amy_get_osc_arena_occupancy',
+         args=[], ret='f32',
+         doc='Fraction of the preallocated osc state arena in use (0..1)',
+         platforms={'py', 'mp', 'web', 'gd'}),
     dict(py='bleep', c='amy_bleep',
          args=[('start', 'u32', '0')], ret='void',
          doc='Play the startup bleep',
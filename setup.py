@@ -16,6 +16,11 @@ os.environ["CXX"] = "g++"
 comp_args = ["-I/opt/homebrew/include", "-DAMY_DEBUG", "-Wno-unused-but-set-variable", "-Wno-unreachable-code", "-DAMY_WAVETABLE"]
 link_args = ["-L/opt/homebrew/lib","-lpthread"]
 
+# AMY_FLOAT=1 builds the module with float32 SAMPLEs instead of fixed point.
+# tests/ref stays fixed point (see AMY_USE_FLOAT in src/amy.h).
+if os.environ.get('AMY_FLOAT'):
+	comp_args.append("-DAMY_USE_FLOAT")
+
 # Bake the Gamma9001 drum banks (kits at patches 384-390) into the module, like
 # the web build: generate build/drums_bin.c from sounds/gamma9001/ and link it.
 gamma_manifest = os.path.join('sounds', 'gamma9001', 'manifest.json')
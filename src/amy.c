@@ -45,12 +45,15 @@ const char* profile_tag_name(enum itags tag) {
         case PLAY_DELTA: return "PLAY_DELTA";
         case MIX_WITH_PAN: return "MIX_WITH_PAN";
         case AMY_RENDER: return "AMY_RENDER";
+        case AMY_RENDER_PLAN: return "AMY_RENDER_PLAN";
         case AMY_EXECUTE_DELTAS: return "AMY_EXECUTE_DELTAS";
         case AMY_FILL_BUFFER: return "AMY_FILL_BUFFER";
         case RENDER_LUT_FM: return "RENDER_LUT_FM";
         case RENDER_LUT_FB: return "RENDER_LUT_FB";
         case RENDER_LUT: return "RENDER_LUT";
         case RENDER_LUT_CUB: return "RENDER_LUT_CUB";
+        case RENDER_LUT_LANES: return "RENDER_LUT_LANES";
+        case FILTER_LANES: return "FILTER_LANES";
         case RENDER_LUT_FM_FB: return "RENDER_LUT_FM_FB";
         case RENDER_LPF_LUT: return "RENDER_LPF_LUT";
         case DSPS_BIQUAD_F32_ANSI_SPLIT_FB: return "DSPS_BIQUAD_F32_ANSI_SPLIT_FB";
@@ -89,73 +92,102 @@ void amy_profiles_print() {}
 #include "pcm_tiny.h"
 #endif
 
+#ifdef PCM_COMPRESSED
+const uint16_t pcm_c8_rom_samples = PCM_BASE_SAMPLES;
+const int8_t *const pcm_c8_rom_codes = pcm_c8;
+const uint8_t *const pcm_c8_rom_shifts = pcm_c8_shift;
+#else
+const uint16_t pcm_c8_rom_samples = 0;
+const int8_t *const pcm_c8_rom_codes = NULL;
+const uint8_t *const pcm_c8_rom_shifts = NULL;
+#endif
+
 #include "clipping_lookup_table.h"
 
 
-// Set up the mutex for accessing the queue during rendering (for multicore)
+// Set up the mutexes: amy_queue_lock for accessing the queue during
+// rendering (for multicore), and osc_arena_lock for the osc arena's free
+// lists, which both the thread adding events and the render thread allocate
+// from (see alloc_osc).
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/threading.h>
 #include <emscripten/wasm_worker.h>
 emscripten_lock_t amy_queue_lock = EMSCRIPTEN_LOCK_T_STATIC_INITIALIZER;
-void amy_grab_lock() {
-    emscripten_lock_busyspin_wait_acquire(&amy_queue_lock, 100);
-}
-void amy_release_lock() {
-    emscripten_lock_release(&amy_queue_lock);
-}
-void amy_init_lock() {
-}
+static emscripten_lock_t osc_arena_lock = EMSCRIPTEN_LOCK_T_STATIC_INITIALIZER;
+#define AMY_MUTEX_TAKE(m) emscripten_lock_busyspin_wait_acquire(&(m), 100)
+#define AMY_MUTEX_GIVE(m) emscripten_lock_release(&(m))
+#define AMY_MUTEX_TRY(m) emscripten_lock_try_acquire(&(m))
+#define AMY_MUTEX_INIT(m)
 
 #elif defined _WIN32
 CRITICAL_SECTION amy_queue_lock;
-void amy_grab_lock() {
-    EnterCriticalSection(&amy_queue_lock);
-}
-void amy_release_lock() {
-    LeaveCriticalSection(&amy_queue_lock);
-}
-void amy_init_lock() {
-    InitializeCriticalSection(&amy_queue_lock);
-}
+static CRITICAL_SECTION osc_arena_lock;
+#define AMY_MUTEX_TAKE(m) EnterCriticalSection(&(m))
+#define AMY_MUTEX_GIVE(m) LeaveCriticalSection(&(m))
+#define AMY_MUTEX_TRY(m) TryEnterCriticalSection(&(m))
+#define AMY_MUTEX_INIT(m) InitializeCriticalSection(&(m))
+
 #elif defined _POSIX_THREADS
 pthread_mutex_t amy_queue_lock;
-void amy_grab_lock() {
-    pthread_mutex_lock(&amy_queue_lock);
-}
-void amy_release_lock() {
-    pthread_mutex_unlock(&amy_queue_lock);
-}
-void amy_init_lock() {
-    pthread_mutex_init(&amy_queue_lock, NULL);
-}
+static pthread_mutex_t osc_arena_lock;
+#define AMY_MUTEX_TAKE(m) pthread_mutex_lock(&(m))
+#define AMY_MUTEX_GIVE(m) pthread_mutex_unlock(&(m))
+#define AMY_MUTEX_TRY(m) (pthread_mutex_trylock(&(m)) == 0)
+#define AMY_MUTEX_INIT(m) pthread_mutex_init(&(m), NULL)
+
 #elif defined ESP_PLATFORM
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 SemaphoreHandle_t amy_queue_lock;
+static SemaphoreHandle_t osc_arena_lock;
+#define AMY_MUTEX_TAKE(m) xSemaphoreTake((m), portMAX_DELAY)
+#define AMY_MUTEX_GIVE(m) xSemaphoreGive((m))
+#define AMY_MUTEX_TRY(m) (xSemaphoreTake((m), 0) == pdTRUE)
+#define AMY_MUTEX_INIT(m) ((m) = xSemaphoreCreateMutex())
 
-void amy_grab_lock() {
-    xSemaphoreTake(amy_queue_lock, portMAX_DELAY);
-}
-void amy_release_lock() {
-    xSemaphoreGive( amy_queue_lock );
-}
-void amy_init_lock() {
-    amy_queue_lock = xSemaphoreCreateMutex();
-}
 #else
 
+#define AMY_MUTEX_TAKE(m)
+#define AMY_MUTEX_GIVE(m)
+#define AMY_MUTEX_TRY(m) 1
+#define AMY_MUTEX_INIT(m)
+
+#endif
+
+// Deltas bound for the global queue reach the scheduler through a lock-free
+// ring (see "The delta ring" below) wherever the compiler has C11 atomics.
+#if !defined(__STDC_NO_ATOMICS__) && !defined(AMY_NO_DELTA_RING)
+#define AMY_DELTA_RING
+#include <stdatomic.h>
+#endif
+
+// Batches of events (amy_add_events) hold their deltas back per thread (see
+// "The delta batch" below), wherever the compiler has C11 thread-locals.
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(AMY_NO_DELTA_BATCH)
+#define AMY_DELTA_BATCH
+#endif
+static bool delta_batch_add(struct delta *d);
+static void delta_batch_flush(void);
+static void delta_batch_discard(void);
+
 void amy_grab_lock() {
+    AMY_MUTEX_TAKE(amy_queue_lock);
 }
 void amy_release_lock() {
+    AMY_MUTEX_GIVE(amy_queue_lock);
+}
+// Take the lock only if nobody holds it; true if we got it.
+bool amy_try_lock() {
+    return AMY_MUTEX_TRY(amy_queue_lock);
 }
 void amy_init_lock() {
+    AMY_MUTEX_INIT(amy_queue_lock);
+    AMY_MUTEX_INIT(osc_arena_lock);
 }
 
-#endif
-
 
 
 // Global state 
@@ -167,7 +199,47 @@ struct synthinfo ** synth;
 // envelope-modified per-osc state
 struct mod_synthinfo ** msynth;
 
-// Two mixing blocks, one per core of rendering
+// One bit per osc that may be SYNTH_AUDIBLE, so rendering visits what is
+// sounding rather than every osc slot.  A bit is set wherever an osc becomes
+// audible (osc_mark_audible) and cleared by reset_osc.  An osc that falls
+// silent or is freed mid-render -- terminate-on-silence, possibly on another
+// core, where a read-modify-write of a shared word would race -- keeps its
+// bit until the next scan finds it quiet and drops it (next_audible_osc).
+// Chorus LFOs (osc >= AMY_OSCS) are rendered separately and have no bit.
+uint32_t *audible_oscs = NULL;
+#define AUDIBLE_OSC_WORDS ((AMY_OSCS + 31) / 32)
+
+void osc_mark_audible(uint16_t osc) {
+    if (osc < AMY_OSCS) audible_oscs[osc >> 5] |= (1u << (osc & 31));
+}
+
+static void osc_clear_audible(uint16_t osc) {
+    if (osc < AMY_OSCS && audible_oscs != NULL) audible_oscs[osc >> 5] &= ~(1u << (osc & 31));
+}
+
+// Next osc in [osc, end) that is audible, or end if there are none.  Stale
+// bits are dropped on the way, but only in words lying wholly inside
+// [start, end), so concurrent scans of disjoint ranges never write a shared
+// word.
+static inline uint16_t next_audible_osc(uint16_t osc, uint16_t start, uint16_t end) {
+    while (osc < end) {
+        uint32_t word = osc >> 5;
+        uint32_t bits = audible_oscs[word] & (0xffffffffu << (osc & 31));
+        if (bits == 0) {
+            osc = (uint16_t)((word + 1) << 5);
+            continue;
+        }
+        uint16_t found = (uint16_t)((word << 5) + __builtin_ctz(bits));
+        if (found >= end) break;
+        if (synth[found] != NULL && synth[found]->status == SYNTH_AUDIBLE) return found;
+        if ((word << 5) >= start && MIN((word + 1) << 5, AMY_OSCS) <= end)
+            audible_oscs[word] &= ~(1u << (found & 31));
+        osc = found + 1;
+    }
+    return end;
+}
+
+// One mixing block per core of rendering (AMY_CORES of them).
 // Inner arrays are max_buses long, allocated in oscs_init.
 SAMPLE **fbl[AMY_MAX_CORES];
 SAMPLE **per_osc_fb[AMY_MAX_CORES];
@@ -393,6 +465,7 @@ void config_chorus(uint16_t bus, float level, uint16_t max_delay, float lfo_freq
         // apply depth, lfo_freq
         synth[CHORUS_MOD_SOURCE + bus]->amp_coefs[COEF_CONST] = depth;
         synth[CHORUS_MOD_SOURCE + bus]->logfreq_coefs[COEF_CONST] = logfreq_of_freq(lfo_freq);
+        osc_coefs_changed(synth[CHORUS_MOD_SOURCE + bus]);
     }
     amy_global.bus[bus]->chorus.max_delay = max_delay;
     amy_global.bus[bus]->chorus.level = F2S(level);
@@ -514,8 +587,16 @@ int8_t global_init(amy_config_t c) {
     amy_set_render_load_threshold(c.overload_threshold);
     amy_global.overload_blocks = (uint16_t)(c.overload_ms * 1000.f / ((float)AMY_BLOCK_US));
 
+    #ifdef AMY_RENDER_THREADS
+    amy_global.render_cores = c.platform.multicore ? MAX(1, MIN(c.render_threads, AMY_MAX_CORES)) : 1;
+    #elif defined(AMY_DUALCORE)
+    amy_global.render_cores = AMY_CORES;
+    #else
+    amy_global.render_cores = 1;
+    #endif
     amy_global.i2s_is_in_background = 0;
-    amy_global.delta_queue = NULL;
+    delta_sched_init();
+    delta_ring_init();
     amy_global.delta_qsize = 0;
     // The per-bus tables are sized from max_buses; nothing about a bus is a
     // fixed-width array any more.
@@ -621,7 +702,28 @@ float midi_note_for_logfreq(float logfreq) {
 
 
 void add_delta_to_queue(struct delta *d, struct delta **queue) {
+    // Held back if this thread is adding a batch of events.
+    if (queue == &amy_global.delta_queue && delta_batch_add(d))  return;
     AMY_PROFILE_START(ADD_DELTA_TO_QUEUE)
+#ifdef AMY_DELTA_RING
+    // The global queue's deltas go through the delta ring, without the lock;
+    // whoever next plays the queue moves them into the scheduler.
+    if (queue == &amy_global.delta_queue) {
+        if (!delta_ring_push(d)) {
+            // Full: drain it into the scheduler ourselves until there's room.
+            // (A drain can come up empty while another producer is still
+            // writing the oldest cell; that's only a few instructions.)
+            amy_grab_lock();
+            amy_global.delta_ring_full++;
+            do {
+                delta_ring_drain();
+            } while (!delta_ring_push(d));
+            amy_release_lock();
+        }
+        AMY_PROFILE_STOP(ADD_DELTA_TO_QUEUE)
+        return;
+    }
+#endif
     amy_grab_lock();
 
     // hack.  Update the (decorative) global queue size if we're adding to the global queue.
@@ -639,15 +741,15 @@ void add_delta_to_queue(struct delta *d, struct delta **queue) {
         return;
     }
 
-    // insert it into the sorted list for fast playback.
+    // The global queue is scheduled by the timing wheel (see delta_sched_insert);
+    // other queues (patches' delta lists) are kept sorted.
     // Wrap-relative: at the 49.7-day rollover a note_off scheduled a few ms out
     // has a tiny d->time while its own note_on is still near 2^32, so a plain
     // `>=` sorted the release ahead of the attack and the note droned forever.
-    struct delta **pptr = queue;
-    while(*pptr && AMY_TIME_GEQ(d->time, (*pptr)->time))
-        pptr = &(*pptr)->next;
-    new_d->next = *pptr;
-    *pptr = new_d;
+    if (queue == &amy_global.delta_queue)
+        delta_sched_insert(new_d);
+    else
+        delta_list_insert(queue, new_d);
 
     amy_release_lock();
     AMY_PROFILE_STOP(ADD_DELTA_TO_QUEUE)
@@ -723,7 +825,10 @@ bool osc_ref_within_voice(int rel_osc, uint16_t oscs_per_voice, const char *what
 #define EVENT_TO_DELTA_FREQ_COEFS(FIELD, FLAG) \
     EVENT_TO_DELTA_COEFS_COEF0_SPECIAL(FIELD, FLAG, logfreq_of_freq)
 
-static void flush_due_deltas();  // definition next to amy_execute_deltas()
+static void flush_due_deltas(bool wait);  // definition next to amy_execute_deltas()
+
+// Whether any of the fields in these groups may be set (see amy_event_groups).
+#define EVENT_HAS(GROUPS) (e->present & (GROUPS))
 
 // Add a API facing event, convert into delta directly
 void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_per_voice, struct delta **queue) {
@@ -737,7 +842,7 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
     if(AMY_IS_UNSET(e->time)) { d.time = 0; } 
 
     // If this is a bus-directed event, use d->osc to store the bus number instead.
-    if (event_addresses_bus(e)) {
+    if (EVENT_HAS(AMY_EV_BUS_FX) && event_addresses_bus(e)) {
         // Store the target bus in d.osc.  Either bus is specified, or synth is specified and has a bus, or default.
         uint16_t bus = amy_validate_bus(AMY_IS_SET(e->bus) ? e->bus :
             ((AMY_IS_SET(e->synth) && instrument_get_bus(e->synth) >= 0) ? instrument_get_bus(e->synth) : AMY_DEFAULT_BUS));
@@ -774,12 +879,12 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
 
     // Voices / patches gets set up here 
     // you must set both synth & load_patch together to load a patch 
-    if (AMY_IS_SET(e->synth)) {
+    if (EVENT_HAS(AMY_EV_SYNTH) && AMY_IS_SET(e->synth)) {
         if (AMY_IS_SET(e->patch_number) || AMY_IS_SET(e->num_voices) || AMY_IS_SET(e->oscs_per_voice)) {
             // Settle pending deltas without running the sequencer tick
             // service - this can execute on any sending thread (see
             // flush_due_deltas).
-            flush_due_deltas();
+            flush_due_deltas(true);
             patches_load_patch(e);
         }
         // Execute any other commands in this event.
@@ -789,7 +894,7 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
 
     // Is this, in fact, a non-load_patch or store_patch event that has patch_number set?
     // If so, add the event to the stored patch queue, not the execution queue.
-    if (AMY_IS_SET(e->patch_number)) {
+    if (EVENT_HAS(AMY_EV_PATCH) && AMY_IS_SET(e->patch_number)) {
         queue = queue_for_patch_number(e->patch_number);
         //fprintf(stderr, "event added to patch %d: osc %d wave %d...\n", e->patch_number, e->osc, e->wave);
         if (queue == NULL) {
@@ -811,12 +916,13 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
     // Everything else only added to queue if set
 
     // Only propagate bus if osc was explicit, not for default-zero-osc.
-    if (AMY_IS_SET(e->bus) && AMY_IS_SET(e->osc)) {
+    if (EVENT_HAS(AMY_EV_BUS) && AMY_IS_SET(e->bus) && AMY_IS_SET(e->osc)) {
         uint16_t bus = amy_validate_bus(e->bus);
         d.param = BUS; d.data.i = bus; add_delta_to_queue(&d, queue);
         if(bus > amy_global.highest_bus)
             amy_global.highest_bus = bus;
     }
+    if (EVENT_HAS(AMY_EV_WAVE)) {
     EVENT_TO_DELTA_I(wave, WAVE)
     // PRESET before MODE, and it matters: pcm_loop_config_allowed() refuses
     // whichever of the pair arrives second and makes the configuration
@@ -826,23 +932,31 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
     // preset would leave a loop mode pointing at nothing.
     EVENT_TO_DELTA_I(preset, PRESET)
     EVENT_TO_DELTA_I(mode, MODE)
-    EVENT_TO_DELTA_F(midi_note, MIDI_NOTE)
-    EVENT_TO_DELTA_COEFS(amp_coefs, AMP)
-    EVENT_TO_DELTA_FREQ_COEFS(freq_coefs, FREQ)
-    EVENT_TO_DELTA_FREQ_COEFS(filter_freq_coefs, FILTER_FREQ)
-    EVENT_TO_DELTA_COEFS(duty_coefs, DUTY)
-    EVENT_TO_DELTA_COEFS(pan_coefs, PAN)
+    }
+    if (EVENT_HAS(AMY_EV_NOTE))  EVENT_TO_DELTA_F(midi_note, MIDI_NOTE)
+    if (EVENT_HAS(AMY_EV_AMP_COEFS))  EVENT_TO_DELTA_COEFS(amp_coefs, AMP)
+    if (EVENT_HAS(AMY_EV_FREQ_COEFS))  EVENT_TO_DELTA_FREQ_COEFS(freq_coefs, FREQ)
+    if (EVENT_HAS(AMY_EV_FILTER_FREQ_COEFS))  EVENT_TO_DELTA_FREQ_COEFS(filter_freq_coefs, FILTER_FREQ)
+    if (EVENT_HAS(AMY_EV_DUTY_COEFS))  EVENT_TO_DELTA_COEFS(duty_coefs, DUTY)
+    if (EVENT_HAS(AMY_EV_PAN_COEFS))  EVENT_TO_DELTA_COEFS(pan_coefs, PAN)
+    if (EVENT_HAS(AMY_EV_OSC_PARAMS)) {
     EVENT_TO_DELTA_F(feedback, FEEDBACK)
     EVENT_TO_DELTA_F(trigger_phase, PHASE)
     EVENT_TO_DELTA_I(sample_offset, SAMPLE_OFFSET)
     EVENT_TO_DELTA_F(fit_ticks, FIT)
     EVENT_TO_DELTA_I(fit_search, FIT_SEARCH)
+    }
+    if (EVENT_HAS(AMY_EV_GLOBAL)) {
     EVENT_TO_DELTA_F(pitch_bend, PITCH_BEND)
     EVENT_TO_DELTA_I(latency_ms, LATENCY)
     EVENT_TO_DELTA_F(tempo, TEMPO)
+    }
+    if (EVENT_HAS(AMY_EV_OSC_PARAMS)) {
     EVENT_TO_DELTA_LOG(ratio, RATIO)
     EVENT_TO_DELTA_F(resonance, RESONANCE)
     EVENT_TO_DELTA_I(portamento_ms, PORTAMENTO)
+    }
+    if (EVENT_HAS(AMY_EV_OSC_REFS)) {
     EVENT_TO_DELTA_OSC_REF(chained_osc, CHAINED_OSC, "chained_osc")
     // reset_osc's payload is an osc number sometimes and a mask of RESET_*
     // bits the rest of the time -- play_delta tells them apart by the same
@@ -859,19 +973,26 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
     for (int i = 0; i < NUM_MOD_SOURCES; ++i) {
         EVENT_TO_DELTA_OSC_REF(mod_source[i], MOD_SOURCE_START + i, "mod_source")
     }
+    }
+    if (EVENT_HAS(AMY_EV_OSC_PARAMS)) {
     EVENT_TO_DELTA_I(note_source_channel, NOTE_SOURCE_CHANNEL)
     EVENT_TO_DELTA_I(filter_type, FILTER_TYPE)
+    }
+    if (EVENT_HAS(AMY_EV_DIST)) {
     EVENT_TO_DELTA_I(dist_type, DIST_TYPE)
     EVENT_TO_DELTA_F(dist_drive, DIST_DRIVE)
     EVENT_TO_DELTA_I(dist_bits, DIST_BITS)
     EVENT_TO_DELTA_I(dist_rate, DIST_RATE)
     EVENT_TO_DELTA_F(dist_mix, DIST_MIX)
+    }
+    if (EVENT_HAS(AMY_EV_OSC_PARAMS)) {
     EVENT_TO_DELTA_I(algorithm, ALGORITHM)
     EVENT_TO_DELTA_I(eg_type[0], EG0_TYPE)
     EVENT_TO_DELTA_I(eg_type[1], EG1_TYPE)
+    }
 
     bool algo_ops_set = false;
-    for (int i = 0; i < MAX_ALGO_OPS; ++i) {
+    for (int i = 0; i < MAX_ALGO_OPS && EVENT_HAS(AMY_EV_ALGO_SOURCE); ++i) {
         if(AMY_IS_SET(e->algo_source[i])) {
             algo_ops_set = true;
             break;
@@ -894,6 +1015,7 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
     uint32_t *bp_times_ms[MAX_BREAKPOINT_SETS] = {e->eg0_times, e->eg1_times};
     float *bp_values[MAX_BREAKPOINT_SETS] = {e->eg0_values, e->eg1_values};
     for (uint8_t i = 0; i < MAX_BREAKPOINT_SETS; i++) {
+        if (!EVENT_HAS(i == 0 ? AMY_EV_EG0 : AMY_EV_EG1))  continue;
         // amy_parse_message sets bp_is_set for anything including an empty bp string.
         // Direct API calls can set typed breakpoint arrays without touching bp_is_set.
         bool bp_arrays_set = AMY_IS_SET(bp_times_ms[i][0]) || AMY_IS_SET(bp_values[i][0]);
@@ -935,9 +1057,9 @@ void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_pe
 
     // add this last -- this is a trigger, that if sent alongside osc setup parameters, you want to run after those
 
-    EVENT_TO_DELTA_F(velocity, VELOCITY)
+    if (EVENT_HAS(AMY_EV_VELOCITY))  EVENT_TO_DELTA_F(velocity, VELOCITY)
 
-    if (AMY_IS_SET(e->patch_number)) {
+    if (EVENT_HAS(AMY_EV_PATCH) && AMY_IS_SET(e->patch_number)) {
         // If this was an event with a patch number, maybe we increased the number of oscs for this patch, update it.
          update_num_oscs_for_patch_number(e->patch_number);
     }
@@ -988,6 +1110,7 @@ void reset_osc_params(struct synthinfo *psynth) {
     psynth->duty_coefs[COEF_CONST] = 0.5f;
     for (int j = 0; j < NUM_COMBO_COEFS; ++j)  psynth->pan_coefs[j] = 0;
     psynth->pan_coefs[COEF_CONST] = 0.5f;
+    osc_coefs_changed(psynth);
     psynth->feedback = F2S(0); //.996; todo ks feedback is v different from fm feedback
     AMY_UNSET(psynth->trigger_phase);
     AMY_UNSET(psynth->sample_offset);
@@ -1013,6 +1136,7 @@ void reset_osc_params(struct synthinfo *psynth) {
             AMY_UNSET(psynth->breakpoint_values[j][k]);
         }
         psynth->eg_type[j] = ENVELOPE_NORMAL;  // ENVELOPE_LINEAR;  // no_amp_001: was ENVELOPE_NORMAL
+        osc_envelope_changed(psynth, j);
     }
     // Default EG0 setup to be key gate
     psynth->breakpoint_times[0][0] = 0;
@@ -1037,9 +1161,10 @@ void reset_osc_state(struct synthinfo *psynth) {
     for(uint8_t j=0;j<MAX_BREAKPOINT_SETS;j++) { psynth->last_scale[j] = 0; }
     psynth->last_two[0] = 0;
     psynth->last_two[1] = 0;
-    memset(&psynth->stretch, 0, sizeof(psynth->stretch));
+    if (psynth->stretch != NULL) memset(psynth->stretch, 0, sizeof(pcm_stretch_t));
     for(int j = 0; j < 2 * FILT_NUM_DELAYS; ++j) psynth->filter_delay[j] = 0;
     psynth->last_filt_norm_bits = 0;
+    psynth->filter_coeffs_type = FILTER_NONE;
     psynth->dist_state.hold = 0;
     psynth->dist_state.hold_count = 0;
     psynth->dist_state.hpf_yn1 = 0;
@@ -1057,6 +1182,7 @@ void reset_osc(uint16_t i ) {
     // set all the synth state to defaults
     if (synth[i] == NULL) return;
     reset_osc_by_pointer(synth[i], msynth[i]);
+    osc_clear_audible(i);
     synth[i]->osc = i; // self-reference to make updating oscs easier
 }
 
@@ -1066,6 +1192,7 @@ void amy_reset_oscs() {
     // We reset oscs by freeing them.
     // Include per-bus chorus oscs (osc=AMY_OSCS..AMY_OSCS+amy_global.config.max_buses)
     for(uint16_t i=0;i<AMY_OSCS + amy_global.config.max_buses;i++) free_osc(i);
+    bzero(audible_oscs, sizeof(uint32_t) * AUDIBLE_OSC_WORDS);
     //for(uint16_t i=0;i<AMY_OSCS + amy_global.config.max_buses;i++) reset_osc(i);
     // also reset filters and volume
     for (int bus = 0; bus < amy_global.config.max_buses; ++bus)
@@ -1090,11 +1217,147 @@ void amy_reset_oscs() {
 
 
 void amy_deltas_reset() {
-    delta_release_list(amy_global.delta_queue);
-    amy_global.delta_queue = NULL;
+    delta_batch_discard();
+    delta_ring_drain();
+    delta_sched_release_all();
     amy_global.delta_qsize = 0;
 }
 
+// The osc arena.  Every osc's synthinfo, mod_synthinfo and breakpoint
+// vectors -- and the fit state of the PCM oscs that use it -- come out of one
+// allocation made at amy_start, so making, growing and freeing oscs, which
+// play_delta does on the render thread, doesn't call the heap.  Blocks come in
+// size classes: one per breakpoint capacity an osc can have, plus one for the
+// fit state.  Each class keeps a free list threaded through its free blocks,
+// and a class with none free carves a new block off the arena's unused end.
+// The arena has room for every osc at the default capacity, plus
+// OSC_ARENA_SPARE_PERCENT for oscs grown past it and for fit state; beyond
+// that, blocks come from the heap (counted in amy_osc_arena_stats_t).
+#define OSC_ARENA_BREAKPOINT_CLASSES (MAX_BREAKPOINT_SETS * (MAX_BREAKPOINTS - DEFAULT_NUM_BREAKPOINTS) / DEFAULT_NUM_BREAKPOINTS + 1)
+#define OSC_ARENA_CLASSES (1 + OSC_ARENA_BREAKPOINT_CLASSES)
+#define OSC_ARENA_SPARE_PERCENT 25
+#define OSC_ARENA_ALIGN 16
+
+static struct {
+    uint8_t *base;
+    uint32_t size;
+    uint32_t carved;  // bytes from base already handed to a class
+    uint32_t class_size[OSC_ARENA_CLASSES];  // ascending
+    void *free_list[OSC_ARENA_CLASSES];
+    uint32_t blocks_used[OSC_ARENA_CLASSES];
+    uint32_t heap_blocks;  // live blocks that didn't fit in the arena
+} osc_arena;
+
+static inline uint32_t osc_arena_round(uint32_t size) {
+    return (size + OSC_ARENA_ALIGN - 1) & ~(uint32_t)(OSC_ARENA_ALIGN - 1);
+}
+
+// Bytes for an osc with this many breakpoints across its sets.
+static inline uint32_t osc_block_size(int total_num_breakpoints) {
+    return sizeof(struct synthinfo) + sizeof(struct mod_synthinfo)
+        + total_num_breakpoints * (sizeof(float) + sizeof(uint32_t));
+}
+
+static int osc_arena_class(uint32_t size) {
+    for (int c = 0; c < OSC_ARENA_CLASSES; ++c)
+        if (size <= osc_arena.class_size[c]) return c;
+    return -1;
+}
+
+void osc_arena_init(void) {
+    bzero(&osc_arena, sizeof(osc_arena));
+    // Class 0 is the fit state; then each step of DEFAULT_NUM_BREAKPOINTS an
+    // osc's two breakpoint sets can add up to.
+    osc_arena.class_size[0] = osc_arena_round(sizeof(pcm_stretch_t));
+    for (int c = 0; c < OSC_ARENA_BREAKPOINT_CLASSES; ++c)
+        osc_arena.class_size[1 + c] = osc_arena_round(
+            osc_block_size((MAX_BREAKPOINT_SETS + c) * DEFAULT_NUM_BREAKPOINTS));
+    uint32_t oscs = AMY_OSCS + amy_global.config.max_buses;
+    uint32_t size = oscs * osc_arena.class_size[1];
+    size += size / 100 * OSC_ARENA_SPARE_PERCENT;
+    osc_arena.base = malloc_caps(size, amy_global.config.ram_caps_oscs);
+    // Without an arena every block comes from the heap, as it would past a
+    // full one.
+    if (osc_arena.base == NULL) {
+        amy_oom("osc_arena_init: out of memory allocating %" PRIu32 " bytes for osc state\n", size);
+        return;
+    }
+    osc_arena.size = size;
+}
+
+void osc_arena_deinit(void) {
+    free(osc_arena.base);
+    bzero(&osc_arena, sizeof(osc_arena));
+}
+
+void *osc_arena_alloc(uint32_t size) {
+    int c = osc_arena_class(size);
+    void *block = NULL;
+    AMY_MUTEX_TAKE(osc_arena_lock);
+    if (c >= 0) {
+        block = osc_arena.free_list[c];
+        if (block != NULL) {
+            osc_arena.free_list[c] = *(void **)block;
+        } else if (osc_arena.carved + osc_arena.class_size[c] <= osc_arena.size) {
+            block = osc_arena.base + osc_arena.carved;
+            osc_arena.carved += osc_arena.class_size[c];
+        }
+        if (block != NULL) osc_arena.blocks_used[c]++;
+    }
+    if (block == NULL) {
+        block = malloc_caps(size, amy_global.config.ram_caps_oscs);
+        if (block != NULL) osc_arena.heap_blocks++;
+    }
+    AMY_MUTEX_GIVE(osc_arena_lock);
+    return block;
+}
+
+// size is what the block was allocated with.
+void osc_arena_free(void *block, uint32_t size) {
+    if (block == NULL) return;
+    AMY_MUTEX_TAKE(osc_arena_lock);
+    if ((uint8_t *)block < osc_arena.base || (uint8_t *)block >= osc_arena.base + osc_arena.size) {
+        free(block);
+        osc_arena.heap_blocks--;
+    } else {
+        int c = osc_arena_class(size);
+        *(void **)block = osc_arena.free_list[c];
+        osc_arena.free_list[c] = block;
+        osc_arena.blocks_used[c]--;
+        // Once nothing is allocated (amy_reset_oscs frees every osc), start
+        // carving again from the top, so the next patch isn't stuck with the
+        // last one's mix of classes.
+        uint32_t used = 0;
+        for (int i = 0; i < OSC_ARENA_CLASSES; ++i) used += osc_arena.blocks_used[i];
+        if (used == 0) {
+            osc_arena.carved = 0;
+            for (int i = 0; i < OSC_ARENA_CLASSES; ++i) osc_arena.free_list[i] = NULL;
+        }
+    }
+    AMY_MUTEX_GIVE(osc_arena_lock);
+}
+
+void amy_get_osc_arena_stats(amy_osc_arena_stats_t *stats) {
+    AMY_MUTEX_TAKE(osc_arena_lock);
+    stats->arena_bytes = osc_arena.size;
+    stats->used_bytes = 0;
+    stats->oscs = 0;
+    for (int c = 0; c < OSC_ARENA_CLASSES; ++c) {
+        stats->used_bytes += osc_arena.blocks_used[c] * osc_arena.class_size[c];
+        if (c > 0) stats->oscs += osc_arena.blocks_used[c];
+    }
+    stats->carved_bytes = osc_arena.carved;
+    stats->heap_blocks = osc_arena.heap_blocks;
+    AMY_MUTEX_GIVE(osc_arena_lock);
+}
+
+float amy_get_osc_arena_occupancy() {
+    amy_osc_arena_stats_t stats;
+    amy_get_osc_arena_stats(&stats);
+    if (stats.arena_bytes == 0) return 0;
+    return (float)stats.used_bytes / (float)stats.arena_bytes;
+}
+
 void alloc_osc(int osc, uint8_t *max_num_breakpoints) {
     peek_stack("alloc_osc");
     uint8_t default_num_breakpoints[MAX_BREAKPOINT_SETS] = {DEFAULT_NUM_BREAKPOINTS, DEFAULT_NUM_BREAKPOINTS};
@@ -1103,9 +1366,7 @@ void alloc_osc(int osc, uint8_t *max_num_breakpoints) {
     }
     int total_num_breakpoints = 0;
     for (int i=0; i < MAX_BREAKPOINT_SETS; ++i)  total_num_breakpoints += max_num_breakpoints[i];
-    uint8_t *ptr = malloc_caps(sizeof(struct synthinfo) + sizeof(struct mod_synthinfo)
-                               + total_num_breakpoints * (sizeof(float) + sizeof(uint32_t)),
-                               amy_global.config.ram_caps_oscs);
+    uint8_t *ptr = osc_arena_alloc(osc_block_size(total_num_breakpoints));
     // On OOM leave the osc NULL; the voice goes silent instead of crashing.
     if (ptr == NULL) {
         amy_oom("alloc_osc: out of memory allocating osc %d\n", osc);
@@ -1124,6 +1385,7 @@ void alloc_osc(int osc, uint8_t *max_num_breakpoints) {
         synth[osc]->breakpoint_values[i] = (float *)breakpoint_area;
         breakpoint_area += sizeof(float) * max_num_breakpoints[i];
     }
+    synth[osc]->stretch = NULL;
     reset_osc(osc);
     //fprintf(stderr, "alloc_osc %d (0x%lx) num_breakpoints %d,%d\n", osc, (long)synth[osc], synth[osc]->max_num_breakpoints[0], synth[osc]->max_num_breakpoints[1]);
 }
@@ -1131,7 +1393,9 @@ void alloc_osc(int osc, uint8_t *max_num_breakpoints) {
 void free_osc(int osc) {
     if (synth[osc] != NULL) {
         //fprintf(stderr, "free_osc %d (0x%lx)\n", osc, (long)synth[osc]);
-        free(synth[osc]);
+        osc_arena_free(synth[osc]->stretch, sizeof(pcm_stretch_t));
+        osc_arena_free(synth[osc], osc_block_size(synth[osc]->max_num_breakpoints[0]
+                                                  + synth[osc]->max_num_breakpoints[1]));
     }
     synth[osc] = NULL;
     msynth[osc] = NULL;
@@ -1199,7 +1463,8 @@ bool ensure_osc_allocd(int osc, uint8_t *max_num_breakpoints) {
                     AMY_UNSET(new_synth->breakpoint_values[i][j]);
                 }
             }
-            free(old_synth);
+            osc_arena_free(old_synth, osc_block_size(old_synth->max_num_breakpoints[0]
+                                                     + old_synth->max_num_breakpoints[1]));
         }
         for (int i = 0; i < MAX_BREAKPOINT_SETS; ++i)
             if (synth[osc]->max_num_breakpoints[i] < max_num_breakpoints[i]) return false;
@@ -1208,6 +1473,13 @@ bool ensure_osc_allocd(int osc, uint8_t *max_num_breakpoints) {
 }
 
 
+static void render_plan_init();
+static void render_plan_deinit();
+#ifdef AMY_RENDER_THREADS
+static void render_pool_start();
+static void render_pool_stop();
+#endif
+
 // the synth object keeps held state, whereas deltas are only deltas/changes
 int8_t oscs_init() {
     // Reset the sample clock before anything (like sequencer_init) anchors
@@ -1218,6 +1490,8 @@ int8_t oscs_init() {
     amy_global.time = 0;
     if(amy_global.config.ks_oscs>0)
         ks_init();
+    render_lut_simd_init();
+    filter_coeff_tables_init();
     algo_init();
     patches_init(amy_global.config.max_memory_patches);
     instruments_init(amy_global.config.max_synths);
@@ -1233,6 +1507,8 @@ int8_t oscs_init() {
     output_block = output_block_0;
     amy_in_block = (output_sample_type*)malloc_caps(sizeof(output_sample_type)*AMY_BLOCK_SIZE*AMY_NCHANS, amy_global.config.ram_caps_block);
     amy_external_in_block = (output_sample_type*)malloc_caps(sizeof(output_sample_type)*AMY_BLOCK_SIZE*AMY_NCHANS, amy_global.config.ram_caps_block);
+    audible_oscs = (uint32_t *)malloc_caps(sizeof(uint32_t) * AUDIBLE_OSC_WORDS, amy_global.config.ram_caps_synth);
+    osc_arena_init();
     // set all oscillators to their default values
     amy_reset_oscs();
     // reset the deltas queue
@@ -1257,6 +1533,10 @@ int8_t oscs_init() {
             bzero(fbl[core][bus], sizeof(SAMPLE) * AMY_BLOCK_SIZE * AMY_NCHANS);
         }
     }
+    render_plan_init();
+    #ifdef AMY_RENDER_THREADS
+    render_pool_start();
+    #endif
 
     // Set the optional inputs to 0
     for(uint16_t i=0;i<AMY_BLOCK_SIZE*AMY_NCHANS;i++) {
@@ -1311,14 +1591,21 @@ void show_debug(uint8_t type) {
     esp_show_debug();
     #endif
     if(type>0) {
+        // Only the due deltas are a list; the rest are counted.
         struct delta * ptr = amy_global.delta_queue;
-        uint16_t q = amy_global.delta_qsize;
-        if(q > 25) q = 25;
-        for(uint16_t i=0;i<q;i++) {
+        for(uint16_t i=0;ptr && i<25;i++) {
             fprintf(stderr,"%" PRIu16 " time %" PRIu32 " osc %" PRIu16 " param %d - %f %" PRIu32 "\n", i, ptr->time, ptr->osc, ptr->param, ptr->data.f, ptr->data.i);
             ptr = ptr->next;
         }
-        fprintf(stderr, "deltas_queue len %" PRIi32 ", free len %" PRIi32 "\n", delta_list_len(amy_global.delta_queue), delta_num_free());
+        fprintf(stderr, "deltas_queue len %" PRIi32 ", free len %" PRIi32 "\n", delta_sched_len(), delta_num_free());
+        fprintf(stderr, "delta wheel: most re-filed in one block %" PRIu32 "\n", amy_global.delta_refile_high_water);
+        fprintf(stderr, "delta ring: %" PRIu32 " waiting, most at once %" PRIu32 ", full %" PRIu32 ", dropped %" PRIu32
+                ", flushes deferred %" PRIu32 "\n", delta_ring_len(), amy_global.delta_ring_high_water,
+                amy_global.delta_ring_full, amy_global.delta_ring_dropped, amy_global.deferred_flushes);
+        fprintf(stderr, "pcm stream underruns %" PRIu32 "\n", amy_global.pcm_stream_underruns);
+        fprintf(stderr, "pcm cache hits %" PRIu32 " misses %" PRIu32 " evictions %" PRIu32 " resident bytes %" PRIu32 "\n",
+                amy_global.pcm_cache_hits, amy_global.pcm_cache_misses, amy_global.pcm_cache_evictions,
+                amy_global.pcm_resident_bytes);
         sequencer_debug();
     }
     if(type>1) {
@@ -1370,6 +1657,10 @@ void oscs_deinit() {
         dealloc_echo_delay_lines(bus);
         dealloc_reverb_delay_lines(bus);
     }
+    #ifdef AMY_RENDER_THREADS
+    render_pool_stop();
+    #endif
+    render_plan_deinit();
     for(int core = 0; core < AMY_CORES; ++core) {
         for (int bus = 0; bus < amy_global.config.max_buses; ++bus) {
             free(fbl[core][bus]);
@@ -1381,8 +1672,12 @@ void oscs_deinit() {
         per_osc_fb[core] = NULL;
     }
     deltas_pool_free();
+    delta_ring_free();
     // Include chorus osc (osc=AMY_OSCS)
     for (int i = 0; i < AMY_OSCS + amy_global.config.max_buses; ++i) free_osc(i);
+    osc_arena_deinit();
+    free(audible_oscs);
+    audible_oscs = NULL;
     free(amy_external_in_block);
     free(amy_in_block);
     free(output_block_1);
@@ -1500,8 +1795,64 @@ uint16_t alpha_to_portamento_ms(float alpha) {
 #define DELTA_TO_SYNTH_I_CLAMPED(FLAG, FIELD, MINVAL, MAXVAL) \
     if (d->param == FLAG) { synth[d->osc]->FIELD = MAX(MINVAL, MIN(MAXVAL, (int32_t)d->data.i)); }
 #define DELTA_TO_COEFS(FLAG, FIELD) \
-    if (PARAM_IS_COMBO_COEF(d->param, FLAG)) \
-        synth[d->osc]->FIELD[d->param - FLAG] = d->data.f;
+    if (PARAM_IS_COMBO_COEF(d->param, FLAG)) { \
+        synth[d->osc]->FIELD[d->param - FLAG] = d->data.f; \
+        osc_coefs_changed(synth[d->osc]); \
+    }
+
+// Make oscs to_base..to_base+num_oscs-1 copies of from_base..from_base+num_oscs-1.
+// patches_load_patch configures a synth's first voice from the patch and
+// then clones it into the others, instead of playing every patch delta once
+// per voice.  Each osc's synthinfo and mod_synthinfo are copied whole, except
+// for what belongs to the osc's own block: its breakpoint vectors (whose
+// contents are copied instead) and its fit state.  References to oscs within
+// the voice (chained_osc, mod_source, algo_source) are moved to the new one.
+static void clone_voice_oscs(uint16_t to_base, uint16_t from_base, uint16_t num_oscs) {
+    if ((uint32_t)to_base + num_oscs > AMY_OSCS || (uint32_t)from_base + num_oscs > AMY_OSCS) return;
+    int32_t shift = (int32_t)to_base - (int32_t)from_base;
+    for (uint16_t i = 0; i < num_oscs; ++i) {
+        uint16_t from = from_base + i, to = to_base + i;
+        struct synthinfo *src = synth[from];
+        // The patch never touched it, so it's at defaults, as the reset
+        // ahead of this delta left the target.
+        if (src == NULL) continue;
+        if (!ensure_osc_allocd(to, src->max_num_breakpoints)) continue;
+        struct synthinfo *dst = synth[to];
+        struct synthinfo own = *dst;  // the target's vectors, capacities and fit state
+        *dst = *src;
+        *msynth[to] = *msynth[from];
+        dst->osc = to;
+        dst->stretch = own.stretch;
+        for (int j = 0; j < MAX_BREAKPOINT_SETS; ++j) {
+            dst->breakpoint_times[j] = own.breakpoint_times[j];
+            dst->breakpoint_values[j] = own.breakpoint_values[j];
+            dst->max_num_breakpoints[j] = own.max_num_breakpoints[j];
+            memcpy(dst->breakpoint_times[j], src->breakpoint_times[j], src->max_num_breakpoints[j] * sizeof(uint32_t));
+            memcpy(dst->breakpoint_values[j], src->breakpoint_values[j], src->max_num_breakpoints[j] * sizeof(float));
+            for (int k = src->max_num_breakpoints[j]; k < dst->max_num_breakpoints[j]; ++k) {
+                AMY_UNSET(dst->breakpoint_times[j][k]);
+                AMY_UNSET(dst->breakpoint_values[j][k]);
+            }
+            osc_envelope_changed(dst, j);
+        }
+        osc_coefs_changed(dst);
+        if (src->stretch != NULL) {
+            if (dst->stretch == NULL) dst->stretch = osc_arena_alloc(sizeof(pcm_stretch_t));
+            if (dst->stretch != NULL) *dst->stretch = *src->stretch;
+        } else if (dst->stretch != NULL) {
+            memset(dst->stretch, 0, sizeof(pcm_stretch_t));
+        }
+        if (AMY_IS_SET(dst->chained_osc) && dst->chained_osc >= from_base && dst->chained_osc < from_base + num_oscs)
+            dst->chained_osc += shift;
+        for (int j = 0; j < NUM_MOD_SOURCES; ++j)
+            if (AMY_IS_SET(dst->mod_source[j]) && dst->mod_source[j] >= from_base && dst->mod_source[j] < from_base + num_oscs)
+                dst->mod_source[j] += shift;
+        for (int j = 0; j < MAX_ALGO_OPS; ++j)
+            if (AMY_IS_SET(dst->algo_source[j]) && dst->algo_source[j] >= from_base && dst->algo_source[j] < from_base + num_oscs)
+                dst->algo_source[j] += shift;
+        if (dst->status == SYNTH_AUDIBLE) osc_mark_audible(to);
+    }
+}
 
 // play an delta, now -- tell the audio loop to start making noise
 void play_delta(struct delta *d) {
@@ -1521,6 +1872,12 @@ void play_delta(struct delta *d) {
         AMY_PROFILE_STOP(PLAY_DELTA)
         return;
     }
+    if (d->param == CLONE_OSC) {
+        // Allocates the targets itself, at the source's breakpoint capacity.
+        clone_voice_oscs(d->osc, d->data.i & 0xffff, d->data.i >> 16);
+        AMY_PROFILE_STOP(PLAY_DELTA)
+        return;
+    }
 
     if (d->param != RESET_OSC) {
         // On OOM drop the delta; every branch below dereferences synth[d->osc].
@@ -1640,14 +1997,17 @@ void play_delta(struct delta *d) {
         } else {
             synth[d->osc]->breakpoint_values[bp_set][(pos-1) / 2] = d->data.f;
         }
+        osc_envelope_changed(synth[d->osc], bp_set);
     }
 
     if (PARAM_IS_COMBO_COEF(d->param, AMP) ||
         PARAM_IS_BP_COEF(d->param)) {
         // Changes to Amp/filter/EGs can potentially make a silence-suspended note come back.
         // Revive the note if it hasn't seen a note_off since the last note_on.
-        if (synth[d->osc]->status == SYNTH_INAUDIBLE && AMY_IS_UNSET(synth[d->osc]->note_off_clock))
+        if (synth[d->osc]->status == SYNTH_INAUDIBLE && AMY_IS_UNSET(synth[d->osc]->note_off_clock)) {
             synth[d->osc]->status = SYNTH_AUDIBLE;
+            osc_mark_audible(d->osc);
+        }
         // In theory, changing the amp coefs away from their defaults could turn on an osc.  But we won't
         // But it won't get started without a note-on.  Unfortunately, we can't call hold_and_modify first.
         // (if the osc has a modulator, we call the modulator in hold_and_modify, but the LUT hasn't been
@@ -1724,6 +2084,7 @@ void play_delta(struct delta *d) {
             synth[mod_osc]->role = SYNTH_IS_MOD_SOURCE;
             // Remove default amplitude dependence on velocity when an oscillator is made a modulator.
             synth[mod_osc]->amp_coefs[COEF_VEL] = 0;
+            osc_coefs_changed(synth[mod_osc]);
             // No longer record this osc in note_off state.
             AMY_UNSET(synth[mod_osc]->note_off_clock);
             // Start the mod osc.
@@ -1860,6 +2221,7 @@ void play_delta(struct delta *d) {
                     // Set the AUDIBLE flag *after* osc_note_on.  pcm_note_on wants to know if osc was already active, looks at status.
                     //fprintf(stderr, "osc: %d status -> AUDIBLE\n\r", osc);
                     synth[osc]->status = SYNTH_AUDIBLE;
+                    osc_mark_audible(osc);
                 }
                 osc = synth[osc]->chained_osc;
             }
@@ -1948,6 +2310,34 @@ float amp_combine_controls(float *controls, float *coefs) {
     return result;
 }
 
+// Bit i set where coefs[i] is nonzero, i.e. where the combination reads ctrl_inputs[i].
+static uint16_t ctrl_mask(const float *coefs) {
+    uint16_t mask = 0;
+    for (int i = 0; i < NUM_COMBO_COEFS; ++i)
+        if (coefs[i] != 0)  mask |= 1 << i;
+    return mask;
+}
+
+// Bit i set where ctrl_inputs[i] differs from was[i]; was is brought up to date.
+static inline uint16_t ctrl_inputs_moved(const float *ctrl_inputs, float *was) {
+    uint16_t moved = 0;
+    for (int i = 0; i < NUM_COMBO_COEFS; ++i)
+        if (ctrl_inputs[i] != was[i]) {
+            moved |= 1 << i;
+            was[i] = ctrl_inputs[i];
+        }
+    return moved;
+}
+
+// The combined amp for ctrl_inputs, reusing the last one if none of the inputs
+// amp reads have moved (or force says recombine anyway).
+static inline float ctrl_amp(uint16_t osc, float *ctrl_inputs, bool force) {
+    ctrl_cache_t *c = &synth[osc]->ctrl;
+    if ((ctrl_inputs_moved(ctrl_inputs, c->amp_inputs) & c->mask[CTRL_AMP]) || force)
+        c->combined[CTRL_AMP] = amp_combine_controls(ctrl_inputs, synth[osc]->amp_coefs);
+    return c->combined[CTRL_AMP];
+}
+
 // apply an mod & bp, if any, to the osc
 #ifdef __EMSCRIPTEN__
 #include "emscripten/webaudio.h"
@@ -1967,15 +2357,38 @@ void hold_and_modify(uint16_t osc) {
     ctrl_inputs[COEF_EXT0] = cv_inputs[0];
     ctrl_inputs[COEF_EXT1] = cv_inputs[1];
 
+    // Only combine the controls whose inputs have moved since they were last
+    // combined.  The inputs themselves are always evaluated: the envelopes
+    // keep their last_scale, and the mod sources advance, as they go.
+    ctrl_cache_t *c = &synth[osc]->ctrl;
+    uint16_t moved = ctrl_inputs_moved(ctrl_inputs, c->inputs);
+    bool force = c->stale;
+    if (force) {
+        c->mask[CTRL_LOGFREQ] = ctrl_mask(synth[osc]->logfreq_coefs);
+        c->mask[CTRL_FILTER_LOGFREQ] = ctrl_mask(synth[osc]->filter_logfreq_coefs);
+        c->mask[CTRL_DUTY] = ctrl_mask(synth[osc]->duty_coefs);
+        c->mask[CTRL_PAN] = ctrl_mask(synth[osc]->pan_coefs);
+        c->mask[CTRL_AMP] = ctrl_mask(synth[osc]->amp_coefs);
+        c->stale = 0;
+    }
+    if ((moved & c->mask[CTRL_LOGFREQ]) || force)
+        c->combined[CTRL_LOGFREQ] = combine_controls(ctrl_inputs, synth[osc]->logfreq_coefs);
+    if ((moved & c->mask[CTRL_FILTER_LOGFREQ]) || force)
+        c->combined[CTRL_FILTER_LOGFREQ] = combine_controls(ctrl_inputs, synth[osc]->filter_logfreq_coefs);
+    if ((moved & c->mask[CTRL_DUTY]) || force)
+        c->combined[CTRL_DUTY] = combine_controls(ctrl_inputs, synth[osc]->duty_coefs);
+    if ((moved & c->mask[CTRL_PAN]) || force)
+        c->combined[CTRL_PAN] = combine_controls(ctrl_inputs, synth[osc]->pan_coefs);
+
     // copy all the modifier variables
-    float logfreq = combine_controls(ctrl_inputs, synth[osc]->logfreq_coefs);
+    float logfreq = c->combined[CTRL_LOGFREQ];
     if (synth[osc]->portamento_alpha == 0) {
         msynth[osc]->logfreq = logfreq;
     } else {
         msynth[osc]->logfreq = logfreq + synth[osc]->portamento_alpha * (msynth[osc]->last_logfreq - logfreq);
     }
     msynth[osc]->last_logfreq = msynth[osc]->logfreq;
-    float filter_logfreq = combine_controls(ctrl_inputs, synth[osc]->filter_logfreq_coefs);
+    float filter_logfreq = c->combined[CTRL_FILTER_LOGFREQ];
     if (filter_logfreq < MIN_FILTER_LOGFREQ)  filter_logfreq = MIN_FILTER_LOGFREQ;
     if (AMY_IS_SET(msynth[osc]->last_filter_logfreq)) {
         #define MAX_DELTA_FILTER_LOGFREQ_DOWN 3.0f
@@ -1988,10 +2401,10 @@ void hold_and_modify(uint16_t osc) {
     }
     msynth[osc]->last_filter_logfreq = filter_logfreq;
     msynth[osc]->filter_logfreq = filter_logfreq;
-    msynth[osc]->duty = combine_controls(ctrl_inputs, synth[osc]->duty_coefs);
+    msynth[osc]->duty = c->combined[CTRL_DUTY];
 
     msynth[osc]->last_pan = msynth[osc]->pan;
-    msynth[osc]->pan = combine_controls(ctrl_inputs, synth[osc]->pan_coefs);
+    msynth[osc]->pan = c->combined[CTRL_PAN];
     // Don't smear the pan on first frame of new note
     if (synth[osc]->note_on_clock == amy_global.total_samples) {
         //fprintf(stderr, "time %.3f osc %d note on\n", amy_global.time, osc);
@@ -2001,7 +2414,7 @@ void hold_and_modify(uint16_t osc) {
     }
 
     // amp is a special case - coeffs apply in log domain.
-    float new_amp = amp_combine_controls(ctrl_inputs, synth[osc]->amp_coefs);
+    float new_amp = ctrl_amp(osc, ctrl_inputs, force);
     // Also, we advance one frame by writing both last_amp and amp (=next amp)
     // *Except* for partials, where we allow one frame of ramp-on.
     if (synth[osc]->wave == PARTIAL) {
@@ -2016,7 +2429,7 @@ void hold_and_modify(uint16_t osc) {
         // Advance the envelopes to the beginning of the next frame.
         ctrl_inputs[COEF_EG0] = S2F(compute_breakpoint_scale(osc, 0, AMY_BLOCK_SIZE));
         ctrl_inputs[COEF_EG1] = S2F(compute_breakpoint_scale(osc, 1, AMY_BLOCK_SIZE));
-        msynth[osc]->amp = amp_combine_controls(ctrl_inputs, synth[osc]->amp_coefs);
+        msynth[osc]->amp = ctrl_amp(osc, ctrl_inputs, false);
     }
     msynth[osc]->feedback = synth[osc]->feedback;
     msynth[osc]->resonance = synth[osc]->resonance;
@@ -2037,6 +2450,17 @@ static inline float rgain_of_pan(float pan) {
     return dsps_sqrtf_f32_ansi(pan);
 }
 
+// Left and right gains at the start of a block, and their per-sample steps,
+// for panning an osc from pan_start to pan_end at the given level.
+static inline void pan_gain_ramp(float pan_start, float pan_end, float level,
+                                 SAMPLE *gain_l, SAMPLE *gain_r, SAMPLE *d_gain_l, SAMPLE *d_gain_r) {
+    float lgain_start = lgain_of_pan(pan_start) * level;
+    float rgain_start = rgain_of_pan(pan_start) * level;
+    *gain_l = F2S(lgain_start);
+    *gain_r = F2S(rgain_start);
+    *d_gain_l = SHIFTR(F2S(lgain_of_pan(pan_end) * level - lgain_start), BLOCK_SIZE_BITS);
+    *d_gain_r = SHIFTR(F2S(rgain_of_pan(pan_end) * level - rgain_start), BLOCK_SIZE_BITS);
+}
 
 void mix_with_pan(SAMPLE *stereo_dest, SAMPLE *mono_src, float pan_start, float pan_end, float level) {
     AMY_PROFILE_START(MIX_WITH_PAN)
@@ -2054,18 +2478,23 @@ void mix_with_pan(SAMPLE *stereo_dest, SAMPLE *mono_src, float pan_start, float
         }
     } else {
         // stereo
-        float lgain_start = lgain_of_pan(pan_start) * level;
-        float rgain_start = rgain_of_pan(pan_start) * level;
-        SAMPLE gain_l = F2S(lgain_start);
-        SAMPLE gain_r = F2S(rgain_start);
-        SAMPLE d_gain_l = F2S((lgain_of_pan(pan_end) * level - lgain_start)) >> BLOCK_SIZE_BITS;
-        SAMPLE d_gain_r = F2S((rgain_of_pan(pan_end) * level - rgain_start)) >> BLOCK_SIZE_BITS;
+        SAMPLE gain_l, gain_r, d_gain_l, d_gain_r;
+        pan_gain_ramp(pan_start, pan_end, level, &gain_l, &gain_r, &d_gain_l, &d_gain_r);
+#ifdef AMY_USE_FIXEDPOINT
         for(uint16_t i=0;i<AMY_BLOCK_SIZE;i++) {
             stereo_dest[i] += MUL8_SS(gain_l, mono_src[i]);
             stereo_dest[AMY_BLOCK_SIZE + i] += MUL8_SS(gain_r, mono_src[i]);
             gain_l += d_gain_l;
             gain_r += d_gain_r;
         }
+#else
+        // Float gains are start + i * step, as render_lut's amps are, so no
+        // sum carries from sample to sample and the compiler vectorizes this.
+        for(uint16_t i=0;i<AMY_BLOCK_SIZE;i++) {
+            stereo_dest[i] += MUL8_SS(gain_l + (float)i * d_gain_l, mono_src[i]);
+            stereo_dest[AMY_BLOCK_SIZE + i] += MUL8_SS(gain_r + (float)i * d_gain_r, mono_src[i]);
+        }
+#endif
     }
     AMY_PROFILE_STOP(MIX_WITH_PAN)
 }
@@ -2073,7 +2502,46 @@ void mix_with_pan(SAMPLE *stereo_dest, SAMPLE *mono_src, float pan_start, float
 // Test if the specified osc is in its release phase (i.e., note-off has been received).
 #define OSC_IN_RELEASE(osc)  (AMY_IS_SET(synth[osc]->note_off_clock))
 
-SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf) {
+// note: Code transplanted here from hold_and_modify() to distinguish actual zero output
+// from zero-amplitude (but maybe inheriting values from chained_oscs).
+// Stop oscillators if amp is zero for several frames in a row.
+// Note: We can't wait for the note off because we need to turn off PARTIAL oscs when envelopes end, even if no note off.
+static void stop_osc_if_silent(uint16_t osc, SAMPLE max_val) {
+    if (OSC_IN_RELEASE(osc) && max_val < F2S(AMP_THRESH) && synth[osc]->terminate_on_silence) {
+        //printf("h&m: time %.3f osc %d OFF\n", amy_global.time, osc);
+        // Oscillator has fallen silent, stop executing it.
+        uint16_t osc_to_stop = osc;  // Type must match synthinfo.chained_osc
+        while (AMY_IS_SET(osc_to_stop) && synth[osc_to_stop] != NULL) {  // a freed link ends the chain
+            synth[osc_to_stop]->status = SYNTH_INAUDIBLE;  // It *could* come back... (its audible bit goes at the next scan)
+            // 2026-03-22: It's necessary to reset these two fields in msynth to get OwBass to restart without click...
+            msynth[osc_to_stop]->filter_logfreq = 0;  // (a)
+            msynth[osc_to_stop]->resonance = 0.7f;  // (b)
+            //reset_filter(osc_to_stop);                // (c)
+            //AMY_UNSET(msynth[osc_to_stop]->last_filter_logfreq);  // (d)
+            // .. but force it to start at zero phase next time.
+            synth[osc_to_stop]->phase = 0;
+            osc_to_stop = synth[osc_to_stop]->chained_osc;
+        }
+    }
+}
+
+// Run osc's filter on buf, the last stage of its render.
+static inline SAMPLE filter_osc(uint16_t osc, SAMPLE *buf, SAMPLE max_val) {
+    max_val = filter_process(buf, osc, max_val);
+    // Maybe clear filter state here if we've finshed this osc.
+    if (synth[osc]->status != SYNTH_AUDIBLE) {
+        reset_filter(osc);  // (f)
+    }
+    return max_val;
+}
+
+SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf);
+
+// render_osc_wave, except that with defer_filter it stops short of osc's own
+// filter, which the caller has checked is its last stage: the filter, and
+// stopping the osc if that leaves it silent, are up to the caller, and the
+// max returned is the unfiltered one.
+static SAMPLE render_osc_wave_unfiltered(uint16_t osc, uint8_t core, SAMPLE* buf, bool defer_filter) {
     AMY_PROFILE_START(RENDER_OSC_WAVE)
     // Returns abs max of what it wrote.
         //if (osc < amy_global.config.max_oscs) // exclude chorus LFOs.
@@ -2126,12 +2594,8 @@ SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf) {
                 max_val = dist_process(buf, osc);
             }
             // apply filter to osc if set
-            if (synth[osc]->filter_type != FILTER_NONE) {
-                max_val = filter_process(buf, osc, max_val);
-                // Maybe clear filter state here if we've finshed this osc.
-                if (synth[osc]->status != SYNTH_AUDIBLE) {
-                    reset_filter(osc);  // (f)
-                }
+            if (synth[osc]->filter_type != FILTER_NONE && !defer_filter) {
+                max_val = filter_osc(osc, buf, max_val);
             }
         }
         if(AMY_IS_SET(synth[osc]->chained_osc)) {
@@ -2154,34 +2618,11 @@ SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf) {
                 max_val = dist_process(buf, osc);
             }
             // apply filter to osc if set
-            if (synth[osc]->filter_type != FILTER_NONE) {
-                max_val = filter_process(buf, osc, max_val);
-                // Maybe clear filter state here if we've finshed this osc.
-                if (synth[osc]->status != SYNTH_AUDIBLE) {
-                    reset_filter(osc);  // (f)
-                }
-            }
-        }
-        // note: Code transplanted here from hold_and_modify() to distinguish actual zero output
-        // from zero-amplitude (but maybe inheriting values from chained_oscs).
-        // Stop oscillators if amp is zero for several frames in a row.
-        // Note: We can't wait for the note off because we need to turn off PARTIAL oscs when envelopes end, even if no note off.
-        if (OSC_IN_RELEASE(osc) && max_val < F2S(AMP_THRESH) && synth[osc]->terminate_on_silence) {
-            //printf("h&m: time %.3f osc %d OFF\n", amy_global.time, osc);
-            // Oscillator has fallen silent, stop executing it.
-            uint16_t osc_to_stop = osc;  // Type must match synthinfo.chained_osc
-            while (AMY_IS_SET(osc_to_stop) && synth[osc_to_stop] != NULL) {  // a freed link ends the chain
-                synth[osc_to_stop]->status = SYNTH_INAUDIBLE;  // It *could* come back...
-                // 2026-03-22: It's necessary to reset these two fields in msynth to get OwBass to restart without click...
-                msynth[osc_to_stop]->filter_logfreq = 0;  // (a)
-                msynth[osc_to_stop]->resonance = 0.7f;  // (b)
-                //reset_filter(osc_to_stop);                // (c)
-                //AMY_UNSET(msynth[osc_to_stop]->last_filter_logfreq);  // (d)
-                // .. but force it to start at zero phase next time.
-                synth[osc_to_stop]->phase = 0;
-                osc_to_stop = synth[osc_to_stop]->chained_osc;
+            if (synth[osc]->filter_type != FILTER_NONE && !defer_filter) {
+                max_val = filter_osc(osc, buf, max_val);
             }
         }
+        if (!defer_filter) stop_osc_if_silent(osc, max_val);
         //fprintf(stderr, "render_osc_wave: t=%.3f osc=%d max_val %.6f\n", amy_global.time, osc, S2F(max_val));
     }
     AMY_PROFILE_STOP(RENDER_OSC_WAVE)
@@ -2191,63 +2632,281 @@ SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf) {
     return max_val;
 }
 
-AMY_IRAM_ATTR void amy_render(uint16_t start, uint16_t end, uint8_t core) {
-    AMY_PROFILE_START(AMY_RENDER)
+SAMPLE render_osc_wave(uint16_t osc, uint8_t core, SAMPLE* buf) {
+    return render_osc_wave_unfiltered(osc, core, buf, false);
+}
 
+// Clear this core's mixing blocks ahead of a block's rendering.
+static inline void render_mix_begin(uint8_t core) {
     for(int bus = 0; bus <= amy_global.highest_bus; ++bus)
         bzero(fbl[core][bus], sizeof(SAMPLE) * AMY_BLOCK_SIZE * AMY_NCHANS); 
+}
+
+// An osc that stopped during its render goes back to its reset state.
+static inline void retire_osc_if_stopped(uint16_t osc) {
+    if (synth[osc]->status != SYNTH_AUDIBLE) {
+        reset_modosc(msynth[osc]);  // (g)  This makes a difference, but not clicks
+        reset_osc_state(synth[osc]);
+    }
+}
+
+// Per-instrument level (iV): scale this osc's rendered audio
+// by its synth's level (1.0 for oscs outside any instrument's
+// voices). Applied to the audio output only — mod/control
+// oscs already multiply into their carriers, so scaling every
+// osc's amp would square the level for layered patches. The
+// level folds into mix_with_pan's per-block gain endpoints,
+// so it adds no per-sample work in stereo.
+static inline float osc_output_level(uint16_t osc) {
+    if (osc_to_voice != NULL && AMY_IS_SET(osc_to_voice[osc]))
+        return instrument_level_for_voice(osc_to_voice[osc]);
+    return 1.0f;
+}
+
+#ifdef AMY_RENDER_LUT_SIMD
+// Cross-voice batching.  A plain sine, triangle or saw osc -- one that is
+// nobody's modulator or chained osc, and has no chain, filter, distortion or
+// render hook of its own -- only runs a render_lut kernel and pans into the
+// mix, so instead of rendering it alone, render_and_mix_osc runs its
+// hold_and_modify and parks it in a batch with others of the same kernel,
+// LUT and bus.  A full batch renders as one lane per osc
+// (render_lut_lanes), then each osc is finished exactly as render_osc_wave
+// and render_and_mix_osc would, and all are panned into the mix in one pass
+// (mix_lut_lanes).  Each osc's block is the same math as rendering it
+// alone.  In fixed point, mixing is integer addition, so the output is
+// bit-identical; float addition isn't associative, so a float mix can move
+// by a rounding step when the batch adds oscs in another order.
+// Whatever is left in the batches is flushed at the end of the core's block.
+#define RENDER_BATCHES 4
+typedef struct {
+    uint8_t kind;  // LUT_LANE_*; LUT_LANE_NONE when the batch is empty.
+    uint8_t oscs;
+    uint16_t bus;
+    const LUT *lut;
+    uint16_t osc[RENDER_LUT_MAX_LANES];
+    lut_lane_t lane[RENDER_LUT_MAX_LANES];
+} render_batch_t;
+
+static render_batch_t render_batches[AMY_MAX_CORES][RENDER_BATCHES];
+static SAMPLE render_batch_tile[AMY_MAX_CORES][AMY_BLOCK_SIZE * RENDER_LUT_MAX_LANES];
+
+static SAMPLE render_batch_flush(render_batch_t *batch, uint8_t core) {
+    uint8_t width = render_lut_lane_width();
+    SAMPLE max_values[RENDER_LUT_MAX_LANES];
+    // Spare lanes render silence and mix at zero gain.
+    for (uint8_t k = batch->oscs; k < width; ++k)
+        bzero(&batch->lane[k], sizeof(lut_lane_t));
+    render_lut_lanes(batch->kind, batch->lut, batch->lane, render_batch_tile[core], max_values);
     SAMPLE max_max = 0;
-    for(uint16_t osc=start; osc<end; osc++) {
-        if(synth[osc] != NULL && synth[osc]->status == SYNTH_AUDIBLE) { // skip oscs that are silent or mod sources from playback
-            uint16_t bus = synth[osc]->bus;
-            bzero(per_osc_fb[core][bus], AMY_BLOCK_SIZE * sizeof(SAMPLE));
-            SAMPLE max_val = render_osc_wave(osc, core, per_osc_fb[core][bus]);
-            if (synth[osc]->status != SYNTH_AUDIBLE) {
-                reset_modosc(msynth[osc]);  // (g)  This makes a difference, but not clicks
-                reset_osc_state(synth[osc]);
-            }
-            uint8_t handled = 0;
-            if(amy_global.config.amy_external_render_hook != NULL) {
-                handled = amy_global.config.amy_external_render_hook(osc, per_osc_fb[core][bus], AMY_BLOCK_SIZE);
-            } else {
-                #ifdef __EMSCRIPTEN__
-                // Web version of the render hook: a JS function (in the same
-                // audio worklet as this module) may replace this osc's buffer,
-                // e.g. with a runtime-compiled user oscillator. Returns 1 if
-                // handled (osc skips the normal mix), like the native hook.
-                // JS can't reach msynth, so pass the osc's current pitch (as a
-                // phase increment in cycles/sample, tracking bend/portamento)
-                // and envelope level (0..1); Module is this AudioWorklet
-                // scope's instance. The pitch math only runs if the hook is
-                // installed (the typeof probe is cheap, every osc pays it).
-                if (EM_ASM_INT({ return typeof amy_render_js_hook === 'function' ? 1 : 0; })) {
-                    handled = EM_ASM_INT({
-                        // (see the bus postprocess hook about wasmMemory)
-                        if (!Module.wasmMemory) Module.wasmMemory = wasmMemory;
-                        return amy_render_js_hook($0, $1, $2, $3, $4, Module);
-                    }, osc, per_osc_fb[core][bus], AMY_BLOCK_SIZE,
-                       (double)(freq_of_logfreq(msynth[osc]->logfreq) / (float)AMY_SAMPLE_RATE),
-                       (double)msynth[osc]->amp);
-                }
-                #endif
-            }
-            // only mix the audio in if the external hook did not handle it
-            if(!handled) {
-                // Per-instrument level (iV): scale this osc's rendered audio
-                // by its synth's level (1.0 for oscs outside any instrument's
-                // voices). Applied to the audio output only — mod/control
-                // oscs already multiply into their carriers, so scaling every
-                // osc's amp would square the level for layered patches. The
-                // level folds into mix_with_pan's per-block gain endpoints,
-                // so it adds no per-sample work in stereo.
-                float instrument_level = 1.0f;
-                if (osc_to_voice != NULL && AMY_IS_SET(osc_to_voice[osc]))
-                    instrument_level = instrument_level_for_voice(osc_to_voice[osc]);
-                mix_with_pan(fbl[core][bus], per_osc_fb[core][bus], msynth[osc]->last_pan, msynth[osc]->pan, instrument_level);
-            }
-            if (max_val > max_max) max_max = max_val;
-        } // end if audible
+    for (uint8_t k = 0; k < batch->oscs; ++k) {
+        uint16_t osc = batch->osc[k];
+        lut_lane_t *lane = &batch->lane[k];
+        synth[osc]->phase = lane->phase;
+        msynth[osc]->last_amp = msynth[osc]->amp;
+        stop_osc_if_silent(osc, max_values[k]);
+        retire_osc_if_stopped(osc);
+        pan_gain_ramp(msynth[osc]->last_pan, msynth[osc]->pan, osc_output_level(osc),
+                      &lane->gain_l, &lane->gain_r, &lane->d_gain_l, &lane->d_gain_r);
+        if (max_values[k] > max_max) max_max = max_values[k];
+    }
+    mix_lut_lanes(fbl[core][batch->bus], render_batch_tile[core], batch->lane);
+    batch->kind = LUT_LANE_NONE;
+    batch->oscs = 0;
+    return max_max;
+}
+
+static SAMPLE render_batch_flush_all(uint8_t core) {
+    SAMPLE max_max = 0;
+    for (int b = 0; b < RENDER_BATCHES; ++b) {
+        if (render_batches[core][b].kind == LUT_LANE_NONE) continue;
+        SAMPLE max_val = render_batch_flush(&render_batches[core][b], core);
+        if (max_val > max_max) max_max = max_val;
+    }
+    return max_max;
+}
+
+// Take over rendering osc if it can be batched.  Returns the max of any
+// batch this filled and flushed, through *max_val.
+static bool render_batch_add(uint16_t osc, uint8_t core, SAMPLE *max_val) {
+    struct synthinfo *s = synth[osc];
+    uint8_t wave = s->wave;
+    if (!(wave == SINE || wave == TRIANGLE || wave == SAW_DOWN || wave == SAW_UP)) return false;
+    uint8_t width = render_lut_lane_width();
+    if (width == 0 || amy_global.config.amy_external_render_hook != NULL) return false;
+    if (s->role != SYNTH_IS_NORMAL || AMY_IS_SET(s->chained_osc)
+        || s->filter_type != FILTER_NONE || s->dist.type != DIST_OFF) return false;
+    if (s->render_clock == amy_global.total_samples || s->amp_coefs[COEF_CONST] == 0) return false;
+    // From here on this is render_osc_wave's work for a plain osc.
+    s->render_clock = amy_global.total_samples;
+    hold_and_modify(osc);
+    *max_val = 0;
+    const LUT *lut;
+    lut_lane_t lane;
+    uint8_t kind = LUT_LANE_NONE;
+    if (!(msynth[osc]->amp == 0 && msynth[osc]->last_amp == 0))
+        kind = osc_lut_lane(osc, &lut, &lane);
+    if (kind == LUT_LANE_NONE) {
+        // Nothing to render; a zero block mixes in as nothing.
+        stop_osc_if_silent(osc, 0);
+        retire_osc_if_stopped(osc);
+        return true;
+    }
+    render_batch_t *batches = render_batches[core];
+    render_batch_t *batch = NULL;
+    for (int b = 0; b < RENDER_BATCHES && batch == NULL; ++b)
+        if (batches[b].kind == kind && batches[b].lut == lut && batches[b].bus == s->bus)
+            batch = &batches[b];
+    for (int b = 0; b < RENDER_BATCHES && batch == NULL; ++b)
+        if (batches[b].kind == LUT_LANE_NONE)
+            batch = &batches[b];
+    if (batch == NULL) {
+        // All batches are open for other LUTs; flush the fullest.
+        batch = &batches[0];
+        for (int b = 1; b < RENDER_BATCHES; ++b)
+            if (batches[b].oscs > batch->oscs) batch = &batches[b];
+        *max_val = render_batch_flush(batch, core);
+    }
+    if (batch->kind == LUT_LANE_NONE) {
+        batch->kind = kind;
+        batch->lut = lut;
+        batch->bus = s->bus;
+    }
+    batch->osc[batch->oscs] = osc;
+    batch->lane[batch->oscs] = lane;
+    if (++batch->oscs == width) {
+        SAMPLE flushed = render_batch_flush(batch, core);
+        if (flushed > *max_val) *max_val = flushed;
+    }
+    return true;
+}
+
+// Cross-voice filter bank.  An osc whose biquad is the last stage of its
+// render -- a SILENT voice head filtering its whole chain, like every Juno
+// voice's LPF24, or an osc with no chain -- renders into a block of the
+// bank for its kind of biquad, unfiltered, and joins the bank as a lane.  A
+// full bank runs all its filters at once (filter_lanes), then each osc is
+// finished exactly as render_osc_wave and render_and_mix_osc would and
+// mixed in.  Each lane is the same math as filtering alone, so the output
+// is bit-identical in fixed point (and, as with the batches above, within a
+// rounding step of the float mix).  What's left is flushed at the end of the
+// core's block.
+#define FILTER_BANKS (FILTER_LANE_BIQUAD_TWICE + 1)
+typedef struct {
+    uint8_t oscs;
+    uint16_t osc[FILTER_MAX_LANES];
+    filter_lane_t lane[FILTER_MAX_LANES];
+} filter_bank_t;
+
+static filter_bank_t filter_banks[AMY_MAX_CORES][FILTER_BANKS];
+static SAMPLE filter_bank_blocks[AMY_MAX_CORES][FILTER_BANKS][FILTER_MAX_LANES][AMY_BLOCK_SIZE];
+
+// Filtering done: what render_osc_wave and render_and_mix_osc still owe osc.
+static void filter_bank_finish_osc(uint16_t osc, uint8_t core, SAMPLE *block, SAMPLE max_val) {
+    if (synth[osc]->status != SYNTH_AUDIBLE) reset_filter(osc);  // (f)
+    stop_osc_if_silent(osc, max_val);
+    retire_osc_if_stopped(osc);
+    mix_with_pan(fbl[core][synth[osc]->bus], block, msynth[osc]->last_pan, msynth[osc]->pan, osc_output_level(osc));
+}
+
+static SAMPLE filter_bank_flush(uint8_t kind, uint8_t core) {
+    filter_bank_t *bank = &filter_banks[core][kind];
+    SAMPLE max_values[FILTER_MAX_LANES];
+    filter_lanes(kind, bank->lane, bank->oscs, max_values);
+    SAMPLE max_max = 0;
+    for (uint8_t k = 0; k < bank->oscs; ++k) {
+        filter_bank_finish_osc(bank->osc[k], core, bank->lane[k].block, max_values[k]);
+        if (max_values[k] > max_max) max_max = max_values[k];
+    }
+    bank->oscs = 0;
+    return max_max;
+}
+
+static SAMPLE filter_bank_flush_all(uint8_t core) {
+    SAMPLE max_max = 0;
+    for (uint8_t kind = FILTER_LANE_BIQUAD; kind < FILTER_BANKS; ++kind) {
+        if (filter_banks[core][kind].oscs == 0) continue;
+        SAMPLE max_val = filter_bank_flush(kind, core);
+        if (max_val > max_max) max_max = max_val;
+    }
+    return max_max;
+}
+
+// Take over rendering osc if its filter can go in a bank.  Returns the max
+// of any bank this filled and flushed, through *max_val.
+static bool filter_bank_add(uint16_t osc, uint8_t core, SAMPLE *max_val) {
+    struct synthinfo *s = synth[osc];
+    uint8_t type = s->filter_type;
+    if (!(type == FILTER_LPF || type == FILTER_LPF24 || type == FILTER_HPF
+          || type == FILTER_BPF || type == FILTER_NOTCH)) return false;
+    uint8_t width = filter_lane_width();
+    if (width == 0 || amy_global.config.amy_external_render_hook != NULL) return false;
+    // Any chain has to be rendered before the filter, not after it.
+    if (s->wave != SILENT && AMY_IS_SET(s->chained_osc)) return false;
+    if (s->render_clock == amy_global.total_samples) return false;
+    uint8_t kind = (type == FILTER_LPF24) ? FILTER_LANE_BIQUAD_TWICE : FILTER_LANE_BIQUAD;
+    filter_bank_t *bank = &filter_banks[core][kind];
+    SAMPLE *block = filter_bank_blocks[core][kind][bank->oscs];
+    bzero(block, AMY_BLOCK_SIZE * sizeof(SAMPLE));
+    SAMPLE unfiltered_max = render_osc_wave_unfiltered(osc, core, block, true);
+    *max_val = 0;
+    if (osc_filter_lane(osc, block, unfiltered_max, &bank->lane[bank->oscs]) == FILTER_LANE_NONE) {
+        // Silent in and silent filter: filter_process would leave the zero block alone.
+        filter_bank_finish_osc(osc, core, block, 0);
+        return true;
+    }
+    bank->osc[bank->oscs] = osc;
+    if (++bank->oscs == width) *max_val = filter_bank_flush(kind, core);
+    return true;
+}
+#endif
+
+// Render one osc, if it is audible, and mix it into fbl[core].  Returns its max.
+static AMY_IRAM_ATTR SAMPLE render_and_mix_osc(uint16_t osc, uint8_t core) {
+    if(synth[osc] == NULL || synth[osc]->status != SYNTH_AUDIBLE)  // skip oscs that are silent or mod sources from playback
+        return 0;
+#ifdef AMY_RENDER_LUT_SIMD
+    SAMPLE batch_max;
+    if (render_batch_add(osc, core, &batch_max) || filter_bank_add(osc, core, &batch_max))
+        return batch_max;
+#endif
+    uint16_t bus = synth[osc]->bus;
+    bzero(per_osc_fb[core][bus], AMY_BLOCK_SIZE * sizeof(SAMPLE));
+    SAMPLE max_val = render_osc_wave(osc, core, per_osc_fb[core][bus]);
+    retire_osc_if_stopped(osc);
+    uint8_t handled = 0;
+    if(amy_global.config.amy_external_render_hook != NULL) {
+        handled = amy_global.config.amy_external_render_hook(osc, per_osc_fb[core][bus], AMY_BLOCK_SIZE);
+    } else {
+        #ifdef __EMSCRIPTEN__
+        // Web version of the render hook: a JS function (in the same
+        // audio worklet as this module) may replace this osc's buffer,
+        // e.g. with a runtime-compiled user oscillator. Returns 1 if
+        // handled (osc skips the normal mix), like the native hook.
+        // JS can't reach msynth, so pass the osc's current pitch (as a
+        // phase increment in cycles/sample, tracking bend/portamento)
+        // and envelope level (0..1); Module is this AudioWorklet
+        // scope's instance. The pitch math only runs if the hook is
+        // installed (the typeof probe is cheap, every osc pays it).
+        if (EM_ASM_INT({ return typeof amy_render_js_hook === 'function' ? 1 : 0; })) {
+            handled = EM_ASM_INT({
+                // (see the bus postprocess hook about wasmMemory)
+                if (!Module.wasmMemory) Module.wasmMemory = wasmMemory;
+                return amy_render_js_hook($0, $1, $2, $3, $4, Module);
+            }, osc, per_osc_fb[core][bus], AMY_BLOCK_SIZE,
+               (double)(freq_of_logfreq(msynth[osc]->logfreq) / (float)AMY_SAMPLE_RATE),
+               (double)msynth[osc]->amp);
+        }
+        #endif
     }
+    // only mix the audio in if the external hook did not handle it
+    if(!handled) {
+        mix_with_pan(fbl[core][bus], per_osc_fb[core][bus], msynth[osc]->last_pan, msynth[osc]->pan, osc_output_level(osc));
+    }
+    return max_val;
+}
+
+// Finish a core's block: record its max, and on core 0 run the chorus LFOs.
+static void render_mix_end(uint8_t core, SAMPLE max_max) {
     core_max[core] = max_max;
 
     if(AMY_HAS_CHORUS && core == 0) {
@@ -2261,14 +2920,371 @@ AMY_IRAM_ATTR void amy_render(uint16_t start, uint16_t end, uint8_t core) {
         }
     }
 
-    if (amy_global.debug_flag) {
+    if (amy_global.debug_flag && core == 0) {
         amy_global.debug_flag = 0;  // Only do this once each time debug_flag is set.
         SAMPLE smax = scan_max(fbl[core][0 /* bus */], AMY_BLOCK_SIZE);
         fprintf(stderr, "time %" PRIu32 " core %d bus 0 max_max=%.3f post-eq max=%.3f\n", amy_global.total_samples, core, S2F(max_max), S2F(smax));
     }
+}
 
+AMY_IRAM_ATTR void amy_render(uint16_t start, uint16_t end, uint8_t core) {
+    AMY_PROFILE_START(AMY_RENDER)
+    render_mix_begin(core);
+    SAMPLE max_max = 0;
+    for(uint16_t osc = next_audible_osc(start, start, end); osc < end; osc = next_audible_osc(osc + 1, start, end)) {
+        SAMPLE max_val = render_and_mix_osc(osc, core);
+        if (max_val > max_max) max_max = max_val;
+    }
+#ifdef AMY_RENDER_LUT_SIMD
+    SAMPLE batch_max = render_batch_flush_all(core);
+    if (batch_max > max_max) max_max = batch_max;
+    batch_max = filter_bank_flush_all(core);
+    if (batch_max > max_max) max_max = batch_max;
+#endif
+    render_mix_end(core, max_max);
     AMY_PROFILE_STOP(AMY_RENDER)
+}
 
+// Multicore render plan.  Splitting the osc range by number (as amy_render's
+// start/end do) leaves one core idle when the sounding voices all sit in one
+// half, and can put a chained osc, a modulator or an ALGO operator on a
+// different core from the osc that renders it, so two cores advance the same
+// state.  Instead, each block, amy_render_plan groups the audible oscs into
+// units that must render together -- everything reachable through
+// chained_osc, mod_source, algo_source and partials, plus everything in the
+// same voice, plus every osc playing the same file preset (they take turns
+// at its one stream) -- and deals the units out to the cores largest-first,
+// each to the least-loaded core, using each unit's measured render time from
+// previous blocks.  Each core then renders its own list with
+// amy_render_units.  Within a unit, oscs render in osc order, as amy_render
+// would, and mixing is fixed-point addition, so the result is bit-identical
+// to a single-core render however the units are dealt (in fixed point; a
+// float mix can differ by rounding).
+//
+// The plan is dealt up front rather than stolen at run time so it needs no
+// atomics, which the RP2040 doesn't have.
+typedef struct {
+    uint32_t generation;   // Bumped per plan, so stale per-osc stamps read as unset.
+    uint8_t cores;         // How many cores this block's plan deals to; 1 means no plan.
+    // Indexed by osc.
+    uint32_t *linked;      // Plan generation the osc joined the union-find.
+    uint32_t *started;     // Plan generation the osc became a unit's root.
+    float *cost_us;        // Smoothed render time of the unit rooted here.
+    uint16_t *parent;      // Union-find; a unit's root is its lowest osc.
+    uint16_t *stack;       // Oscs still to follow links from.
+    uint16_t *next_member; // Next audible osc in the same unit, in osc order.
+    uint16_t *unit_of;     // A root's unit index.
+    // Indexed by unit.
+    uint16_t *unit_root;
+    uint16_t *unit_head;
+    uint16_t *unit_tail;
+    uint16_t *unit_members;
+    uint16_t *unit_order;  // Units, most expensive first.
+    uint16_t *unit_next;   // Next unit on the same core.
+    uint16_t core_first[AMY_MAX_CORES];
+} render_plan_t;
+
+static render_plan_t render_plan;
+
+static void render_plan_init() {
+    bzero(&render_plan, sizeof(render_plan));
+    render_plan.cores = 1;
+    if (AMY_CORES < 2) return;
+    size_t n = AMY_OSCS;
+    uint8_t *block = (uint8_t *)malloc_caps(n * (2 * sizeof(uint32_t) + sizeof(float) + 11 * sizeof(uint16_t)),
+                                            amy_global.config.ram_caps_synth);
+    if (block == NULL) {
+        // amy_render_plan falls back to rendering everything on core 0.
+        amy_oom("render plan for %d oscs", AMY_OSCS);
+        return;
+    }
+    bzero(block, n * (2 * sizeof(uint32_t) + sizeof(float)));
+    render_plan.linked = (uint32_t *)block;
+    render_plan.started = render_plan.linked + n;
+    render_plan.cost_us = (float *)(render_plan.started + n);
+    render_plan.parent = (uint16_t *)(render_plan.cost_us + n);
+    render_plan.stack = render_plan.parent + n;
+    render_plan.next_member = render_plan.stack + n;
+    render_plan.unit_of = render_plan.next_member + n;
+    render_plan.unit_root = render_plan.unit_of + n;
+    render_plan.unit_head = render_plan.unit_root + n;
+    render_plan.unit_tail = render_plan.unit_head + n;
+    render_plan.unit_members = render_plan.unit_tail + n;
+    render_plan.unit_order = render_plan.unit_members + n;
+    render_plan.unit_next = render_plan.unit_order + n;
+}
+
+static void render_plan_deinit() {
+    free(render_plan.linked);
+    bzero(&render_plan, sizeof(render_plan));
+}
+
+static uint16_t render_plan_find(uint16_t osc) {
+    uint16_t *parent = render_plan.parent;
+    while (parent[osc] != osc) {
+        parent[osc] = parent[parent[osc]];
+        osc = parent[osc];
+    }
+    return osc;
+}
+
+// Put target in the same unit as osc, and queue it to follow its own links.
+static void render_plan_link(uint16_t osc, int32_t target, uint16_t *depth) {
+    if (target < 0 || target >= AMY_OSCS) return;  // Unset, or a chorus LFO (core 0's).
+    if (render_plan.linked[target] != render_plan.generation) {
+        render_plan.linked[target] = render_plan.generation;
+        render_plan.parent[target] = (uint16_t)target;
+        render_plan.stack[(*depth)++] = (uint16_t)target;
+    }
+    uint16_t a = render_plan_find(osc), b = render_plan_find((uint16_t)target);
+    if (a < b) render_plan.parent[b] = a;
+    else if (b < a) render_plan.parent[a] = b;
+}
+
+// Oscs playing a file preset, one per preset: the first seen on it.
+#define RENDER_PLAN_FILE_PRESETS 16
+typedef struct {
+    uint16_t preset[RENDER_PLAN_FILE_PRESETS];
+    uint16_t osc[RENDER_PLAN_FILE_PRESETS];
+    uint8_t count;
+} render_plan_files_t;
+
+// Put osc in the same unit as the other oscs on its file preset, if it's
+// playing one.  Past RENDER_PLAN_FILE_PRESETS presets they all share one unit,
+// which is slower but still safe.
+static void render_plan_link_file(uint16_t osc, struct synthinfo *s, render_plan_files_t *files, uint16_t *depth) {
+    if (s->wave != PCM && s->wave != PCM_LEFT && s->wave != PCM_RIGHT) return;
+    if (!pcm_preset_is_file(s->preset)) return;
+    for (uint8_t i = 0; i < files->count; ++i) {
+        if (files->preset[i] == s->preset) {
+            render_plan_link(osc, files->osc[i], depth);
+            return;
+        }
+    }
+    if (files->count == RENDER_PLAN_FILE_PRESETS) {
+        render_plan_link(osc, files->osc[0], depth);
+        return;
+    }
+    files->preset[files->count] = s->preset;
+    files->osc[files->count++] = osc;
+}
+
+static int render_plan_cmp_cost(const void *a, const void *b) {
+    uint16_t ua = *(const uint16_t *)a, ub = *(const uint16_t *)b;
+    float ca = render_plan.cost_us[render_plan.unit_root[ua]];
+    float cb = render_plan.cost_us[render_plan.unit_root[ub]];
+    if (ca != cb) return (ca < cb) ? 1 : -1;
+    return (int)ua - (int)ub;
+}
+
+void amy_render_plan(uint8_t cores) {
+    AMY_PROFILE_START(AMY_RENDER_PLAN)
+    if (cores > AMY_CORES) cores = AMY_CORES;
+    if (render_plan.linked == NULL || cores < 2) {
+        render_plan.cores = 1;
+        AMY_PROFILE_STOP(AMY_RENDER_PLAN)
+        return;
+    }
+    render_plan.cores = cores;
+    uint32_t gen = ++render_plan.generation;
+    uint16_t num_units = 0;
+    render_plan_files_t files;
+    files.count = 0;
+    // Union each audible osc with everything it renders through.  Audible
+    // oscs are visited in osc order, which is also the order they join their
+    // units' member lists -- but a later osc can merge two units that were
+    // started separately, so the lists are built in a second pass.
+    for (uint16_t osc = next_audible_osc(0, 0, AMY_OSCS); osc < AMY_OSCS; osc = next_audible_osc(osc + 1, 0, AMY_OSCS)) {
+        uint16_t depth = 0;
+        if (render_plan.linked[osc] != gen) {
+            render_plan.linked[osc] = gen;
+            render_plan.parent[osc] = osc;
+            render_plan.stack[depth++] = osc;
+        }
+        while (depth > 0) {
+            uint16_t o = render_plan.stack[--depth];
+            struct synthinfo *s = synth[o];
+            if (s == NULL) continue;
+            if (AMY_IS_SET(s->chained_osc)) render_plan_link(o, s->chained_osc, &depth);
+            for (int i = 0; i < NUM_MOD_SOURCES; ++i)
+                if (AMY_IS_SET(s->mod_source[i])) render_plan_link(o, s->mod_source[i], &depth);
+            if (s->wave == ALGO)
+                for (int i = 0; i < MAX_ALGO_OPS; ++i)
+                    if (AMY_IS_SET(s->algo_source[i])) render_plan_link(o, s->algo_source[i], &depth);
+            if (s->wave == BYO_PARTIALS || s->wave == INTERP_PARTIALS)
+                for (int i = 1; i <= (int)s->last_two[0]; ++i) render_plan_link(o, o + i, &depth);
+            if (osc_to_voice != NULL && AMY_IS_SET(osc_to_voice[o]))
+                render_plan_link(o, voice_to_base_osc[osc_to_voice[o]], &depth);
+            render_plan_link_file(o, s, &files, &depth);
+        }
+    }
+    for (uint16_t osc = next_audible_osc(0, 0, AMY_OSCS); osc < AMY_OSCS; osc = next_audible_osc(osc + 1, 0, AMY_OSCS)) {
+        uint16_t root = render_plan_find(osc);
+        AMY_UNSET(render_plan.next_member[osc]);
+        if (render_plan.started[root] != gen) {
+            render_plan.started[root] = gen;
+            uint16_t u = num_units++;
+            render_plan.unit_of[root] = u;
+            render_plan.unit_root[u] = root;
+            render_plan.unit_head[u] = osc;
+            render_plan.unit_tail[u] = osc;
+            render_plan.unit_members[u] = 1;
+            render_plan.unit_order[u] = u;
+        } else {
+            uint16_t u = render_plan.unit_of[root];
+            render_plan.next_member[render_plan.unit_tail[u]] = osc;
+            render_plan.unit_tail[u] = osc;
+            render_plan.unit_members[u]++;
+        }
+    }
+    // Units not measured yet are costed at a microsecond an osc.
+    for (uint16_t u = 0; u < num_units; ++u)
+        if (render_plan.cost_us[render_plan.unit_root[u]] <= 0)
+            render_plan.cost_us[render_plan.unit_root[u]] = render_plan.unit_members[u];
+    qsort(render_plan.unit_order, num_units, sizeof(uint16_t), render_plan_cmp_cost);
+    // Deal largest-first, each to the least-loaded core.
+    float load[AMY_MAX_CORES];
+    for (uint8_t core = 0; core < cores; ++core) {
+        load[core] = 0;
+        AMY_UNSET(render_plan.core_first[core]);
+    }
+    for (uint16_t i = 0; i < num_units; ++i) {
+        uint16_t u = render_plan.unit_order[i];
+        uint8_t best = 0;
+        for (uint8_t core = 1; core < cores; ++core)
+            if (load[core] < load[best]) best = core;
+        load[best] += render_plan.cost_us[render_plan.unit_root[u]];
+        render_plan.unit_next[u] = render_plan.core_first[best];
+        render_plan.core_first[best] = u;
+    }
+    AMY_PROFILE_STOP(AMY_RENDER_PLAN)
+}
+
+// Render this core's share of the current plan into fbl[core].
+AMY_IRAM_ATTR void amy_render_units(uint8_t core) {
+    if (render_plan.cores < 2) {
+        // No plan: core 0 takes everything, any other core contributes silence.
+        if (core == 0) amy_render(0, AMY_OSCS, 0);
+        else amy_render(0, 0, core);
+        return;
+    }
+    AMY_PROFILE_START(AMY_RENDER)
+    render_mix_begin(core);
+    SAMPLE max_max = 0;
+    if (core < render_plan.cores) {
+        for (uint16_t u = render_plan.core_first[core]; AMY_IS_SET(u); u = render_plan.unit_next[u]) {
+            int64_t t0 = amy_get_us();
+            for (uint16_t osc = render_plan.unit_head[u]; AMY_IS_SET(osc); osc = render_plan.next_member[osc]) {
+                SAMPLE max_val = render_and_mix_osc(osc, core);
+                if (max_val > max_max) max_max = max_val;
+            }
+            // Only this core touches this unit's cost this block.
+            float *cost = &render_plan.cost_us[render_plan.unit_root[u]];
+            *cost += 0.25f * ((float)(amy_get_us() - t0) - *cost);
+            if (*cost < 0.1f) *cost = 0.1f;
+        }
+    }
+#ifdef AMY_RENDER_LUT_SIMD
+    SAMPLE batch_max = render_batch_flush_all(core);
+    if (batch_max > max_max) max_max = batch_max;
+    batch_max = filter_bank_flush_all(core);
+    if (batch_max > max_max) max_max = batch_max;
+#endif
+    render_mix_end(core, max_max);
+    AMY_PROFILE_STOP(AMY_RENDER)
+}
+
+#ifdef AMY_RENDER_THREADS
+// Desktop render pool.  amy_render_all plans the block on the calling thread,
+// then each worker renders its core's units into its own fbl[] block while
+// the caller renders core 0's (which also owns the chorus LFOs), and
+// amy_fill_buffer sums the blocks.  Workers sleep on a condition variable
+// between blocks.
+static pthread_t render_pool_threads[AMY_MAX_CORES];
+static pthread_mutex_t render_pool_lock;
+static pthread_cond_t render_pool_go;
+static pthread_cond_t render_pool_done;
+static uint32_t render_pool_generation = 0;
+static uint8_t render_pool_pending = 0;
+static uint8_t render_pool_quit = 0;
+// Workers actually running; the plan only deals to these and the caller.
+static uint8_t render_pool_workers = 0;
+
+static void *render_pool_worker(void *arg) {
+    uint8_t core = (uint8_t)(uintptr_t)arg;
+    uint32_t seen = 0;
+    pthread_mutex_lock(&render_pool_lock);
+    while (1) {
+        while (render_pool_generation == seen && !render_pool_quit)
+            pthread_cond_wait(&render_pool_go, &render_pool_lock);
+        if (render_pool_quit) break;
+        seen = render_pool_generation;
+        pthread_mutex_unlock(&render_pool_lock);
+        amy_render_units(core);
+        pthread_mutex_lock(&render_pool_lock);
+        if (--render_pool_pending == 0)
+            pthread_cond_signal(&render_pool_done);
+    }
+    pthread_mutex_unlock(&render_pool_lock);
+    return NULL;
+}
+
+static void render_pool_start() {
+    render_pool_quit = 0;
+    render_pool_pending = 0;
+    render_pool_generation = 0;
+    render_pool_workers = 0;
+    if (AMY_CORES < 2) return;
+    pthread_mutex_init(&render_pool_lock, NULL);
+    pthread_cond_init(&render_pool_go, NULL);
+    pthread_cond_init(&render_pool_done, NULL);
+    for (uint8_t core = 1; core < AMY_CORES; ++core) {
+        if (pthread_create(&render_pool_threads[core], NULL, render_pool_worker, (void *)(uintptr_t)core) != 0) {
+            fprintf(stderr, "render pool: only started %d of %d threads\n", core, AMY_CORES);
+            break;
+        }
+        render_pool_workers = core;
+    }
+}
+
+static void render_pool_stop() {
+    if (AMY_CORES < 2) return;
+    pthread_mutex_lock(&render_pool_lock);
+    render_pool_quit = 1;
+    pthread_cond_broadcast(&render_pool_go);
+    pthread_mutex_unlock(&render_pool_lock);
+    for (uint8_t core = 1; core <= render_pool_workers; ++core)
+        pthread_join(render_pool_threads[core], NULL);
+    render_pool_workers = 0;
+    pthread_cond_destroy(&render_pool_done);
+    pthread_cond_destroy(&render_pool_go);
+    pthread_mutex_destroy(&render_pool_lock);
+}
+#endif
+
+// Render every osc for this block, using whatever cores this build has.
+// Platforms that drive their own cores (i2s.c) plan and render units directly.
+void amy_render_all() {
+    #ifdef AMY_RENDER_THREADS
+    if (render_pool_workers > 0) {
+        amy_render_plan(render_pool_workers + 1);
+        pthread_mutex_lock(&render_pool_lock);
+        render_pool_pending = render_pool_workers;
+        render_pool_generation++;
+        pthread_cond_broadcast(&render_pool_go);
+        pthread_mutex_unlock(&render_pool_lock);
+        amy_render_units(0);
+        // A core whose worker failed to start still has a (silent) block to sum.
+        for (uint8_t core = render_pool_workers + 1; core < AMY_CORES; ++core)
+            amy_render_units(core);
+        pthread_mutex_lock(&render_pool_lock);
+        while (render_pool_pending > 0)
+            pthread_cond_wait(&render_pool_done, &render_pool_lock);
+        pthread_mutex_unlock(&render_pool_lock);
+        return;
+    }
+    #endif
+    amy_render(0, AMY_OSCS, 0);
 }
 
 
@@ -2277,20 +3293,31 @@ AMY_IRAM_ATTR void amy_render(uint16_t start, uint16_t end, uint8_t core) {
 // a patch load: events may arrive on any thread, and the sequencer tick
 // service is rendering-context-only (unguarded RMW on next_amy_tick_us, and
 // the external hook expects audio-thread context). Everything here is under
-// the queue lock - safe from any thread.
-static void flush_due_deltas() {
+// the queue lock - safe from any thread.  The render thread doesn't wait for
+// it: if another thread holds it (loading a patch, say), the due deltas are
+// left for the next block rather than stalling the audio callback.
+static void flush_due_deltas(bool wait) {
     // check to see which sounds to play
     uint32_t sysclock = amy_sysclock();
-    amy_grab_lock();
+    if (wait) {
+        // Settling the queue from a sending thread: whatever its batch holds
+        // would have been in it by now.
+        delta_batch_flush();
+        amy_grab_lock();
+    } else if (!amy_try_lock()) {
+        amy_global.deferred_flushes++;
+        return;
+    }
 
-    // find any deltas that need to be played from the (in-order) queue
-    struct delta *d = amy_global.delta_queue;
-    while(d && AMY_TIME_GEQ(sysclock, d->time)) {
+    // take in what's been added since the last block, then play the deltas
+    // that are due, in order
+    delta_ring_drain();
+    struct delta *d = delta_sched_take_due(sysclock);
+    while(d) {
         play_delta(d);
         d = delta_release(d);
         amy_global.delta_qsize--;
     }
-    amy_global.delta_queue = d;
 
     amy_release_lock();
 }
@@ -2300,10 +3327,12 @@ void amy_execute_deltas() {
     AMY_PROFILE_START(AMY_EXECUTE_DELTAS)
     // Advance the sequencer on AMY (sample) time and play any due sequence
     // events, so sequencing works in any rendering context, real-time or not.
+    amy_global.render_adding_events = true;
     sequencer_check_and_fill();
     // Make sure any CV-triggered events are added to delta queue
     update_external_cv_in();
-    flush_due_deltas();
+    amy_global.render_adding_events = false;
+    flush_due_deltas(false);
     AMY_PROFILE_STOP(AMY_EXECUTE_DELTAS)
 
 }
@@ -2335,19 +3364,14 @@ int16_t * amy_fill_buffer() {
     // amy_reset_sysclock().
     if (amy_global.reset_timebase_pending) {
         amy_grab_lock();
+        delta_ring_drain();
         // Rebase queued deltas onto the new timeline so their relative timing
         // survives the reset: a delta due 200 ms from now is still due 200 ms
         // from now, and one already due plays on this block.  (RESET_EVENTS is
         // the way to drop them instead.)  Doing this here rather than when the
         // reset was requested also covers deltas queued in between, which were
         // scheduled against the clock as it still read then.
-        uint32_t old_sysclock = (uint32_t)amy_sysclock64();
-        struct delta *d = amy_global.delta_queue;
-        while (d != NULL) {
-            if (AMY_TIME_GEQ(old_sysclock, d->time)) d->time = 0;
-            else d->time = d->time - old_sysclock;  // unsigned wrap keeps "in the future by k ms"
-            d = d->next;
-        }
+        delta_sched_rebase((uint32_t)amy_sysclock64());
         amy_global.total_blocks = 0;
         amy_global.total_samples = 0;
         amy_global.time = 0;
@@ -2369,11 +3393,11 @@ int16_t * amy_fill_buffer() {
 
     // mix results from both cores.
     //SAMPLE max_val = core_max[0];
-    #ifdef AMY_DUALCORE
-    for (int bus = 0; bus <= amy_global.highest_bus; ++bus)
-        for (int16_t i=0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  fbl[0][bus][i] += fbl[1][bus][i];
-    //    if (core_max[1] > max_val)  max_val = core_max[1];
-    #endif
+    for (int core = 1; core < AMY_CORES; ++core) {
+        for (int bus = 0; bus <= amy_global.highest_bus; ++bus)
+            for (int16_t i=0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  fbl[0][bus][i] += fbl[core][bus][i];
+        //    if (core_max[core] > max_val)  max_val = core_max[core];
+    }
     // Apply global processing only if there is some signal.
     //if (max_val > 0) {      // NO - see #629
         // apply the eq filters if there is some signal and EQ is non-default.
@@ -2549,7 +3573,7 @@ void amy_reset_sysclock() {
 
 struct delta *free_deltas_pool = NULL;
 
-#define MAX_DELTA_BLOCKS 16
+#define MAX_DELTA_BLOCKS 64
 struct delta *delta_blocks[MAX_DELTA_BLOCKS];
 int next_delta_block = 0;
 
@@ -2652,3 +3676,568 @@ int32_t delta_list_len(struct delta *d) {
 int32_t delta_num_free() {
     return delta_list_len(free_deltas_pool);
 }
+
+
+/// The delta scheduler
+//
+// Deltas bound for amy_global.delta_queue used to be insertion-sorted into
+// it, walking the list -- under the lock the render thread waits on -- for
+// each one, so loading patches for a big synth or scheduling a long sequence
+// went quadratic.  Now amy_global.delta_queue only holds deltas that are
+// already due (time before wheel.now), in time order, and the rest wait in a
+// hierarchical timing wheel.  A window at level k is DELTA_WHEEL_WINDOW^k ms,
+// and level k has a slot per window for two windows of level k + 1: the one
+// wheel.now is in and the next.  A delta goes in the lowest level that
+// reaches it; deltas further out than the top level reaches wait, sorted, on
+// the overflow list.
+//
+// A window's deltas have to move down a level before wheel.now enters it.
+// Doing that on entry meant a slot high up the wheel -- the next half-minute
+// of a long sequence, say -- was re-filed all at once inside one block.  So
+// each sync moves DELTA_WHEEL_CASCADE_BUDGET deltas per level out of the
+// window after wheel.now's, a whole window ahead, and entering a window only
+// finishes whatever of it is left: nothing, unless deltas for it arrive
+// faster than the budget moves them.  Each slot is a list in arrival order,
+// and a level 0 slot only ever holds one time.  A delta whose window is
+// still being moved down from a level above goes in behind the deltas
+// waiting there, so deltas for the same time still play in the order they
+// were added.
+
+#define DELTA_WHEEL_BITS 5
+#define DELTA_WHEEL_WINDOW (1 << DELTA_WHEEL_BITS)  // windows per window one level up
+#define DELTA_WHEEL_SLOTS (2 * DELTA_WHEEL_WINDOW)
+#define DELTA_WHEEL_LEVELS 5  // 2^25 ms, 9.3 hours; the overflow's windows are level DELTA_WHEEL_LEVELS
+#define DELTA_WHEEL_CASCADE_BUDGET 32  // deltas each level moves down ahead, per sync
+
+static struct {
+    uint32_t now;  // every delta timed before this is on amy_global.delta_queue
+    // Each slot is a circular list held by its last delta (whose next is the
+    // first), so appending, taking the first and taking the whole slot are
+    // all O(1).
+    struct delta *slot[DELTA_WHEEL_LEVELS][DELTA_WHEEL_SLOTS];
+    uint64_t occupied[DELTA_WHEEL_LEVELS];  // bit per nonempty slot
+    struct delta *overflow;
+    struct delta *due_tail;  // last delta on amy_global.delta_queue
+    uint32_t refiled;  // deltas moved down a level by the current sync
+} wheel;
+
+// time's window at level, and its slot there.
+#define WHEEL_WINDOW(time, level) ((time) >> (DELTA_WHEEL_BITS * (level)))
+#define WHEEL_INDEX(time, level) (WHEEL_WINDOW(time, level) & (DELTA_WHEEL_SLOTS - 1))
+
+// How many windows at level time's is past wheel.now's, across the clock's wrap.
+static inline uint32_t wheel_windows_ahead(uint32_t time, int level) {
+    return (WHEEL_WINDOW(time, level) - WHEEL_WINDOW(wheel.now, level)) & (UINT32_MAX >> (DELTA_WHEEL_BITS * level));
+}
+
+// The lowest level whose slots reach time (not before wheel.now); the
+// overflow is DELTA_WHEEL_LEVELS.
+static int delta_wheel_level(uint32_t time) {
+    int level = 0;
+    while (level < DELTA_WHEEL_LEVELS && wheel_windows_ahead(time, level + 1) > 1) ++level;
+    return level;
+}
+
+void delta_list_insert(struct delta **pptr, struct delta *d) {
+    while(*pptr && AMY_TIME_GEQ(d->time, (*pptr)->time))
+        pptr = &(*pptr)->next;
+    d->next = *pptr;
+    *pptr = d;
+}
+
+static void delta_due_append(struct delta *d) {
+    d->next = NULL;
+    if (wheel.due_tail) wheel.due_tail->next = d;
+    else amy_global.delta_queue = d;
+    wheel.due_tail = d;
+}
+
+// Put d where it waits for its time: on the due list if that's before
+// wheel.now, else at the lowest level that reaches it -- or, if deltas for
+// its window are still waiting to move down from a level above that (and
+// below `above`), in behind them.
+static void delta_wheel_place(struct delta *d, int above) {
+    if (!AMY_TIME_GEQ(d->time, wheel.now)) {
+        // Almost always at the end; otherwise sorted in, as the old queue was.
+        if (wheel.due_tail == NULL || AMY_TIME_GEQ(d->time, wheel.due_tail->time)) {
+            delta_due_append(d);
+        } else {
+            delta_list_insert(&amy_global.delta_queue, d);
+        }
+        return;
+    }
+    int level = delta_wheel_level(d->time);
+    for (int l = above - 1; l > level; --l) {
+        bool waiting = (l == DELTA_WHEEL_LEVELS)
+            ? (wheel.overflow != NULL && AMY_TIME_GEQ(d->time, wheel.overflow->time))
+            : (wheel.slot[l][WHEEL_INDEX(d->time, l)] != NULL);
+        if (waiting) {
+            level = l;
+            break;
+        }
+    }
+    if (level == DELTA_WHEEL_LEVELS) {
+        delta_list_insert(&wheel.overflow, d);
+        return;
+    }
+    uint32_t i = WHEEL_INDEX(d->time, level);
+    struct delta **tail = &wheel.slot[level][i];
+    if (*tail) {
+        d->next = (*tail)->next;
+        (*tail)->next = d;
+    } else {
+        d->next = d;
+        wheel.occupied[level] |= (uint64_t)1 << i;
+    }
+    *tail = d;
+}
+
+// Detach a slot's deltas, as a NULL-terminated list in arrival order.
+static struct delta *delta_wheel_take_slot(int level, uint32_t i) {
+    struct delta *tail = wheel.slot[level][i];
+    if (tail == NULL) return NULL;
+    struct delta *head = tail->next;
+    tail->next = NULL;
+    wheel.slot[level][i] = NULL;
+    wheel.occupied[level] &= ~((uint64_t)1 << i);
+    return head;
+}
+
+// Detach a slot's first delta.
+static struct delta *delta_wheel_take_first(int level, uint32_t i) {
+    struct delta *tail = wheel.slot[level][i];
+    if (tail == NULL) return NULL;
+    struct delta *head = tail->next;
+    if (head == tail) {
+        wheel.slot[level][i] = NULL;
+        wheel.occupied[level] &= ~((uint64_t)1 << i);
+    } else {
+        tail->next = head->next;
+    }
+    head->next = NULL;
+    return head;
+}
+
+static void delta_wheel_refile(struct delta *d, int from) {
+    while (d) {
+        struct delta *next = d->next;
+        delta_wheel_place(d, from);
+        wheel.refiled++;
+        d = next;
+    }
+}
+
+// wheel.now has just reached the start of a window at level 1 or up: move
+// down whatever is still waiting above the windows it has entered, top
+// level first.  delta_wheel_cascade_ahead has usually moved it all already.
+static void delta_wheel_enter(void) {
+    int top = 1;
+    while (top < DELTA_WHEEL_LEVELS && (wheel.now & ((1u << (DELTA_WHEEL_BITS * (top + 1))) - 1)) == 0) ++top;
+    if (top == DELTA_WHEEL_LEVELS) {
+        while (wheel.overflow && wheel_windows_ahead(wheel.overflow->time, DELTA_WHEEL_LEVELS) == 0) {
+            struct delta *d = wheel.overflow;
+            wheel.overflow = d->next;
+            d->next = NULL;
+            delta_wheel_refile(d, DELTA_WHEEL_LEVELS);
+        }
+    }
+    for (int level = MIN(top, DELTA_WHEEL_LEVELS - 1); level >= 1; --level)
+        delta_wheel_refile(delta_wheel_take_slot(level, WHEEL_INDEX(wheel.now, level)), level);
+}
+
+// Move up to DELTA_WHEEL_CASCADE_BUDGET deltas at each level out of the
+// window after wheel.now's, so they're down before wheel.now gets there.
+static void delta_wheel_cascade_ahead(void) {
+    for (int level = 1; level <= DELTA_WHEEL_LEVELS; ++level) {
+        for (int n = 0; n < DELTA_WHEEL_CASCADE_BUDGET; ++n) {
+            struct delta *d;
+            if (level == DELTA_WHEEL_LEVELS) {
+                d = wheel.overflow;
+                if (d == NULL || wheel_windows_ahead(d->time, level) > 1) break;
+                wheel.overflow = d->next;
+                d->next = NULL;
+            } else {
+                d = delta_wheel_take_first(level, (WHEEL_INDEX(wheel.now, level) + 1) & (DELTA_WHEEL_SLOTS - 1));
+                if (d == NULL) break;
+            }
+            delta_wheel_refile(d, level);
+        }
+    }
+}
+
+static inline uint64_t rotr64(uint64_t x, uint32_t r) {
+    return r ? (x >> r) | (x << (64 - r)) : x;
+}
+
+// The start of the first window at level (0: the first millisecond) holding
+// deltas, as an offset from wheel.now; false if there's none.
+static bool delta_wheel_first(int level, uint32_t *offset) {
+    if (level == DELTA_WHEEL_LEVELS) {
+        if (wheel.overflow == NULL) return false;
+        *offset = (WHEEL_WINDOW(wheel.overflow->time, level) << (DELTA_WHEEL_BITS * level)) - wheel.now;
+        return true;
+    }
+    if (wheel.occupied[level] == 0) return false;
+    // The slots run from the first window of wheel.now's window one level up.
+    uint32_t first = WHEEL_WINDOW(wheel.now, level + 1) << DELTA_WHEEL_BITS;
+    uint32_t k = __builtin_ctzll(rotr64(wheel.occupied[level], first & (DELTA_WHEEL_SLOTS - 1)));
+    *offset = ((first + k) << (DELTA_WHEEL_BITS * level)) - wheel.now;
+    return true;
+}
+
+// Move every delta due by sysclock onto the due list, in order, and bring
+// wheel.now up to sysclock + 1, entering on the way each window that still
+// has deltas waiting above it.  Empty stretches are skipped.
+static void delta_wheel_advance(uint32_t sysclock) {
+    for (;;) {
+        uint32_t limit = sysclock + 1 - wheel.now;
+        uint32_t enter = UINT32_MAX, offset;
+        for (int level = 1; level <= DELTA_WHEEL_LEVELS; ++level)
+            if (delta_wheel_first(level, &offset) && offset < enter) enter = offset;
+        if (delta_wheel_first(0, &offset) && offset < limit && offset < enter) {
+            uint32_t time = wheel.now + offset;
+            struct delta *d = delta_wheel_take_slot(0, WHEEL_INDEX(time, 0));
+            while (d) {
+                struct delta *next = d->next;
+                delta_due_append(d);
+                d = next;
+            }
+            wheel.now = time + 1;
+            if ((wheel.now & (DELTA_WHEEL_WINDOW - 1)) == 0) delta_wheel_enter();
+        } else if (enter <= limit) {
+            wheel.now += enter;
+            delta_wheel_enter();
+        } else {
+            break;
+        }
+    }
+    // Every window up to here is empty.
+    wheel.now = sysclock + 1;
+}
+
+// Everything waiting, due list included, as one list that keeps the order
+// deltas for each time were added in (the due list is first, and in time
+// order); the scheduler is left empty.
+static struct delta *delta_sched_take_all(void) {
+    struct delta *head = amy_global.delta_queue, **tail = &head;
+    while (*tail) tail = &(*tail)->next;
+    // Of one time's deltas, the ones lower down were added first.
+    for (int level = 0; level < DELTA_WHEEL_LEVELS; ++level) {
+        for (uint32_t i = 0; i < DELTA_WHEEL_SLOTS; ++i) {
+            *tail = delta_wheel_take_slot(level, i);
+            while (*tail) tail = &(*tail)->next;
+        }
+    }
+    *tail = wheel.overflow;
+    wheel.overflow = NULL;
+    amy_global.delta_queue = NULL;
+    wheel.due_tail = NULL;
+    return head;
+}
+
+static void delta_sched_place_all(struct delta *d) {
+    while (d) {
+        struct delta *next = d->next;
+        delta_wheel_place(d, DELTA_WHEEL_LEVELS + 1);
+        d = next;
+    }
+}
+
+// Bring the scheduler up to sysclock: deltas due by then onto the due list,
+// then the next windows' cascade ahead.  The clock only runs backwards when
+// something resets it under us (the test and benchmark programs do); then
+// everything is sorted out again from scratch, so the due list is still
+// exactly what's due.
+static void delta_sched_sync(uint32_t sysclock) {
+    wheel.refiled = 0;
+    if (AMY_TIME_GEQ(sysclock + 1, wheel.now)) {
+        delta_wheel_advance(sysclock);
+        delta_wheel_cascade_ahead();
+    } else {
+        struct delta *all = delta_sched_take_all();
+        wheel.now = sysclock + 1;
+        delta_sched_place_all(all);
+    }
+    if (wheel.refiled > amy_global.delta_refile_high_water)  amy_global.delta_refile_high_water = wheel.refiled;
+}
+
+void delta_sched_init(void) {
+    memset(&wheel, 0, sizeof(wheel));
+    wheel.now = amy_sysclock();
+    amy_global.delta_queue = NULL;
+    amy_global.delta_refile_high_water = 0;
+}
+
+// Placed against wheel.now as it stands: anything timed before it goes on
+// the due list, and the next sync sorts out a clock that has run backwards.
+// The wheel only moves when the due deltas are taken, so a producer thread
+// never does the render thread's cascading.
+void delta_sched_insert(struct delta *d) {
+    delta_wheel_place(d, DELTA_WHEEL_LEVELS + 1);
+}
+
+struct delta *delta_sched_take_due(uint32_t sysclock) {
+    delta_sched_sync(sysclock);
+    struct delta *due = amy_global.delta_queue;
+    amy_global.delta_queue = NULL;
+    wheel.due_tail = NULL;
+    return due;
+}
+
+void delta_sched_rebase(uint32_t old_sysclock) {
+    // Everything due by old_sysclock onto the due list first, in time order,
+    // since it's all re-timed to 0.
+    delta_sched_sync(old_sysclock);
+    struct delta *all = delta_sched_take_all();
+    for (struct delta *d = all; d != NULL; d = d->next) {
+        if (AMY_TIME_GEQ(old_sysclock, d->time)) d->time = 0;
+        else d->time = d->time - old_sysclock;  // unsigned wrap keeps "in the future by k ms"
+    }
+    wheel.now = 0;
+    delta_sched_place_all(all);
+}
+
+void delta_sched_release_all(void) {
+    delta_release_list(delta_sched_take_all());
+}
+
+int32_t delta_sched_len(void) {
+    struct delta *all = delta_sched_take_all();
+    int32_t len = delta_list_len(all);
+    // Putting them back keeps each time's deltas in order.
+    delta_sched_place_all(all);
+    return len;
+}
+
+
+/// The delta ring
+//
+// add_delta_to_queue used to take amy_queue_lock for every delta, so a burst
+// of messages from an API, MIDI or UI thread could hold the render thread up
+// in flush_due_deltas.  Now deltas bound for the global queue are copied onto
+// this bounded multi-producer ring without any lock, and whoever next plays
+// the queue -- flush_due_deltas, nearly always on the render thread --
+// drains them into the scheduler under the lock it already holds.  It's
+// Vyukov's bounded queue: each cell's seq says whose turn it is, so a
+// producer only has to win a compare-and-swap on the head to claim a cell,
+// and the one consumer (whoever holds the lock) needs no atomic
+// read-modify-write.  Deltas come off in the order their cells were claimed,
+// so one thread's deltas keep their order.  A producer that finds the ring
+// full drains it itself, under the lock, and tries again (see
+// add_delta_to_queue) -- back-pressure rather than a dropped note.
+
+#ifdef AMY_DELTA_RING
+
+#ifndef AMY_DELTA_RING_SIZE
+#define AMY_DELTA_RING_SIZE 1024  // must be a power of 2
+#endif
+
+typedef struct {
+    _Atomic uint32_t seq;  // pos when free for the producer at pos, pos + 1 once it holds that delta
+    struct delta d;
+} delta_ring_cell_t;
+
+static delta_ring_cell_t *delta_ring = NULL;
+static _Atomic uint32_t delta_ring_head;  // the next cell a producer claims
+static uint32_t delta_ring_tail;          // the next cell drained; only touched under the lock
+
+void delta_ring_init(void) {
+    if (delta_ring == NULL)
+        delta_ring = (delta_ring_cell_t *)malloc_caps(sizeof(delta_ring_cell_t) * AMY_DELTA_RING_SIZE,
+                                                      amy_global.config.ram_caps_events);
+    for (uint32_t i = 0; i < AMY_DELTA_RING_SIZE; ++i)
+        atomic_init(&delta_ring[i].seq, i);
+    atomic_init(&delta_ring_head, 0);
+    delta_ring_tail = 0;
+    amy_global.delta_ring_full = 0;
+    amy_global.delta_ring_dropped = 0;
+    amy_global.delta_ring_high_water = 0;
+    amy_global.deferred_flushes = 0;
+}
+
+void delta_ring_free(void) {
+    free(delta_ring);
+    delta_ring = NULL;
+}
+
+bool delta_ring_push(struct delta *d) {
+    uint32_t pos = atomic_load_explicit(&delta_ring_head, memory_order_relaxed);
+    for (;;) {
+        delta_ring_cell_t *cell = &delta_ring[pos & (AMY_DELTA_RING_SIZE - 1)];
+        int32_t turn = (int32_t)(atomic_load_explicit(&cell->seq, memory_order_acquire) - pos);
+        if (turn == 0) {
+            // Free for pos: claim it.  On failure, pos is the head another producer moved it to.
+            if (atomic_compare_exchange_weak_explicit(&delta_ring_head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                cell->d = *d;
+                cell->d.next = NULL;
+                atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+                return true;
+            }
+        } else if (turn < 0) {
+            return false;  // still holds the delta from a lap ago: full
+        } else {
+            pos = atomic_load_explicit(&delta_ring_head, memory_order_relaxed);
+        }
+    }
+}
+
+// Claims n cells at once, so they're drained together, in order.
+bool delta_ring_push_n(struct delta *d, uint32_t n) {
+    if (n == 0)  return true;
+    if (n > AMY_DELTA_RING_SIZE)  return false;
+    uint32_t pos = atomic_load_explicit(&delta_ring_head, memory_order_relaxed);
+    for (;;) {
+        // Cells are freed in order, so if the last of the n is free, they all are.
+        delta_ring_cell_t *last = &delta_ring[(pos + n - 1) & (AMY_DELTA_RING_SIZE - 1)];
+        int32_t turn = (int32_t)(atomic_load_explicit(&last->seq, memory_order_acquire) - (pos + n - 1));
+        if (turn == 0) {
+            if (atomic_compare_exchange_weak_explicit(&delta_ring_head, &pos, pos + n,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                for (uint32_t i = 0; i < n; ++i) {
+                    delta_ring_cell_t *cell = &delta_ring[(pos + i) & (AMY_DELTA_RING_SIZE - 1)];
+                    cell->d = d[i];
+                    cell->d.next = NULL;
+                    atomic_store_explicit(&cell->seq, pos + i + 1, memory_order_release);
+                }
+                return true;
+            }
+        } else if (turn < 0) {
+            return false;  // not n free
+        } else {
+            pos = atomic_load_explicit(&delta_ring_head, memory_order_relaxed);
+        }
+    }
+}
+
+uint32_t delta_ring_drain(void) {
+    uint32_t drained = 0;
+    for (;;) {
+        delta_ring_cell_t *cell = &delta_ring[delta_ring_tail & (AMY_DELTA_RING_SIZE - 1)];
+        // Stop at an empty cell, or one claimed but not yet written; what's
+        // behind it waits for the next drain.
+        if (atomic_load_explicit(&cell->seq, memory_order_acquire) != delta_ring_tail + 1)  break;
+        struct delta *d = delta_get(&cell->d);
+        atomic_store_explicit(&cell->seq, delta_ring_tail + AMY_DELTA_RING_SIZE, memory_order_release);
+        delta_ring_tail++;
+        if (d == NULL) {
+            // Pool couldn't grow.
+            amy_global.delta_ring_dropped++;
+            continue;
+        }
+        delta_sched_insert(d);
+        amy_global.delta_qsize++;
+        drained++;
+    }
+    if (drained > amy_global.delta_ring_high_water)  amy_global.delta_ring_high_water = drained;
+    return drained;
+}
+
+uint32_t delta_ring_len(void) {
+    return atomic_load_explicit(&delta_ring_head, memory_order_relaxed) - delta_ring_tail;
+}
+
+#else  // !AMY_DELTA_RING: add_delta_to_queue schedules under the lock directly.
+
+void delta_ring_init(void) {
+    amy_global.delta_ring_full = 0;
+    amy_global.delta_ring_dropped = 0;
+    amy_global.delta_ring_high_water = 0;
+    amy_global.deferred_flushes = 0;
+}
+void delta_ring_free(void) {}
+bool delta_ring_push(struct delta *d) { (void)d; return false; }
+bool delta_ring_push_n(struct delta *d, uint32_t n) { (void)d; (void)n; return false; }
+uint32_t delta_ring_drain(void) { return 0; }
+uint32_t delta_ring_len(void) { return 0; }
+
+#endif
+
+///////////////////////////////////////
+// The delta batch
+//
+// Hosts add a chord or a patch edit as dozens of events, and each of their
+// deltas went to the scheduler on its own: a claim on the delta ring (or a
+// turn at the lock) apiece.  amy_add_events and amy_add_messages open a
+// batch on their thread instead, and while it's open the deltas that thread
+// makes for the global queue are held in it.  When it fills or closes they're
+// sorted by time -- stably, so same-time deltas keep the order they were made
+// in -- and go in together: one claim of as many ring cells as there are
+// deltas or, if the ring hasn't that many free, one turn at the lock.
+// A batch has to play exactly as its events added one by one would, so
+// anything that settles the queue from the sending thread (a patch load's
+// flush_due_deltas) hands over what's held first, and emptying the queue
+// (amy_deltas_reset) drops it.
+
+#ifdef AMY_DELTA_BATCH
+
+static _Thread_local delta_batch_t *delta_batch = NULL;  // this thread's open batch
+
+bool delta_batch_begin(delta_batch_t *b) {
+    if (delta_batch != NULL)  return false;  // the one open already takes them
+    b->len = 0;
+    delta_batch = b;
+    return true;
+}
+
+static void delta_batch_send(delta_batch_t *b) {
+    uint32_t n = b->len;
+    struct delta *d = b->d;
+    b->len = 0;
+    if (n == 0)  return;
+    // Insertion sort: a batch is nearly always in time order already.
+    for (uint32_t i = 1; i < n; ++i) {
+        struct delta x = d[i];
+        uint32_t j = i;
+        for (; j > 0 && !AMY_TIME_GEQ(x.time, d[j - 1].time); --j)  d[j] = d[j - 1];
+        d[j] = x;
+    }
+    if (delta_ring_push_n(d, n))  return;
+    amy_grab_lock();
+#ifdef AMY_DELTA_RING
+    amy_global.delta_ring_full++;
+#endif
+    // Behind whatever's already in the ring, as one by one they would be.
+    delta_ring_drain();
+    for (uint32_t i = 0; i < n; ++i) {
+        struct delta *nd = delta_get(&d[i]);
+        if (nd == NULL)  continue;  // pool couldn't grow
+        delta_sched_insert(nd);
+        amy_global.delta_qsize++;
+    }
+    amy_release_lock();
+}
+
+void delta_batch_end(delta_batch_t *b) {
+    if (delta_batch != b)  return;
+    delta_batch_send(b);
+    delta_batch = NULL;
+}
+
+static bool delta_batch_add(struct delta *d) {
+    delta_batch_t *b = delta_batch;
+    if (b == NULL)  return false;
+    if (b->len == AMY_DELTA_BATCH_LEN)  delta_batch_send(b);
+    b->d[b->len] = *d;
+    b->d[b->len].next = NULL;
+    b->len++;
+    return true;
+}
+
+static void delta_batch_flush(void) {
+    if (delta_batch != NULL)  delta_batch_send(delta_batch);
+}
+
+static void delta_batch_discard(void) {
+    if (delta_batch != NULL)  delta_batch->len = 0;
+}
+
+#else  // !AMY_DELTA_BATCH: a batch's events are added one at a time.
+
+bool delta_batch_begin(delta_batch_t *b) { (void)b; return false; }
+void delta_batch_end(delta_batch_t *b) { (void)b; }
+static bool delta_batch_add(struct delta *d) { (void)d; return false; }
+static void delta_batch_flush(void) {}
+static void delta_batch_discard(void) {}
+
+#endif
@@ -23,6 +23,15 @@ static inline int __builtin_clz(unsigned int x) {
     unsigned long index;
     return _BitScanReverse(&index, x) ? (31 - (int)index) : 32;
 }
+static inline int __builtin_ctz(unsigned int x) {
+    unsigned long index;
+    return _BitScanForward(&index, x) ? (int)index : 32;
+}
+// From the two halves, as 32-bit targets have no _BitScanForward64.
+static inline int __builtin_ctzll(unsigned long long x) {
+    uint32_t low = (uint32_t)x;
+    return low ? __builtin_ctz(low) : 32 + __builtin_ctz((uint32_t)(x >> 32));
+}
 #else
 #include <unistd.h>
 #include <strings.h>  // POSIX-only (strcasecmp, bzero, ...); absent on MSVC, which uses the bzero/bcopy shims above
@@ -64,6 +73,18 @@ extern const uint16_t pcm_wavetable_base;
 extern const uint16_t pcm_wavetable_samples;
 extern const uint32_t pcm_wavetable_len;
 
+// Compressed PCM presets keep each sample as an 8-bit code, with one shift
+// per PCM_C8_BLOCK frames: the sample is code << shift (see pcm.c,
+// "Compressed presets").  The code and shift arrays run PCM_C8_PAD bytes
+// past their last frame's.
+#define PCM_C8_BLOCK 32
+#define PCM_C8_PAD 4
+// A ROM set amy.headers emitted compressed stores its first
+// pcm_c8_rom_samples presets (the drums, not the wavetables) that way.
+extern const uint16_t pcm_c8_rom_samples;
+extern const int8_t *const pcm_c8_rom_codes;
+extern const uint8_t *const pcm_c8_rom_shifts;
+
 #if (defined(ESP_PLATFORM) || defined(PICO_ON_DEVICE) || defined(ARDUINO) || defined(__IMXRT1062__) || defined(ARDUINO_ARCH_RP2040) ||defined(ARDUINO_ARCH_RP2350))
 #define AMY_MCU
 #endif
@@ -101,6 +122,7 @@ extern const uint32_t pcm_wavetable_len;
 #define AMY_PCM_TYPE_FILE 1
 #define AMY_PCM_TYPE_MEMORY 2
 #define AMY_PCM_TYPE_GAMMA 3
+#define AMY_PCM_TYPE_MAPPED 4
 
 #ifdef GAMMA9001
 // The Gamma9001 drum banks: presets GAMMA9001_PRESET_BASE and up, resolved
@@ -113,6 +135,12 @@ extern void amy_set_gamma9001_pcm(const int16_t * data);
 
 // File-streaming buffer size multiplier (in blocks).
 #define PCM_FILE_BUFFER_MULT 8
+// With a reader thread (AMY_PCM_STREAM_THREAD), how many of those buffers'
+// worth of frames it keeps read ahead of each streamed preset, and how many
+// of the file's first frames are read at load, to play from at note-on while
+// the thread seeks back to follow them.
+#define PCM_STREAM_RING_BUFFERS 4
+#define PCM_STREAM_HEAD_BUFFERS 2
 
 // Values used to indicate sampling source
 #define SAMPLE_FROM_OUTPUT 1
@@ -132,23 +160,72 @@ extern void amy_set_gamma9001_pcm(const int16_t * data);
 // How many external CV inputs to contemplate.
 #define AMY_MAX_CV_IN 2
 
-// Always use fixed point. You can remove this if you want float
+// SAMPLE arithmetic is s8.23 fixed point unless the build defines
+// AMY_USE_FLOAT, which makes SAMPLE and PHASOR plain float32 for hosts with
+// an FPU (`make float` builds it; see amy_fixedpoint.h).  It has its own
+// wavetable and filter vector kernels and the same cross-voice batching
+// (AMY_RENDER_LUT_SIMD below); only PCM playback stays sample by sample.
+// Fixed point is the reference: tests/ref was rendered with it, and the float
+// build is held to it by a tolerance instead (AMY_TEST_RELATIVE_DB in
+// amy/test.py).
+#ifndef AMY_USE_FLOAT
 #define AMY_USE_FIXEDPOINT
+#endif
 
 
 // upper bounds for static arrays.
-#define AMY_MAX_CORES 2          
 #define AMY_MAX_CHANNELS 2
 
 // Always use 2 channels. Clients that want mono can deinterleave
 #define AMY_NCHANS 2
 
-// Use dual cores on supported platforms
+// Use dual cores on supported platforms.  Desktop hosts instead spread
+// amy_render over a pool of pthreads, one mixing block per thread (see
+// render_pool_* in amy.c), config.render_threads of them up to
+// AMY_MAX_RENDER_THREADS, so there AMY_CORES is a runtime setting.  The
+// limits are the only numbers here, so amy/constants.py, which takes every
+// numeric #define in this file, gets one value for each whichever branch a
+// build takes.
+#define AMY_DUALCORE_CORES 2
+#define AMY_MAX_RENDER_THREADS 8
 #if (defined (ESP_PLATFORM) || defined (ARDUINO_ARCH_RP2040) ||defined(ARDUINO_ARCH_RP2350))
 #define AMY_DUALCORE
-#define AMY_CORES 2
+#define AMY_MAX_CORES AMY_DUALCORE_CORES
+#define AMY_CORES AMY_DUALCORE_CORES
+#else
+#if !defined(AMY_MCU) && !defined(AMY_DAISY) && !defined(__EMSCRIPTEN__) && defined(_POSIX_THREADS)
+#define AMY_RENDER_THREADS
+#define AMY_MAX_CORES AMY_MAX_RENDER_THREADS
 #else
-#define AMY_CORES 1
+#define AMY_MAX_CORES AMY_DUALCORE_CORES
+#endif
+// Single-core builds leave amy_global.render_cores at 1.
+#define AMY_CORES (amy_global.render_cores)
+#endif
+
+// The same hosts read disk samples (AMY_PCM_TYPE_FILE presets) ahead of the
+// render thread on a thread of their own, so a slow read can't stall a block
+// (see "Streaming from files" in pcm.c).  Elsewhere the render thread reads
+// them itself.
+#if defined(AMY_RENDER_THREADS) && !defined(__STDC_NO_ATOMICS__) && !defined(AMY_NO_PCM_STREAM_THREAD)
+#define AMY_PCM_STREAM_THREAD
+#endif
+
+// Desktop hosts with mmap can also play a WAV preset straight out of its file
+// (map_sample, 'zM'), with the page cache holding it instead of a copy in RAM.
+// WAV frames are little-endian, so they're only usable in place on a
+// little-endian host.  Elsewhere 'zM' streams the file, as 'zF' does.
+#if !defined(AMY_MCU) && !defined(AMY_DAISY) && !defined(__EMSCRIPTEN__) && defined(_POSIX_MAPPED_FILES) \
+    && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && !defined(AMY_NO_PCM_MMAP)
+#define AMY_PCM_MMAP
+#endif
+
+// Hosts where the render_lut kernels have vector versions (render_lut_simd.h),
+// and where same-wave oscs are batched across voices to use them.  Both
+// sample formats have them; the float build's run on float lanes.
+#if !defined(AMY_MCU) && (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__aarch64__)) && (AMY_BLOCK_SIZE % 8) == 0
+#define AMY_RENDER_LUT_SIMD
 #endif
 
 #define AMY_HAS_STARTUP_BLEEP (amy_global.config.features.startup_bleep)
@@ -292,6 +369,10 @@ enum coefs{
 
 #define MAX_MESSAGE_LEN 1024
 #define MAX_PARAM_LEN 256
+// Binary events (amy_event_to_binary, amy_add_binary_event): the format
+// version, its first byte, and the most bytes any event can encode to.
+#define AMY_BINARY_EVENT_VERSION 1
+#define AMY_BINARY_EVENT_MAX_LEN 1024
 // synth[].filter_type values
 #define FILTER_NONE 0
 #define FILTER_LPF 1
@@ -444,7 +525,7 @@ enum params{
     BP_START=ALGO_SOURCE_END + 1,        // 107..202
     BP_END=BP_START + (MAX_BREAKPOINT_SETS * MAX_BREAKPOINTS * 2), // 203
     EG0_TYPE, EG1_TYPE,                  // 204, 205
-    CLONE_OSC,                           // 206
+    CLONE_OSC,                           // 206: d->osc.. become copies of the voice at data.i & 0xffff (data.i >> 16 oscs); see clone_voice_oscs
     RESET_OSC,                           // 207
     FREE_OSC,                            // 208: like RESET_OSC, but returns the osc's storage to the heap
     NOTE_SOURCE_CHANNEL,                 // 209
@@ -477,9 +558,9 @@ enum params{
       
 enum itags{
     RENDER_OSC_WAVE, COMPUTE_BREAKPOINT_SCALE, HOLD_AND_MODIFY, FILTER_PROCESS, FILTER_PROCESS_STAGE0,
-    FILTER_PROCESS_STAGE1, DIST_PROCESS, ADD_DELTA_TO_QUEUE, AMY_ADD_DELTA, PLAY_DELTA,  MIX_WITH_PAN, AMY_RENDER, 
+    FILTER_PROCESS_STAGE1, DIST_PROCESS, ADD_DELTA_TO_QUEUE, AMY_ADD_DELTA, PLAY_DELTA,  MIX_WITH_PAN, AMY_RENDER, AMY_RENDER_PLAN,
     AMY_EXECUTE_DELTAS, AMY_FILL_BUFFER, RENDER_LUT_FM, RENDER_LUT_FB, RENDER_LUT, 
-    RENDER_LUT_CUB, RENDER_LUT_FM_FB, RENDER_LPF_LUT, DSPS_BIQUAD_F32_ANSI_SPLIT_FB, DSPS_BIQUAD_F32_ANSI_SPLIT_FB_TWICE, DSPS_BIQUAD_F32_ANSI_COMMUTED, 
+    RENDER_LUT_CUB, RENDER_LUT_FM_FB, RENDER_LUT_LANES, FILTER_LANES, RENDER_LPF_LUT, DSPS_BIQUAD_F32_ANSI_SPLIT_FB, DSPS_BIQUAD_F32_ANSI_SPLIT_FB_TWICE, DSPS_BIQUAD_F32_ANSI_COMMUTED, 
     PARAMETRIC_EQ_PROCESS, HPF_BUF, SCAN_MAX, DSPS_BIQUAD_F32_ANSI, BLOCK_NORM, CALIBRATE, AMY_ESP_FILL_BUFFER, NO_TAG
 };
 struct profile {
@@ -662,8 +743,82 @@ typedef struct amy_event {
     float reverb_liveness;
     float reverb_damping;
     float reverb_xover_hz;
+    uint32_t present;  // AMY_EV_ groups of fields that may be set (see below)
 } amy_event;
 
+// Which groups of an amy_event's fields are set, so that turning it into
+// deltas (amy_event_to_deltas_queue) only looks at those.  A note-on sets two
+// fields out of hundreds of values.  amy_clear_event() leaves every bit set --
+// "may be set, look" -- so events filled in by assigning fields directly work
+// as they always have.  amy_clear_event_sparse() clears them all, and from
+// then on every field must be set with AMY_EVENT_SET() (or AMY_EVENT_MARK()
+// after filling an array), as the parser does.  A bit only ever means "look";
+// the field's own unset value still says whether it's set.
+enum amy_event_groups {
+    AMY_EV_BUS_FX = 1 << 0,       // volume, eq, echo, chorus, reverb
+    AMY_EV_BUS = 1 << 1,
+    AMY_EV_WAVE = 1 << 2,         // wave, preset, mode
+    AMY_EV_NOTE = 1 << 3,
+    AMY_EV_VELOCITY = 1 << 4,
+    AMY_EV_AMP_COEFS = 1 << 5,
+    AMY_EV_FREQ_COEFS = 1 << 6,
+    AMY_EV_FILTER_FREQ_COEFS = 1 << 7,
+    AMY_EV_DUTY_COEFS = 1 << 8,
+    AMY_EV_PAN_COEFS = 1 << 9,
+    AMY_EV_OSC_PARAMS = 1 << 10,  // the other per-osc scalars
+    AMY_EV_DIST = 1 << 11,
+    AMY_EV_GLOBAL = 1 << 12,      // pitch_bend, tempo, latency_ms
+    AMY_EV_OSC_REFS = 1 << 13,    // chained_osc, mod_source, reset_osc
+    AMY_EV_ALGO_SOURCE = 1 << 14,
+    AMY_EV_EG0 = 1 << 15,
+    AMY_EV_EG1 = 1 << 16,
+    AMY_EV_SYNTH = 1 << 17,       // synth and the synth-layer ('i') fields
+    AMY_EV_PATCH = 1 << 18,
+    AMY_EV_TICKS = 1 << 19,
+};
+#define AMY_EV_ALL (~(uint32_t)0)
+
+// Each field's group.  time and osc are always looked at, so have none.
+#define AMY_EVENT_FIELD_GROUPS(X)                                               \
+    X(time, 0) X(osc, 0) X(wave, AMY_EV_WAVE) X(mode, AMY_EV_WAVE)             \
+    X(preset, AMY_EV_WAVE) X(midi_note, AMY_EV_NOTE) X(patch_number, AMY_EV_PATCH) \
+    X(amp_coefs, AMY_EV_AMP_COEFS) X(freq_coefs, AMY_EV_FREQ_COEFS)           \
+    X(filter_freq_coefs, AMY_EV_FILTER_FREQ_COEFS) X(duty_coefs, AMY_EV_DUTY_COEFS) \
+    X(pan_coefs, AMY_EV_PAN_COEFS) X(feedback, AMY_EV_OSC_PARAMS)             \
+    X(velocity, AMY_EV_VELOCITY) X(trigger_phase, AMY_EV_OSC_PARAMS)          \
+    X(sample_offset, AMY_EV_OSC_PARAMS) X(fit_ticks, AMY_EV_OSC_PARAMS)       \
+    X(fit_search, AMY_EV_OSC_PARAMS) X(volume, AMY_EV_BUS_FX)                 \
+    X(pitch_bend, AMY_EV_GLOBAL) X(tempo, AMY_EV_GLOBAL) X(latency_ms, AMY_EV_GLOBAL) \
+    X(ratio, AMY_EV_OSC_PARAMS) X(resonance, AMY_EV_OSC_PARAMS)               \
+    X(portamento_ms, AMY_EV_OSC_PARAMS) X(chained_osc, AMY_EV_OSC_REFS)       \
+    X(mod_source, AMY_EV_OSC_REFS) X(algorithm, AMY_EV_OSC_PARAMS)            \
+    X(filter_type, AMY_EV_OSC_PARAMS) X(dist_type, AMY_EV_DIST)               \
+    X(dist_drive, AMY_EV_DIST) X(dist_bits, AMY_EV_DIST) X(dist_rate, AMY_EV_DIST) \
+    X(dist_mix, AMY_EV_DIST) X(eq_l, AMY_EV_BUS_FX) X(eq_m, AMY_EV_BUS_FX)    \
+    X(eq_h, AMY_EV_BUS_FX) X(bp_is_set, AMY_EV_EG0 | AMY_EV_EG1)              \
+    X(algo_source, AMY_EV_ALGO_SOURCE) X(eg0_times, AMY_EV_EG0)               \
+    X(eg0_values, AMY_EV_EG0) X(eg1_times, AMY_EV_EG1) X(eg1_values, AMY_EV_EG1) \
+    X(eg_type, AMY_EV_OSC_PARAMS) X(synth, AMY_EV_SYNTH)                      \
+    X(synth_flags, AMY_EV_SYNTH) X(synth_level, AMY_EV_SYNTH)                 \
+    X(synth_delay_ms, AMY_EV_SYNTH) X(to_synth, AMY_EV_SYNTH)                 \
+    X(grab_midi_notes, AMY_EV_SYNTH) X(pedal, AMY_EV_SYNTH)                   \
+    X(num_voices, AMY_EV_SYNTH) X(oscs_per_voice, AMY_EV_SYNTH)               \
+    X(ticks, AMY_EV_TICKS) X(note_source_channel, AMY_EV_OSC_PARAMS)          \
+    X(reset_osc, AMY_EV_OSC_REFS) X(bus, AMY_EV_BUS)                          \
+    X(echo_level, AMY_EV_BUS_FX) X(echo_delay_ms, AMY_EV_BUS_FX)              \
+    X(echo_max_delay_ms, AMY_EV_BUS_FX) X(echo_feedback, AMY_EV_BUS_FX)       \
+    X(echo_filter_coef, AMY_EV_BUS_FX) X(chorus_level, AMY_EV_BUS_FX)         \
+    X(chorus_max_delay, AMY_EV_BUS_FX) X(chorus_lfo_freq, AMY_EV_BUS_FX)      \
+    X(chorus_depth, AMY_EV_BUS_FX) X(reverb_level, AMY_EV_BUS_FX)             \
+    X(reverb_liveness, AMY_EV_BUS_FX) X(reverb_damping, AMY_EV_BUS_FX)        \
+    X(reverb_xover_hz, AMY_EV_BUS_FX)
+
+#define _AMY_EV_GROUP_OF(FIELD, GROUP) AMY_EV_GROUP_OF_##FIELD = (GROUP),
+enum amy_event_field_groups { AMY_EVENT_FIELD_GROUPS(_AMY_EV_GROUP_OF) };
+
+#define AMY_EVENT_MARK(E, FIELD) ((E)->present |= (uint32_t)AMY_EV_GROUP_OF_##FIELD)
+#define AMY_EVENT_SET(E, FIELD, VAL) do { (E)->FIELD = (VAL); AMY_EVENT_MARK(E, FIELD); } while (0)
+
 // Distortion stage.  Split from synthinfo so the same shaper can run at any
 // summing scope: per-osc (timbral, inside the envelope/filter chain) and, on a
 // chained-osc head, per-voice.  Config is what the caller sets; state is what
@@ -707,48 +862,60 @@ typedef struct {
     } grain[PCM_STRETCH_GRAINS];
 } pcm_stretch_t;
 
-// This is the state of each oscillator, set by the sequencer from deltas
+// Where one of an osc's envelopes is, kept from block to block by
+// compute_breakpoint_scale (envelope.c) so that it only goes back to the
+// breakpoints when the envelope crosses into another segment.  Anything that
+// edits an osc's breakpoints has to call osc_envelope_changed.
+#define ENV_CURSOR_STALE (-2)
+typedef struct {
+    int8_t bp_r;      // the release breakpoint, -1 for none, ENV_CURSOR_STALE to rescan
+    int8_t seg;       // the segment below describes, -1 for none yet, bp_r once in sustain
+    uint8_t release;  // seg is the release, timed from note_off_clock
+    uint8_t k_kind;   // which curve k0, k1 are for, 0 for none
+    uint32_t clock;   // the note_on_clock (or note_off_clock) seg was found for
+    uint32_t t0, t1;  // seg's start and end, in samples from that clock
+    SAMPLE v0, v1;    // seg's start and end levels (v1 is the sustain level in sustain)
+    SAMPLE k_v0;      // the starting level k0, k1 were computed from
+    float k0, k1;     // the curve's constants: log2 of the end levels, or the DX7 attack's time constant and offset
+} env_cursor_t;
+
+// hold_and_modify's memory of the controls it last combined for an osc.  Each
+// coef vector only reads the ctrl_inputs its nonzero coefs select (its mask),
+// so an output is only combined again when one of those inputs has moved
+// since; in a steady sustain with no LFO, nothing is.  Anything that edits an
+// osc's coefs has to call osc_coefs_changed.
+enum ctrl_outputs { CTRL_LOGFREQ, CTRL_FILTER_LOGFREQ, CTRL_DUTY, CTRL_PAN, CTRL_AMP, NUM_CTRL_OUTPUTS };
+typedef struct {
+    uint8_t stale;                        // coefs edited: redo the masks and recombine everything
+    uint16_t mask[NUM_CTRL_OUTPUTS];      // bit i set if the coef vector reads ctrl_inputs[i]
+    float inputs[NUM_COMBO_COEFS];        // the ctrl_inputs logfreq..pan below were combined from
+    float amp_inputs[NUM_COMBO_COEFS];    // and the ones amp was (it's also combined at the block's end)
+    float combined[NUM_CTRL_OUTPUTS];     // the combined values, before portamento, clipping and slew
+} ctrl_cache_t;
+
+// This is the state of each oscillator, set by the sequencer from deltas.
+// Fields are grouped by how often rendering touches them.  The first group is
+// read or written for every audible osc on every block (render dispatch,
+// hold_and_modify, the envelopes, mod sources), so it goes first and packs
+// into as few cache lines as possible; with a thousand oscs playing, the
+// block's cost is largely how many lines of osc state it pulls in.  That
+// includes the envelope cursors and the combined controls, which stand in for
+// the breakpoints and most of the coef vectors from block to block; those are
+// only read again when a cursor crosses a segment or a control input moves,
+// so they follow the filter state, with config that only some waves or notes
+// read.
+// Feature state that most oscs never use is allocated when first needed.
 struct synthinfo {
-    uint16_t osc; // self-reference
-    // Configuration (can be fixed during oscillation)
-    uint16_t bus;  // Which bus this osc ends up on
+    // Per-block state (changes with time)
+    uint8_t status;  // not in event
+    uint8_t role;  // not in event
     uint16_t wave;
-    uint16_t mode;   // sub-mode within wave
-    int16_t preset;  // Negative preset is voice count for build-your-own PARTIALS
-    uint8_t s_note_source_channel;  // Was the most recent note on/off received from a MIDI channel?
-    float midi_note;
-    float velocity;
-    float amp_coefs[NUM_COMBO_COEFS];
-    float logfreq_coefs[NUM_COMBO_COEFS];
-    float filter_logfreq_coefs[NUM_COMBO_COEFS];
-    float duty_coefs[NUM_COMBO_COEFS];
-    float pan_coefs[NUM_COMBO_COEFS];
-    float feedback;
-    float trigger_phase;
-    uint16_t sample_offset;  // PCM note-on start offset in samples within its block
-    float fit_ticks;  // PCM fit target in sequencer ticks (0 = pitch-shift at original length)
-    uint16_t fit_search;  // PCM fit grain alignment search half-width in frames (0 = off)
-    float logratio;
-    float portamento_alpha;
-    float resonance;
+    uint16_t bus;  // Which bus this osc ends up on
     uint8_t filter_type;
-    // Distortion, applied pre-filter.  On a normal osc this is the per-osc
-    // timbral stage; on a SILENT chained-osc head it shapes the summed voice.
-    dist_config_t dist;
+    uint8_t terminate_on_silence;  // Usually yes, not for PCM. not in event.
     uint16_t chained_osc;
     uint16_t mod_source[NUM_MOD_SOURCES];
-    uint8_t algorithm;
-    int16_t algo_source[MAX_ALGO_OPS];  // int16 not uint because -1 specified to indicate no osc 
     uint8_t eg_type[MAX_BREAKPOINT_SETS];  // one of the ENVELOPE_ values
-    uint8_t max_num_breakpoints[MAX_BREAKPOINT_SETS];  // alloc'd length of breakpoint_times/vals
-    uint32_t *breakpoint_times[MAX_BREAKPOINT_SETS];  // (in samples) dynamically sized.
-    float *breakpoint_values[MAX_BREAKPOINT_SETS];  // dynamically sized.
-    // Per-note state (set on initialization, does not change during note)
-    uint8_t terminate_on_silence;  // Usually yes, not for PCM. not in event.
-    const LUT *lut;       // Selected lookup table and size.
-    // Per-block state (changes with time)
-    uint8_t status;  // not in event
-    uint8_t role;  // not in event
     PHASOR phase;  // not in event
     uint32_t render_clock;
     uint32_t note_on_clock;
@@ -756,15 +923,60 @@ struct synthinfo {
     uint32_t mod_value_clock;  // Only calculate mod_value once per frame (for mod_source).
     SAMPLE mod_value;  // last value returned by this oscillator when acting as a MOD_SOURCE, not in event
     SAMPLE last_scale[MAX_BREAKPOINT_SETS];  // remembers current envelope level, to use as start point in release.
-    SAMPLE last_two[2];    // For ALGO feedback ops
+    env_cursor_t env_cursor[MAX_BREAKPOINT_SETS];
+    ctrl_cache_t ctrl;
+    // Unlike the other coef vectors, amp's is read every block: its
+    // COEF_CONST gates rendering, and amp is recombined whenever an envelope
+    // moves.
+    float amp_coefs[NUM_COMBO_COEFS];
+    const LUT *lut;       // Selected lookup table and size.
+    float midi_note;
+    float velocity;
+    float portamento_alpha;
+    float resonance;
+    float feedback;
+    // Distortion, applied pre-filter.  On a normal osc this is the per-osc
+    // timbral stage; on a SILENT chained-osc head it shapes the summed voice.
+    dist_config_t dist;
     // For filters.  Need 2x because LPF24 uses two instances of filter.
     SAMPLE filter_delay[2 * FILT_NUM_DELAYS];
     // The block-floating-point shift of the filter delay values.
     int last_filt_norm_bits;
+    // The biquad last designed for this osc, and the filter_type,
+    // filter_logfreq and resonance it was designed for (see filters.c).
+    SAMPLE filter_coeffs[5];
+    float filter_coeffs_logfreq;
+    float filter_coeffs_resonance;
+    uint8_t filter_coeffs_type;  // FILTER_NONE when there's no design yet
+    // Read when an envelope cursor moves to another segment (envelope.c), or
+    // when hold_and_modify recombines a control.
+    uint8_t max_num_breakpoints[MAX_BREAKPOINT_SETS];  // alloc'd length of breakpoint_times/vals
+    uint32_t *breakpoint_times[MAX_BREAKPOINT_SETS];  // (in samples) dynamically sized.
+    float *breakpoint_values[MAX_BREAKPOINT_SETS];  // dynamically sized.
+    float logfreq_coefs[NUM_COMBO_COEFS];
+    float filter_logfreq_coefs[NUM_COMBO_COEFS];
+    float duty_coefs[NUM_COMBO_COEFS];
+    float pan_coefs[NUM_COMBO_COEFS];
+    // Configuration read by only some waves, or only at note on
+    uint16_t osc; // self-reference
+    uint16_t mode;   // sub-mode within wave
+    int16_t preset;  // Negative preset is voice count for build-your-own PARTIALS
+    uint8_t s_note_source_channel;  // Was the most recent note on/off received from a MIDI channel?
+    uint8_t algorithm;
+    int16_t algo_source[MAX_ALGO_OPS];  // int16 not uint because -1 specified to indicate no osc 
+    float trigger_phase;
+    float logratio;
+    uint16_t sample_offset;  // PCM note-on start offset in samples within its block
+    uint16_t fit_search;  // PCM fit grain alignment search half-width in frames (0 = off)
+    float fit_ticks;  // PCM fit target in sequencer ticks (0 = pitch-shift at original length)
+    SAMPLE last_two[2];    // For ALGO feedback ops
     // DIST_CRUSH sample-rate reducer state.
     dist_state_t dist_state;
-    // Granular time-stretch/pitch-shift state (PCM "fit", see pcm.c).
-    pcm_stretch_t stretch;
+    // Granular time-stretch/pitch-shift state (PCM "fit", see pcm.c).  NULL
+    // until the osc's first fit note allocates it from the osc arena; it then
+    // stays with the osc, moving with it when ensure_osc_allocd() grows it,
+    // until free_osc().
+    pcm_stretch_t *stretch;
 };
 
 // synthinfo, but only the things that mods/env can change. one per osc
@@ -854,10 +1066,19 @@ typedef struct  {
     // running echo and reverb), so this is worth turning down on small parts.
     uint16_t max_buses;
     uint8_t ks_oscs;
+    // How many threads render oscs on desktop (POSIX) hosts, including the
+    // one calling amy_render_all.  Only used when platform.multicore is set;
+    // capped at AMY_MAX_RENDER_THREADS.  MCU builds use their fixed AMY_CORES.
+    uint8_t render_threads;
     uint32_t max_sequencer_tags;
     uint32_t max_voices;
     uint32_t max_synths;
     uint32_t max_memory_patches;
+    // How many builtin patches to keep parsed into deltas, so loading one
+    // again (a program change) doesn't re-parse its string per voice.  Each
+    // costs 8 bytes per delta -- under 1 KB for a Juno or DX7 patch.  0 turns
+    // the cache off.
+    uint32_t max_cached_patches;
 
     // alternative audio output function
     size_t (*write_samples_fn)(const uint8_t *buffer, size_t buffer_size);
@@ -917,6 +1138,11 @@ typedef struct  {
     uint32_t ram_caps_fbl;
     uint32_t ram_caps_delay;
     uint32_t ram_caps_sample;
+    // Bytes of frames sample presets may hold in RAM between them; 0 is no
+    // limit.  Past it, presets read from a file (pcm_read_file) that aren't
+    // sounding are evicted, least recently played first, and read again, off
+    // the render thread, when next played.
+    uint32_t sample_ram_budget;
 
     // device ids for miniaudio platforms
     int8_t capture_device_id;
@@ -983,8 +1209,34 @@ typedef struct global_state {
     float *volume;  // Per-bus mix into the final output; max_buses entries.
     float pitch_bend;  // Legacy global pitch bend, will be subsumed per-synth (instrument).
     
-    uint16_t delta_qsize;
-    struct delta * delta_queue; // start of the sorted queue of deltas to execute.
+    uint32_t delta_qsize;
+    // The delta ring (amy.c): pushes that found it full and drained it
+    // themselves, deltas lost draining it because the pool couldn't grow,
+    // the most drained at once, and blocks the render thread left due deltas
+    // for because another thread held the lock.
+    uint32_t delta_ring_full;
+    uint32_t delta_ring_dropped;
+    uint32_t delta_ring_high_water;
+    uint32_t deferred_flushes;
+    // The most deltas the delta scheduler (amy.c) moved down its timing wheel
+    // in one block.
+    uint32_t delta_refile_high_water;
+    // Blocks a streamed file sample had to skip because its reader thread
+    // hadn't got far enough ahead (see "Streaming from files" in pcm.c).
+    uint32_t pcm_stream_underruns;
+    // The sample RAM budget (pcm.c): note-ons on presets read from a file
+    // that found their frames in RAM, and that didn't (and asked for them to
+    // be read again); presets evicted to make room; and the bytes of frames
+    // held now.
+    uint32_t pcm_cache_hits;
+    uint32_t pcm_cache_misses;
+    uint32_t pcm_cache_evictions;
+    uint32_t pcm_resident_bytes;
+    // Set while the render thread plays the sequencer's and CV inputs'
+    // events, which mustn't pick up the file reads amy_add_event otherwise
+    // does for it (pcm_service_reloads).
+    volatile bool render_adding_events;
+    struct delta * delta_queue; // deltas already due, in time order; the rest wait in the delta scheduler (amy.c).
     int16_t latency_ms;
     float tempo;
     uint32_t total_blocks;
@@ -994,6 +1246,8 @@ typedef struct global_state {
     // How many buses do we actually have to process?
     uint16_t highest_bus;
     SAMPLE hpf_state;
+    // How many mixing blocks (fbl[]) amy_render is spread across this run.
+    uint8_t render_cores;
     
     // Transfer
     uint8_t transfer_flag;
@@ -1057,6 +1311,7 @@ int8_t global_init(amy_config_t c);
 void global_deinit();
 void amy_grab_lock();
 void amy_release_lock();
+bool amy_try_lock();
 void amy_deltas_reset();
 void add_delta_to_queue(struct delta *d, struct delta **queue);
 void amy_add_event_internal(amy_event *e, uint16_t base_osc);
@@ -1070,6 +1325,9 @@ bool osc_ref_within_voice(int rel_osc, uint16_t oscs_per_voice, const char *what
 void amy_event_to_deltas_queue(amy_event *e, uint16_t base_osc, uint16_t oscs_per_voice, struct delta **queue);
 int web_audio_buffer(float *samples, int length);
 void amy_render(uint16_t start, uint16_t end, uint8_t core);
+void amy_render_plan(uint8_t cores);
+void amy_render_units(uint8_t core);
+void amy_render_all();
 void print_osc_debug(uint16_t i /* osc */, bool show_eg);
 void show_debug(uint8_t type) ;
 void oscs_deinit() ;
@@ -1109,6 +1367,10 @@ int8_t oscs_init();
 void alloc_osc(int osc, uint8_t *max_num_breakpoints_per_bpset_or_null);
 void free_osc(int osc);
 bool ensure_osc_allocd(int osc, uint8_t *max_num_breakpoints_per_bpset_or_null);
+void osc_arena_init(void);
+void osc_arena_deinit(void);
+void *osc_arena_alloc(uint32_t size);
+void osc_arena_free(void *block, uint32_t size);
 void patches_init(int max_memory_patches);
 void patches_deinit();
 void parse_algo_source(char* message, int16_t *vals);
@@ -1128,9 +1390,20 @@ void amy_play_message(char *message);
 // sysex source, so file transfer routing (transfer_flag) applies.
 void amy_send_wire_from_sysex(char *message);
 void amy_add_event(amy_event *e);
+// Several events, or several wire messages one per line, added as a batch:
+// as if added one by one, but their deltas reach the scheduler together.
+void amy_add_events(const amy_event *events, size_t n);
+void amy_add_messages(char *messages);
 size_t yield_event_from_message(char *message, amy_event *e, size_t pos);
 void handle_ticks_message(char *message);
+bool wire_message_parse_is_pure(const char *message);
 int amy_parse_message(char * message, amy_event *e);
+void handle_immediate_resets(amy_event *e);
+// Binary events: a compact encoding of amy_event (see parse.c).
+size_t amy_event_to_binary(amy_event *e, uint8_t *buf, size_t len);
+int amy_binary_to_event(const uint8_t *buf, size_t len, amy_event *e);
+int amy_add_binary_event(const uint8_t *buf, size_t len);
+int amy_add_binary_events(const uint8_t *buf, size_t len);
 void amy_start(amy_config_t);
 void amy_stop();
 
@@ -1143,6 +1416,7 @@ size_t amy_i2s_write(const uint8_t *buffer, size_t nbytes);  // in i2s.c
 
 amy_config_t amy_default_config();
 void amy_clear_event(amy_event *e);
+void amy_clear_event_sparse(amy_event *e);
 amy_event amy_default_event();
 uint32_t amy_sysclock();
 uint64_t amy_sysclock64();
@@ -1162,6 +1436,18 @@ float amy_get_render_load();
 // Runtime allocation failures since amy_start.  AMY degrades on OOM (silent
 // voice, dropped event) instead of crashing; hosts can poll this to detect it.
 uint32_t amy_get_oom_count();
+// Osc state (synthinfo, mod_synthinfo, breakpoints, PCM fit state) lives in
+// one arena sized from max_oscs at amy_start; see alloc_osc in amy.c.
+typedef struct {
+    uint32_t arena_bytes;   // Size of the arena (0 if it couldn't be allocated).
+    uint32_t used_bytes;    // In blocks currently handed out.
+    uint32_t carved_bytes;  // Ever handed to a size class, in use or on its free list.
+    uint32_t oscs;          // Oscs currently allocated from the arena.
+    uint32_t heap_blocks;   // Live blocks that didn't fit and came from the heap.
+} amy_osc_arena_stats_t;
+void amy_get_osc_arena_stats(amy_osc_arena_stats_t *stats);
+// Fraction of the osc arena in use (0..1).
+float amy_get_osc_arena_occupancy();
 int amy_get_output_buffer(output_sample_type * samples);
 int amy_get_input_buffer(output_sample_type * samples);
 void amy_set_external_input_buffer(output_sample_type * samples);
@@ -1212,6 +1498,7 @@ extern int parse_int_list_message32(char *message, int32_t *vals, int max_num_va
 extern int parse_int_list_message16(char *message, int16_t *vals, int max_num_vals, int16_t skipped_val);
 extern void reset_osc_by_pointer(struct synthinfo *psynth, struct mod_synthinfo *pmsynth);
 extern void reset_osc(uint16_t i );
+extern void osc_mark_audible(uint16_t osc);
 
 // Values for midi_mapping.type
 #define MIDI_MAP_TYPE_ANY (-1)
@@ -1268,6 +1555,24 @@ extern void set_cv_from_osc(int cv_channel, int osc);
 extern float render_am_lut(float * buf, float step, float skip, float incoming_amp, float ending_amp, const float* lut, int16_t lut_size, float *mod, float bandwidth);
 extern void ks_init();
 extern void ks_deinit();
+// Vector width of the render_lut kernels (see render_lut_simd.h).
+enum render_lut_simd_level { RENDER_LUT_SCALAR, RENDER_LUT_SIMD128, RENDER_LUT_SIMD256 };
+extern uint8_t render_lut_simd;
+extern void render_lut_simd_init(void);
+// One osc's block as the render_lut kernels see it, so oscs from different
+// voices can render in lockstep (render_lut_lanes).  The gains are the osc's
+// mix_with_pan ramp.
+typedef struct {
+    PHASOR phase, step;
+    SAMPLE incoming_amp, ending_amp;
+    SAMPLE gain_l, gain_r, d_gain_l, d_gain_r;
+} lut_lane_t;
+enum lut_lane_kind { LUT_LANE_NONE, LUT_LANE_SINE, LUT_LANE_LINEAR, LUT_LANE_CUBIC };
+#define RENDER_LUT_MAX_LANES 8
+extern uint8_t osc_lut_lane(uint16_t osc, const LUT **lut, lut_lane_t *lane);
+extern uint8_t render_lut_lane_width(void);
+extern void render_lut_lanes(uint8_t kind, const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values);
+extern void mix_lut_lanes(SAMPLE *stereo_dest, const SAMPLE *tile, const lut_lane_t *lanes);
 extern void algo_init();
 extern void algo_deinit();
 extern void pcm_init();
@@ -1322,12 +1627,17 @@ extern bool event_addresses_oscs(amy_event *e);
 // uint16_t, like every other voice index: a uint8_t here silently truncated
 // voice numbers once max_voices went over 255.
 extern uint16_t *osc_to_voice;
+extern uint16_t *voice_to_base_osc;
 
 extern struct delta **queue_for_patch_number(int patch_number);
 extern void update_num_oscs_for_patch_number(int patch_number);
 extern void all_notes_off();
 extern void patches_debug();
 extern void patches_store_patch(amy_event *e, char * message);
+extern void parse_patch_string_to_queue(char *message, int base_osc, uint16_t oscs_per_voice, struct delta **queue, uint8_t synth, uint32_t time, bool is_first_voice);
+// The deltas parse_patch_string_to_queue would make from builtin patch_number,
+// from the builtin patch cache.  false (and nothing queued) if it can't be cached.
+extern bool patches_builtin_to_queue(uint16_t patch_number, int base_osc, uint16_t oscs_per_voice, struct delta **queue, uint8_t synth, uint32_t time, bool is_first_voice);
 extern int instruments_max_instruments();
 extern void instruments_init(int num_instruments);
 extern void instruments_deinit();
@@ -1402,17 +1712,24 @@ extern void custom_mod_trigger(uint16_t osc);
 extern int16_t * pcm_load(uint16_t preset_number, uint32_t length, uint32_t samplerate, uint8_t channels, float midinote, uint32_t loopstart, uint32_t loopend);
 extern const int16_t *pcm_get_sample_ram_for_preset(uint16_t preset_number, uint32_t *length);
 extern int pcm_load_file();
+extern int pcm_map_file(uint16_t preset_number, const char *filename, float midinote);
+extern int pcm_read_file(uint16_t preset_number, const char *filename, float midinote);
+extern void pcm_service_reloads();
+extern int pcm_compress_preset(uint16_t preset_number);
 // Guard against configuring a PCM loop on a file-backed (streamed) preset,
 // which can never loop. Called with the PROPOSED mode and preset as each is
 // set; returns false if that command should be dropped (having warned).
 // mode_is_the_new_part picks which of the two the message blames.
 extern bool pcm_loop_config_allowed(uint16_t osc, uint16_t mode, uint16_t preset_number,
                                     bool mode_is_the_new_part);
+// True if the preset streams from a file (AMY_PCM_TYPE_FILE).
+extern bool pcm_preset_is_file(uint16_t preset_number);
 extern void pcm_unload_preset(uint16_t preset_number);
 extern void pcm_unload_all_presets();
 
 // filters
 extern void filters_init(uint16_t bus);
+extern void filter_coeff_tables_init(void);
 extern void filters_deinit(uint16_t bus);
 extern SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_value);
 extern SAMPLE dist_block(SAMPLE * block, uint16_t len,
@@ -1420,6 +1737,20 @@ extern SAMPLE dist_block(SAMPLE * block, uint16_t len,
 extern SAMPLE dist_process(SAMPLE * block, uint16_t osc);
 extern void parametric_eq_process(uint16_t bus, SAMPLE *block);
 extern void reset_filter(uint16_t osc);
+// One osc's filter_process biquad for a block, so the filters of oscs in
+// different voices can run in lockstep (filter_lanes).  state is the osc's
+// filter_delay; max_val is the block's max going in.
+typedef struct {
+    SAMPLE coeffs[5];
+    SAMPLE *block;
+    SAMPLE *state;
+    SAMPLE max_val;
+} filter_lane_t;
+enum filter_lane_kind { FILTER_LANE_NONE, FILTER_LANE_BIQUAD, FILTER_LANE_BIQUAD_TWICE };
+#define FILTER_MAX_LANES RENDER_LUT_MAX_LANES
+extern uint8_t filter_lane_width(void);
+extern uint8_t osc_filter_lane(uint16_t osc, SAMPLE *block, SAMPLE max_val, filter_lane_t *lane);
+extern void filter_lanes(uint8_t kind, filter_lane_t *lanes, uint8_t n, SAMPLE *max_values);
 extern void reset_parametric(uint16_t bus);
 extern float dsps_sqrtf_f32_ansi(float f);
 extern int8_t dsps_biquad_gen_lpf_f32(SAMPLE *coeffs, float f, float qFactor);
@@ -1448,6 +1779,14 @@ extern SAMPLE scan_max(SAMPLE* block, int len);
 
 // envelopes
 extern SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint16_t sample_offset);
+// Breakpoints in bp_set of psynth were edited; its envelope cursor rescans them.
+static inline void osc_envelope_changed(struct synthinfo *psynth, uint8_t bp_set) {
+    psynth->env_cursor[bp_set].bp_r = ENV_CURSOR_STALE;
+}
+// psynth's coefs were edited; hold_and_modify combines all its controls again.
+static inline void osc_coefs_changed(struct synthinfo *psynth) {
+    psynth->ctrl.stale = 1;
+}
 extern SAMPLE compute_mod_scale(uint16_t osc, uint16_t which_source);
 extern SAMPLE compute_mod_value(uint16_t mod_osc);
 extern void retrigger_mod_source(uint16_t osc);
@@ -1459,7 +1798,32 @@ extern struct delta *delta_get(struct delta *d);  // clone existing delta values
 extern struct delta *delta_release(struct delta *d);  // returns d->next of the node just released.
 extern void delta_release_list(struct delta *d);  // releases a whole list of deltas.
 extern int32_t delta_list_len(struct delta *d);
+extern void delta_list_insert(struct delta **list, struct delta *d);  // sorted by time, after any at the same time.
 extern int32_t delta_num_free();  // The size of the remaining pool.
+// The scheduler behind amy_global.delta_queue.  All under the amy lock.
+extern void delta_sched_init(void);
+extern void delta_sched_insert(struct delta *d);
+extern struct delta *delta_sched_take_due(uint32_t sysclock);  // the deltas due by sysclock, in order; the caller owns them.
+extern void delta_sched_rebase(uint32_t old_sysclock);  // re-time everything for the clock restarting from 0 at old_sysclock.
+extern void delta_sched_release_all(void);
+extern int32_t delta_sched_len(void);
+// The lock-free ring deltas for amy_global.delta_queue come in through.  Any
+// thread may push; draining (into the scheduler) is under the amy lock.
+extern void delta_ring_init(void);
+extern void delta_ring_free(void);
+extern bool delta_ring_push(struct delta *d);  // false if full.
+extern bool delta_ring_push_n(struct delta *d, uint32_t n);  // all n or none; false if there isn't room.
+extern uint32_t delta_ring_drain(void);  // returns how many went into the scheduler.
+extern uint32_t delta_ring_len(void);
+// A thread's deltas for amy_global.delta_queue, held back while a batch of
+// events is added (amy_add_events) and handed to the scheduler together.
+#define AMY_DELTA_BATCH_LEN (128)
+typedef struct delta_batch {
+    struct delta d[AMY_DELTA_BATCH_LEN];
+    uint32_t len;
+} delta_batch_t;
+extern bool delta_batch_begin(delta_batch_t *b);  // false if this thread already has one open.
+extern void delta_batch_end(delta_batch_t *b);  // hands over what it holds and closes it.
 
 extern int peek_stack(const char *tag);
 
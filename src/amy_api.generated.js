@@ -46,6 +46,9 @@ var AMY_KW_MAP = {
   load_sample: {wire: "z", type: "L"},
   transfer_file: {wire: "zT", type: "L"},
   disk_sample: {wire: "zF", type: "L"},
+  map_sample: {wire: "zM", type: "L"},
+  read_sample: {wire: "zR", type: "L"},
+  compress_sample: {wire: "zK", type: "I"},
   algorithm: {wire: "o", type: "I"},
   chorus: {wire: "k", type: "L"},
   reverb: {wire: "h", type: "L"},
@@ -121,36 +124,39 @@ var AMY_KW_PRIORITY = {
   load_sample: 39,
   transfer_file: 40,
   disk_sample: 41,
-  algorithm: 42,
-  chorus: 43,
-  reverb: 44,
-  echo: 45,
-  patch: 46,
-  external_channel: 47,
-  portamento: 48,
-  tempo: 49,
-  sequencer_run: 50,
-  external_midi_sync: 51,
-  synth: 52,
-  pedal: 53,
-  synth_flags: 54,
-  num_voices: 55,
-  oscs_per_voice: 56,
-  synth_level: 57,
-  to_synth: 58,
-  grab_midi_notes: 59,
-  note_source_channel: 60,
-  synth_delay: 61,
-  preset: 62,
-  num_partials: 63,
-  start_sample: 64,
-  stop_sample: 65,
-  bus: 66,
-  mode: 67,
-  midi_cc: 68,
-  midi_note_cmd: 69,
-  cv_trigger: 70,
-  patch_string: 71
+  map_sample: 42,
+  read_sample: 43,
+  compress_sample: 44,
+  algorithm: 45,
+  chorus: 46,
+  reverb: 47,
+  echo: 48,
+  patch: 49,
+  external_channel: 50,
+  portamento: 51,
+  tempo: 52,
+  sequencer_run: 53,
+  external_midi_sync: 54,
+  synth: 55,
+  pedal: 56,
+  synth_flags: 57,
+  num_voices: 58,
+  oscs_per_voice: 59,
+  synth_level: 60,
+  to_synth: 61,
+  grab_midi_notes: 62,
+  note_source_channel: 63,
+  synth_delay: 64,
+  preset: 65,
+  num_partials: 66,
+  start_sample: 67,
+  stop_sample: 68,
+  bus: 69,
+  mode: 70,
+  midi_cc: 71,
+  midi_note_cmd: 72,
+  cv_trigger: 73,
+  patch_string: 74
 };
 
 var AMY_COEF_FIELDS = ["const", "note", "vel", "eg0", "eg1", "mod0", "bend", "ext0", "ext1", "mod1"];
@@ -285,6 +291,8 @@ function amy_send(params, log) {
 
 // Constants from amy/constants.py (mirrors amy.SINE, amy.FILTER_LPF, etc.)
 var AMY = {
+  PCM_C8_BLOCK: 32,
+  PCM_C8_PAD: 4,
   MAX_FILENAME_LEN: 127,
   AMY_BLOCK_SIZE: 256,
   BLOCK_SIZE_BITS: 8,
@@ -298,16 +306,19 @@ var AMY = {
   AMY_PCM_TYPE_FILE: 1,
   AMY_PCM_TYPE_MEMORY: 2,
   AMY_PCM_TYPE_GAMMA: 3,
+  AMY_PCM_TYPE_MAPPED: 4,
   PCM_FILE_BUFFER_MULT: 8,
+  PCM_STREAM_RING_BUFFERS: 4,
+  PCM_STREAM_HEAD_BUFFERS: 2,
   SAMPLE_FROM_OUTPUT: 1,
   SAMPLE_FROM_AUDIO_IN: 2,
   AMY_DEFAULT_NUM_BUSES: 4,
   AMY_DEFAULT_BUS: 0,
   AMY_MAX_CV_IN: 2,
-  AMY_MAX_CORES: 2,
   AMY_MAX_CHANNELS: 2,
   AMY_NCHANS: 2,
-  AMY_CORES: 1,
+  AMY_DUALCORE_CORES: 2,
+  AMY_MAX_RENDER_THREADS: 8,
   AMY_MIDI_CHANNEL_DRUMS: 10,
   AMY_WIRE_COMMAND_LEN: 256,
   MALLOC_CAP_DEFAULT: 0,
@@ -350,6 +361,8 @@ var AMY = {
   NUM_COMBO_COEFS: 10,
   MAX_MESSAGE_LEN: 1024,
   MAX_PARAM_LEN: 256,
+  AMY_BINARY_EVENT_VERSION: 1,
+  AMY_BINARY_EVENT_MAX_LEN: 1024,
   FILTER_NONE: 0,
   FILTER_LPF: 1,
   FILTER_BPF: 2,
@@ -442,7 +455,8 @@ var AMY = {
   AMYBOARD_MIDI_IN: 21,
   AMY_AUDIO_DEVICE_OUT: 0,
   AMY_AUDIO_DEVICE_IN: 1,
-  AMY_NUM_MIDI_CHANNELS: 16
+  AMY_NUM_MIDI_CHANNELS: 16,
+  RENDER_LUT_MAX_LANES: 8
 };
 
 if (typeof globalThis !== "undefined") {
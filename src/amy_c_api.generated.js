@@ -17,10 +17,12 @@ function amy_c_api_bind(am) {
   }
   var api = {};
   api.send_wire = am.cwrap('amy_add_message', null, ['string']);
+  api.send_wires = am.cwrap('amy_add_messages', null, ['string']);
   api.send_wire_from_sysex = am.cwrap('amy_send_wire_from_sysex', null, ['string']);
   api.ticks_ms = am.cwrap('amy_sysclock', 'number', []);
   api.render_load = am.cwrap('amy_get_render_load', 'number', []);
   api.set_render_load_threshold = am.cwrap('amy_set_render_load_threshold', null, ['number']);
+  api.osc_arena_occupancy = am.cwrap('amy_get_osc_arena_occupancy', 'number', []);
   api._raw_bleep = am.cwrap('amy_bleep', null, ['number']);
   api.bleep = function(start) {
     if (start === undefined) start = 0;
@@ -84,4 +86,4 @@ function amy_c_api_bind(am) {
 }
 
 // Run this in MicroPython after registerJsModule("amy_c_api_js", api).
-var AMY_C_API_PY_INSTALL = 'import amy, tulip\nimport amy_c_api_js as _acj\namy._send_wire = _acj.send_wire\ntulip.amy_send = _acj.send_wire\namy._send_wire_from_sysex = _acj.send_wire_from_sysex\ntulip.amy_send_wire_from_sysex = _acj.send_wire_from_sysex\namy._ticks_ms = _acj.ticks_ms\ntulip.amy_ticks_ms = _acj.ticks_ms\namy._render_load = _acj.render_load\ntulip.amy_render_load = _acj.render_load\namy._set_render_load_threshold = _acj.set_render_load_threshold\ntulip.amy_set_render_load_threshold = _acj.set_render_load_threshold\namy._bleep = _acj.bleep\ntulip.amy_bleep = _acj.bleep\namy._sequencer_ticks = _acj.sequencer_ticks\ntulip.amy_sequencer_ticks = _acj.sequencer_ticks\namy._process_single_midi_byte = _acj.process_single_midi_byte\ntulip.amy_process_single_midi_byte = _acj.process_single_midi_byte\namy._set_cv_from_osc = _acj.set_cv_from_osc\ntulip.amy_set_cv_from_osc = _acj.set_cv_from_osc\namy._get_synth_commands = lambda synth, include_fx=True: [c for c in _acj.get_synth_commands(synth, include_fx).split(\'\\n\') if c]\ntulip.amy_get_synth_commands = amy._get_synth_commands\namy._dump_state = _acj.dump_state\ntulip.amy_dump_state = _acj.dump_state\namy._get_output_buffer = _acj.get_output_buffer\ntulip.amy_get_output_buffer = _acj.get_output_buffer\namy._get_input_buffer = _acj.get_input_buffer\ntulip.amy_get_input_buffer = _acj.get_input_buffer';
+var AMY_C_API_PY_INSTALL = 'import amy, tulip\nimport amy_c_api_js as _acj\namy._send_wire = _acj.send_wire\ntulip.amy_send = _acj.send_wire\namy._send_wires = _acj.send_wires\ntulip.amy_send_wires = _acj.send_wires\namy._send_wire_from_sysex = _acj.send_wire_from_sysex\ntulip.amy_send_wire_from_sysex = _acj.send_wire_from_sysex\namy._ticks_ms = _acj.ticks_ms\ntulip.amy_ticks_ms = _acj.ticks_ms\namy._render_load = _acj.render_load\ntulip.amy_render_load = _acj.render_load\namy._set_render_load_threshold = _acj.set_render_load_threshold\ntulip.amy_set_render_load_threshold = _acj.set_render_load_threshold\namy._osc_arena_occupancy = _acj.osc_arena_occupancy\ntulip.amy_osc_arena_occupancy = _acj.osc_arena_occupancy\namy._bleep = _acj.bleep\ntulip.amy_bleep = _acj.bleep\namy._sequencer_ticks = _acj.sequencer_ticks\ntulip.amy_sequencer_ticks = _acj.sequencer_ticks\namy._process_single_midi_byte = _acj.process_single_midi_byte\ntulip.amy_process_single_midi_byte = _acj.process_single_midi_byte\namy._set_cv_from_osc = _acj.set_cv_from_osc\ntulip.amy_set_cv_from_osc = _acj.set_cv_from_osc\namy._get_synth_commands = lambda synth, include_fx=True: [c for c in _acj.get_synth_commands(synth, include_fx).split(\'\\n\') if c]\ntulip.amy_get_synth_commands = amy._get_synth_commands\namy._dump_state = _acj.dump_state\ntulip.amy_dump_state = _acj.dump_state\namy._get_output_buffer = _acj.get_output_buffer\ntulip.amy_get_output_buffer = _acj.get_output_buffer\namy._get_input_buffer = _acj.get_input_buffer\ntulip.amy_get_input_buffer = _acj.get_input_buffer';
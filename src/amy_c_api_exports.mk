@@ -1,2 +1,2 @@
 # GENERATED by scripts/gen_amy_c_api.py -- do not edit; edit the table there
-AMY_C_API_EXPORTED_FUNCTIONS = '_amy_add_message', '_amy_send_wire_from_sysex', '_amy_sysclock', '_amy_get_render_load', '_amy_set_render_load_threshold', '_amy_bleep', '_sequencer_ticks', '_amy_process_single_midi_byte', '_set_cv_from_osc', '_yield_synth_commands', '_amy_dump_state_to_string', '_amy_get_output_buffer', '_amy_get_input_buffer'
+AMY_C_API_EXPORTED_FUNCTIONS = '_amy_add_message', '_amy_add_messages', '_amy_send_wire_from_sysex', '_amy_sysclock', '_amy_get_render_load', '_amy_set_render_load_threshold', '_amy_get_osc_arena_occupancy', '_amy_bleep', '_sequencer_ticks', '_amy_process_single_midi_byte', '_set_cv_from_osc', '_yield_synth_commands', '_amy_dump_state_to_string', '_amy_get_output_buffer', '_amy_get_input_buffer'
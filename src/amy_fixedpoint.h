@@ -107,6 +107,9 @@
 
 #define SHIFTR(s, b) ((s) * exp2f(-(b)))
 #define SHIFTL(s, b) ((s) * exp2f(b))
+// Magnitude, for peak tracking.  fabsf is a mask; the compare-and-negate the
+// fixed-point version uses is a branch on float, mispredicted on audio.
+#define S_ABS(s) fabsf(s)
 
 #define INT_OF_P(p, b) (((int)floorf((p) * (float)(1 << (b))) + (1 << (b))) % (1 <<(b)))
 #define I2P(i, b) ((i) / (float)(1 << (b)))
@@ -335,6 +338,7 @@ static inline SAMPLE SMULR7(SAMPLE a, SAMPLE b) {
 // Shifts
 #define SHIFTR(s, b) ((s) >> (b))
 #define SHIFTL(s, b) ((s) << (b))
+#define S_ABS(s) ((s) < 0 ? -(s) : (s))
 
 // Regard PHASOR as index into B-bit table, return integer (floor) index, strip sign bit.
 #define INT_OF_P(P, B) (int32_t)((((uint32_t)((P) << 1)) >> (P_FRAC_BITS + 1 - (B))))
@@ -34,6 +34,8 @@
 void convert_midi_bytes_to_messages(uint8_t * data, size_t len, uint8_t usb);
 void amy_process_single_midi_byte(uint8_t byte, uint8_t from_web_or_usb);
 void amy_external_midi_output(uint8_t * data, uint32_t len);
+void amy_received_control_change(uint8_t channel, uint8_t control, uint8_t value);
+void amy_received_program_change(uint8_t channel, uint8_t program);
 
 // Modes for amy_external_midi_sync() (wire command zC / external_midi_sync=).
 #define AMY_MIDI_SYNC_OFF 0     // internal clock; ignore and don't send realtime messages (default)
@@ -44,6 +44,8 @@ amy_config_t amy_default_config() {
     c.midi = AMY_MIDI_IS_NONE;
     c.audio = AMY_AUDIO_IS_NONE;
     c.ks_oscs = 1;
+    // Desktop render pool size; 1 renders everything on the calling thread.
+    c.render_threads = 1;
 
     c.max_oscs = 250;
     c.max_buses = AMY_DEFAULT_NUM_BUSES;
@@ -51,6 +53,7 @@ amy_config_t amy_default_config() {
     c.max_voices = 64;
     c.max_synths = 64;
     c.max_memory_patches = 32;
+    c.max_cached_patches = 16;
 
     // caps
     #if defined(TULIP) || defined(AMYBOARD) || defined(AMYBOARD_ARDUINO)
@@ -72,6 +75,7 @@ amy_config_t amy_default_config() {
     #endif    
     // Per-osc synth state follows the event pool unless a target overrides.
     c.ram_caps_oscs = c.ram_caps_events;
+    c.sample_ram_budget = 0;
 
     c.capture_device_id = -1;
     c.playback_device_id = -1;
@@ -200,6 +204,15 @@ void amy_clear_event(amy_event *e) {
     AMY_UNSET(e->reverb_damping);
     AMY_UNSET(e->reverb_xover_hz);
     AMY_UNSET(e->oscs_per_voice);
+    // Fields may be set directly after this, so every group has to be looked at.
+    e->present = AMY_EV_ALL;
+}
+
+// Clear an event that will only be filled in with AMY_EVENT_SET(), so turning
+// it into deltas can skip the groups of fields it never sets.
+void amy_clear_event_sparse(amy_event *e) {
+    amy_clear_event(e);
+    e->present = 0;
 }
 
 
@@ -239,7 +252,7 @@ void *amy_get_external_hook_context(void) {
 
 output_sample_type * amy_simple_fill_buffer() {
     amy_execute_deltas();
-    amy_render(0, AMY_OSCS, 0);
+    amy_render_all();
     return amy_fill_buffer();
 }
 
@@ -272,7 +285,7 @@ void amy_play_message(char *message) {
     amy_event e;
     size_t pos = 0;
     do {
-        amy_clear_event(&e);
+        amy_clear_event_sparse(&e);
         pos = yield_event_from_message(message, &e, pos);
         if (pos > 0) amy_add_event(&e);
     } while(pos > 0);
@@ -315,8 +328,12 @@ void amy_send_wire_from_sysex(char *message) {
 // diverts sequeuncer events, and handles special-case reset.
 void amy_add_event(amy_event *e) {
     peek_stack("add_event");
+    // Where there's no reader thread, the sending thread reads back evicted
+    // sample presets that note-ons have asked for.
+    pcm_service_reloads();
     // was amy_process_event
-    if(AMY_IS_SET(e->ticks[TICKS_TICK]) || AMY_IS_SET(e->ticks[TICKS_PERIOD]) || AMY_IS_SET(e->ticks[TICKS_TAG])) {
+    if((e->present & AMY_EV_TICKS) &&
+       (AMY_IS_SET(e->ticks[TICKS_TICK]) || AMY_IS_SET(e->ticks[TICKS_PERIOD]) || AMY_IS_SET(e->ticks[TICKS_TAG]))) {
         // C-API ticks event: serialize it to a wire message and hand it to
         // the sequencer, so scheduled events have a single storage format.
         char *buf = (char *)malloc_caps(MAX_MESSAGE_LEN, amy_global.config.ram_caps_events);
@@ -347,6 +364,97 @@ void amy_add_event(amy_event *e) {
     }
 }
 
+// given a binary event (see amy_event_to_binary) play / schedule it, as
+// amy_add_message does a wire string.  Returns the bytes it took up, so a
+// buffer of several can be walked, or -1 if it couldn't be read.
+int amy_add_binary_event(const uint8_t *buf, size_t len) {
+    peek_stack("add_binary_event");
+    amy_event e;
+    int used = amy_binary_to_event(buf, len, &e);
+    if (used < 0) {
+        fprintf(stderr, "binary event (version %d, %d bytes) could not be read\n",
+                len > 0 ? buf[0] : -1, (int)len);
+        return -1;
+    }
+    handle_immediate_resets(&e);
+    amy_add_event(&e);
+    return used;
+}
+
+// Open a delta batch (see "The delta batch" in amy.c) for the amy_add_*s
+// calls below.  NULL if this thread is already in one -- their deltas go to
+// that -- or there's no memory for one, when they go in one at a time, which
+// only costs time.
+static delta_batch_t *open_batch(void) {
+    delta_batch_t *b = (delta_batch_t *)malloc_caps(sizeof(delta_batch_t), amy_global.config.ram_caps_events);
+    if (b != NULL && !delta_batch_begin(b)) {
+        free(b);
+        b = NULL;
+    }
+    return b;
+}
+
+static void close_batch(delta_batch_t *b) {
+    if (b == NULL)  return;
+    delta_batch_end(b);
+    free(b);
+}
+
+// given n events, play / schedule each as amy_add_event would, as a batch.
+void amy_add_events(const amy_event *events, size_t n) {
+    peek_stack("add_events");
+    delta_batch_t *batch = open_batch();
+    for (size_t i = 0; i < n; ++i) {
+        amy_event e = events[i];  // amy_add_event fills in its time
+        amy_add_event(&e);
+    }
+    close_batch(batch);
+}
+
+// given wire messages, one per line, play / schedule each as amy_add_message
+// would, as a batch.
+void amy_add_messages(char *messages) {
+    peek_stack("add_messages");
+    delta_batch_t *batch = open_batch();
+    char message[MAX_MESSAGE_LEN];
+    const char *p = messages;
+    while (*p) {
+        const char *eol = strchr(p, '\n');
+        size_t len = eol ? (size_t)(eol - p) : strlen(p);
+        if (len >= MAX_MESSAGE_LEN) {
+            fprintf(stderr, "amy_add_messages: %d-char message is too long, skipped\n", (int)len);
+        } else if (len > 0) {
+            // A copy: messages may be read-only, and amy_add_message wants it terminated.
+            memcpy(message, p, len);
+            message[len] = '\0';
+            amy_add_message(message);
+        }
+        p += len + (eol ? 1 : 0);
+    }
+    close_batch(batch);
+}
+
+// given a buffer of binary events back to back, play / schedule each as
+// amy_add_binary_event would, as a batch.  Returns how many there were, or -1
+// if one couldn't be read (those before it are still added).
+int amy_add_binary_events(const uint8_t *buf, size_t len) {
+    peek_stack("add_binary_events");
+    delta_batch_t *batch = open_batch();
+    int events = 0;
+    size_t pos = 0;
+    while (pos < len) {
+        int used = amy_add_binary_event(buf + pos, len - pos);
+        if (used < 0) {
+            events = -1;
+            break;
+        }
+        pos += used;
+        events++;
+    }
+    close_batch(batch);
+    return events;
+}
+
 // defined in midi_mappings.c
 extern void juno_filter_midi_handler(uint8_t * bytes, uint16_t len, uint8_t is_sysex);
 #ifdef __EMSCRIPTEN__
@@ -202,6 +202,7 @@ void set_cv_from_osc(int cv_channel, int osc) {
     synth[osc]->logfreq_coefs[COEF_BEND] = 0;
     synth[osc]->amp_coefs[COEF_VEL] = 0;
     synth[osc]->amp_coefs[COEF_EG0] = 0;
+    osc_coefs_changed(synth[osc]);
     synth[osc]->note_on_clock = amy_global.total_blocks * AMY_BLOCK_SIZE;  // Need a note_on_clock to have envelope work correctly.. not that we care about envelope
     osc_note_on(osc, freq_of_logfreq(synth[osc]->logfreq_coefs[COEF_CONST]));
     // Add the CV retrieval hook.
@@ -86,8 +86,17 @@ void free_delay_line(delay_line_t *delay_line) {
 
 static SAMPLE FRACTIONAL_SAMPLE(PHASOR phase, const SAMPLE *delay, int index_mask, int index_bits) {
     // Interpolated sample copied from oscillators.c:render_lut
+#ifdef AMY_USE_FIXEDPOINT
     uint32_t base_index = INT_OF_P(phase, index_bits);
     SAMPLE frac = S_FRAC_OF_P(phase, index_bits);
+#else
+    // As the float render_lut does it: one truncating floor gives both, where
+    // INT_OF_P and S_FRAC_OF_P take a floorf each and a modulo.
+    float pos = phase * (float)(1 << index_bits);
+    int32_t pos_floor = (int32_t)pos - (pos < (float)(int32_t)pos);
+    uint32_t base_index = pos_floor & index_mask;
+    SAMPLE frac = pos - (float)pos_floor;
+#endif
     SAMPLE b = delay[base_index];
     SAMPLE c = delay[(base_index + 1) & index_mask];
     // linear interpolation.
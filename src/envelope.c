@@ -54,17 +54,69 @@ AMY_IRAM_ATTR SAMPLE compute_mod_scale(uint16_t osc, uint16_t which_source) {
     return 0; // 0 is no change, unlike bp scale
 }
 
+// Count bp_set's breakpoints again after an edit.  The cursor starts over.
+static void env_cursor_rescan(struct synthinfo *psynth, uint8_t bp_set) {
+    env_cursor_t *c = &psynth->env_cursor[bp_set];
+    c->bp_r = -1;
+    for(int i = 0; i < psynth->max_num_breakpoints[bp_set]; ++i) {
+        if (!AMY_IS_SET(psynth->breakpoint_times[bp_set][i]))
+            break;
+        c->bp_r = i;  // Last good segment.
+    }
+    c->seg = -1;
+}
+
+// Move the cursor to the note-on segment elapsed falls in, or to sustain
+// (seg == bp_r) past them all.  Segments are found walking forward from
+// wherever the cursor was, since elapsed only goes forward within a note.
+static void env_cursor_seek(struct synthinfo *psynth, uint8_t bp_set, uint32_t elapsed) {
+    env_cursor_t *c = &psynth->env_cursor[bp_set];
+    const uint32_t *times = psynth->breakpoint_times[bp_set];
+    if (c->release || c->seg < 0 || c->clock != psynth->note_on_clock || elapsed < c->t0) {
+        c->release = 0;
+        c->clock = psynth->note_on_clock;
+        c->seg = 0;
+        c->t0 = 0;
+        c->t1 = times[0];
+    } else if (c->seg == c->bp_r || elapsed < c->t1) {
+        return;  // Still there.
+    }
+    while (c->seg < c->bp_r && elapsed >= c->t1) {
+        c->t0 = c->t1;
+        ++c->seg;
+        c->t1 += times[c->seg];
+    }
+    // In sustain, v1 is the level of the segment before release.
+    c->v0 = (c->seg > 0 && c->seg < c->bp_r) ? F2S(psynth->breakpoint_values[bp_set][c->seg - 1]) : 0;
+    c->v1 = F2S(psynth->breakpoint_values[bp_set][c->seg < c->bp_r ? c->seg : c->bp_r - 1]);
+    c->k_kind = 0;
+}
+
+// Move the cursor to the release segment of the note off at note_off_clock.
+static void env_cursor_release(struct synthinfo *psynth, uint8_t bp_set) {
+    env_cursor_t *c = &psynth->env_cursor[bp_set];
+    if (c->release && c->clock == psynth->note_off_clock)
+        return;
+    c->release = 1;
+    c->clock = psynth->note_off_clock;
+    c->seg = c->bp_r;
+    c->t0 = 0;  // start the elapsed clock again
+    c->t1 = psynth->breakpoint_times[bp_set][c->bp_r];
+    c->v1 = F2S(psynth->breakpoint_values[bp_set][c->bp_r]);
+    c->k_kind = 0;
+}
+
 // sample_offset allows you to probe the EG output at some point this many samples into the future.
+// The breakpoints are only read when the envelope moves into another segment
+// (see env_cursor_t); within one, the cursor has its times, levels and curve
+// constants.
 AMY_IRAM_ATTR SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint16_t sample_offset) {
     AMY_PROFILE_START(COMPUTE_BREAKPOINT_SCALE)
-    // given a breakpoint list, compute the scale
-    // we first see how many BPs are defined, and where we are in them?
-    int8_t found = -1;
+    struct synthinfo *psynth = synth[osc];
+    env_cursor_t *c = &psynth->env_cursor[bp_set];
     int8_t release = 0;
     uint32_t t1 = 0, t0 = 0;
     SAMPLE v1 = 0, v0 = 0;
-    int8_t bp_r = 0;
-    t0 = 0; v0 = 0;
     // exp2(4.328085) = exp(3.0)
     #define EXP_RATE_VAL -4.328085f
     const SAMPLE exponential_rate = F2S(EXP_RATE_VAL);
@@ -72,79 +124,57 @@ AMY_IRAM_ATTR SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint
     const SAMPLE exponential_rate_overshoot_factor = F2S(1.0f / (1.0f - exp2f(EXP_RATE_VAL)));
     uint32_t elapsed = 0;    
     SAMPLE scale = F2S(1.0f);
-    int eg_type = synth[osc]->eg_type[bp_set];
-    uint32_t bp_end_times[MAX_BREAKPOINTS];
-    uint32_t cumulated_time = 0;
+    int eg_type = psynth->eg_type[bp_set];
     int sign = 1;
 
-    // Scan breakpoints to find which one is release (the last one)
-    bp_r = -1;
-    for(int i = 0; i < synth[osc]->max_num_breakpoints[bp_set]; ++i) {
-        uint32_t this_seg_time = synth[osc]->breakpoint_times[bp_set][i];
-        if (!AMY_IS_SET(this_seg_time))
-            break;
-        bp_r = i;  // Last good segment.
-        cumulated_time +=  this_seg_time;
-        bp_end_times[i] = cumulated_time;
-    }
-    if(bp_r < 0) {
+    if (c->bp_r == ENV_CURSOR_STALE)
+        env_cursor_rescan(psynth, bp_set);
+    if(c->bp_r < 0) {
         // no breakpoints, return key gate.
         // Change: Now an empty env reads as 1.0 *all the time*.
         // If you want a key gate, define bpX='0,1,0,1,0,0' (or maybe just '0,1,0,0').
         //if(AMY_IS_SET(synth[osc]->note_off_clock)) scale = 0;
-        synth[osc]->last_scale[bp_set] = scale;
+        psynth->last_scale[bp_set] = scale;
         //return scale;
         goto return_label;
     }
-    // Fix up bp_end_times for release segment to be relative to note-off time.
-    bp_end_times[bp_r] = synth[osc]->breakpoint_times[bp_set][bp_r];
 
     // Find out which BP we're in
-    if(AMY_IS_SET(synth[osc]->note_on_clock)) {
-        elapsed = (amy_global.total_blocks*AMY_BLOCK_SIZE - synth[osc]->note_on_clock + sample_offset) + 1;
-        for(uint8_t i = 0; i < bp_r; i++) {
-            if(elapsed < bp_end_times[i]) {
-                // We found a segment.
-                found = i;
-                break;
-            }
-        }
-        if(found < 0) {
-            // We didn't find anything, so we are in sustain.
-            found = bp_r - 1; // segment before release defines sustain
-            scale = F2S(synth[osc]->breakpoint_values[bp_set][found]);
-            synth[osc]->last_scale[bp_set] = scale;
+    if(AMY_IS_SET(psynth->note_on_clock)) {
+        elapsed = (amy_global.total_blocks*AMY_BLOCK_SIZE - psynth->note_on_clock + sample_offset) + 1;
+        env_cursor_seek(psynth, bp_set, elapsed);
+        if(c->seg == c->bp_r) {
+            // We're past them all, so we are in sustain.
+            scale = c->v1;
+            psynth->last_scale[bp_set] = scale;
             //printf("env: time %lld bpset %d seg %d SUSTAIN %f\n", amy_global.total_blocks*AMY_BLOCK_SIZE, bp_set, found, S2F(scale));
             //return scale;
             goto return_label;
         }
-    } else if(AMY_IS_SET(synth[osc]->note_off_clock)) {
+        t0 = c->t0;
+        v0 = c->v0;
+    } else if(AMY_IS_SET(psynth->note_off_clock)) {
         release = 1;
-        elapsed = (amy_global.total_blocks*AMY_BLOCK_SIZE - synth[osc]->note_off_clock + sample_offset);
-        // Get the last t/v pair , for release
-        found = bp_r;
-        t0 = 0; // start the elapsed clock again
+        elapsed = (amy_global.total_blocks*AMY_BLOCK_SIZE - psynth->note_off_clock + sample_offset);
+        env_cursor_release(psynth, bp_set);
         // Release starts from wherever we got to
-        v0 = synth[osc]->last_scale[bp_set];
-        if(elapsed > synth[osc]->breakpoint_times[bp_set][bp_r]) {
+        v0 = psynth->last_scale[bp_set];
+        if(elapsed > c->t1) {
             //printf("cbp: time %f osc %d amp %f OFF\n", amy_global.total_blocks*AMY_BLOCK_SIZE / (float)AMY_SAMPLE_RATE, osc, msynth[osc]->amp);
             // Synth is now turned off in hold_and_modify, which tracks when the amplitude goes to zero (and waits a bit).
             //AMY_UNSET(synth[osc]->note_off_clock);
-            scale = F2S(synth[osc]->breakpoint_values[bp_set][bp_r]);
-            synth[osc]->last_scale[bp_set] = scale;
+            scale = c->v1;
+            psynth->last_scale[bp_set] = scale;
             //return scale;
             goto return_label;
         }
+    } else {
+        AMY_PROFILE_STOP(COMPUTE_BREAKPOINT_SCALE)
+        return scale;
     }
-    
-    if(found<0) return scale;
 
-    t1 = bp_end_times[found];
-    v1 = F2S(synth[osc]->breakpoint_values[bp_set][found]);
-    if(found>0 && bp_r != found && !release) {
-        t0 = bp_end_times[found-1];
-        v0 = F2S(synth[osc]->breakpoint_values[bp_set][found-1]);
-    }
+    t1 = c->t1;
+    v1 = c->v1;
     scale = v0;
     if (v0 < 0 || v1 < 0) {
         sign = -1;
@@ -168,6 +198,10 @@ AMY_IRAM_ATTR SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint
                 v0 = MIN(F2S(1.0f), v0);
                 v1 = MIN(F2S(1.0f), v1);
             }
+            // The curve's constants only change with the segment (and, in
+            // release, the level it starts from), so the cursor keeps them.
+            uint8_t k_kind = 1 + 2 * eg_type + ((eg_type == ENVELOPE_DX7 && (v1 > v0)) ? 1 : 0);
+            bool k_fresh = (c->k_kind == k_kind && c->k_v0 == v0);
             if (eg_type == ENVELOPE_DX7 && (v1 > v0)) {
                 // Somewhat complicated relationship, see https://colab.research.google.com/drive/1qZmOw4r24IDijUFlel_eSoWEf3L5VSok#scrollTo=F5zkeACrOlum
                 // in SAMPLE version, DX7 levels are div 8 i.e. 0 to 12.375 instead of 0 to 99.
@@ -176,27 +210,35 @@ AMY_IRAM_ATTR SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint
 #define MIN_LEVEL_S 4.25f
 #define ATTACK_RANGE_S 9.375f
 #define MAP_ATTACK_LEVEL_S(level) (1 - MAX(level - MIN_LEVEL_S, 0) / ATTACK_RANGE_S)
-                // MAP_ATTACK_LEVEL_S reaches zero (and goes negative) once the
-                // DX7 level passes 13.625, which a breakpoint value above ~2.37
-                // does. log2_lut needs a positive argument, so floor these the
-                // same way v0/v1 are floored in the decay branch below.
-                SAMPLE mapped_current_level = MAX(F2S(MAP_ATTACK_LEVEL_S(LINEAR_SAMP_TO_DX7_LEVEL(v0))), F2S(BREAKPOINT_EPS));
-                SAMPLE mapped_target_level = MAX(F2S(MAP_ATTACK_LEVEL_S(LINEAR_SAMP_TO_DX7_LEVEL(v1))), F2S(BREAKPOINT_EPS));
-                float t_const = (t1 - t0) / S2F(log2_lut(mapped_current_level) - log2_lut(mapped_target_level));
-                float my_t0 = -t_const * S2F(log2_lut(mapped_current_level));
+                if (!k_fresh) {
+                    // MAP_ATTACK_LEVEL_S reaches zero (and goes negative) once the
+                    // DX7 level passes 13.625, which a breakpoint value above ~2.37
+                    // does. log2_lut needs a positive argument, so floor these the
+                    // same way v0/v1 are floored in the decay branch below.
+                    SAMPLE mapped_current_level = MAX(F2S(MAP_ATTACK_LEVEL_S(LINEAR_SAMP_TO_DX7_LEVEL(v0))), F2S(BREAKPOINT_EPS));
+                    SAMPLE mapped_target_level = MAX(F2S(MAP_ATTACK_LEVEL_S(LINEAR_SAMP_TO_DX7_LEVEL(v1))), F2S(BREAKPOINT_EPS));
+                    c->k0 = (t1 - t0) / S2F(log2_lut(mapped_current_level) - log2_lut(mapped_target_level));
+                    c->k1 = -c->k0 * S2F(log2_lut(mapped_current_level));
+                }
+                float t_const = c->k0;
+                float my_t0 = c->k1;
                 // This is the magic equation that shapes the DX7 attack envelopes.
                 scale = DX7_LEVEL_TO_LINEAR_SAMP(MIN_LEVEL_S + ATTACK_RANGE_S * S2F(F2S(1.0f) - exp2_lut(-F2S((my_t0 + elapsed)/t_const))));
             } else {
                 // TRUE_EXPONENTIAL or DX7 Decay (which is also regular true_exponential)
-                v0 = MAX(v0, F2S(BREAKPOINT_EPS));
-                v1 = MAX(v1, F2S(BREAKPOINT_EPS));
                 //float dx7_exponential_rate = -logf(S2F(v1)/S2F(v0)) / (t1 - t0);
                 //scale = MUL4_SS(v0, F2S(expf(-dx7_exponential_rate * (elapsed - t0))));
                 // Claude's solution avoids SAMPLE overflow for times > 5.8 sec.
-                float log2_v0 = S2F(log2_lut(v0));
-                float log2_v1 = S2F(log2_lut(v1));
+                if (!k_fresh) {
+                    c->k0 = S2F(log2_lut(v0));
+                    c->k1 = S2F(log2_lut(v1));
+                }
+                float log2_v0 = c->k0;
+                float log2_v1 = c->k1;
                 scale = exp2_lut(F2S(log2_v0 + (log2_v1 - log2_v0) * time_ratio));
             }
+            c->k_kind = k_kind;
+            c->k_v0 = v0;
         } else { // ENVELOPE_NORMAL - "false exponential"? or ENVELOPE_DB
             // After the full amount of time, the exponential decay will reach (1 - expf(-3)) = 0.95
             // so make the target gap a little bit bigger, to ensure we meet v1
@@ -211,7 +253,7 @@ AMY_IRAM_ATTR SAMPLE compute_breakpoint_scale(uint16_t osc, uint8_t bp_set, uint
         }
     }
  return_label:
-    if (!release) synth[osc]->last_scale[bp_set] = scale;
+    if (!release) psynth->last_scale[bp_set] = scale;
     // If sign is negative, flip it back again.
     if (sign < 0) {
         scale = -scale;  // does not mix well with no_amp_001
@@ -0,0 +1,223 @@
+// filter_simd.h
+// Vectorized filter_process biquads, included by filters.c.
+//
+// A biquad is recursive -- every output sample needs the two before it -- so
+// one filter can't be spread across vector lanes the way render_lut's
+// samples are.  These kernels run the other way round: each lane is a
+// different osc's filter (typically the same LPF24 in every voice of a poly
+// patch), with its own coefficients and state, and all lanes step through
+// the block in lockstep (see the cross-voice filter bank in amy.c).
+//
+// The arithmetic is the scalar kernels' -- 32-bit adds and shifts, and
+// FILT_MUL_SS as a 64-bit product shifted down by S_FRAC_BITS -- so every
+// osc's output is bit-identical to filtering it alone.  tests/test_filter_bank.c
+// checks that.  The hosts with these kernels all have AMY_HAS_MUL64, so the
+// scalar path they mirror is the full-precision one: there's no block
+// floating point (block_norm, last_filt_norm_bits) to carry per lane.
+//
+// The float build's kernels are the same code on float lanes, with plain
+// multiplies, as its scalar biquads are; tests/test_filter_bank-float
+// checks those.
+
+#ifndef __FILTER_SIMD_H
+#define __FILTER_SIMD_H
+
+#ifdef AMY_RENDER_LUT_SIMD  // see amy.h
+
+#ifdef AMY_USE_FIXEDPOINT
+typedef int32_t filt_v4i __attribute__((vector_size(16)));
+#ifdef __x86_64__
+typedef int32_t filt_v8i __attribute__((vector_size(32)));
+#define FILT_SIMD128_ATTR __attribute__((target("sse4.1")))
+#define FILT_SIMD256_ATTR __attribute__((target("avx2")))
+#else
+typedef int64_t filt_v4l __attribute__((vector_size(32)));
+#define FILT_SIMD128_ATTR
+#endif
+
+// SMUL64R on lanes: bits S_FRAC_BITS..S_FRAC_BITS+31 of each 64-bit product.
+// x86 multiplies even and odd lanes separately (pmuldq only reads the low
+// half of each 64-bit pair), lines the odd products' wanted bits up with the
+// high halves, and blends.  AArch64 widens, multiplies and narrows.
+#ifdef __x86_64__
+#include <immintrin.h>
+static inline FILT_SIMD128_ATTR filt_v4i filt_mul_4(filt_v4i a, filt_v4i b) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epi32((__m128i)a, (__m128i)b), S_FRAC_BITS);
+    __m128i odd = _mm_mul_epi32(_mm_srli_epi64((__m128i)a, 32), _mm_srli_epi64((__m128i)b, 32));
+    return (filt_v4i)_mm_blend_epi16(even, _mm_slli_epi64(odd, 32 - S_FRAC_BITS), 0xcc);
+}
+static inline FILT_SIMD256_ATTR filt_v8i filt_mul_8(filt_v8i a, filt_v8i b) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epi32((__m256i)a, (__m256i)b), S_FRAC_BITS);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64((__m256i)a, 32), _mm256_srli_epi64((__m256i)b, 32));
+    return (filt_v8i)_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32 - S_FRAC_BITS), 0xaa);
+}
+#else
+static inline filt_v4i filt_mul_4(filt_v4i a, filt_v4i b) {
+    filt_v4l product = __builtin_convertvector(a, filt_v4l) * __builtin_convertvector(b, filt_v4l);
+    return __builtin_convertvector(product >> S_FRAC_BITS, filt_v4i);
+}
+#endif
+
+// SHIFTL(y, 1).
+#define FILT_SIMD_TWICE(y) ((y) << 1)
+
+// Like S_ABS, INT_MIN stays INT_MIN and so never counts as the max.
+#define FILTER_LANES_TRACK_MAX(V, y0) { \
+            V sign = y0 >> 31; \
+            V mag = (y0 ^ sign) - sign; \
+            V bigger = mag > max_lanes; \
+            max_lanes = (mag & bigger) | (max_lanes & ~bigger); \
+        }
+
+#else  // !AMY_USE_FIXEDPOINT
+
+typedef float filt_v4f __attribute__((vector_size(16)));
+#ifdef __x86_64__
+#include <immintrin.h>
+typedef float filt_v8f __attribute__((vector_size(32)));
+#define FILT_SIMD128_ATTR __attribute__((target("sse4.1")))
+#define FILT_SIMD256_ATTR __attribute__((target("avx2")))
+#else
+#define FILT_SIMD128_ATTR
+#endif
+
+// FILT_MUL_SS is a plain multiply on float.
+static inline FILT_SIMD128_ATTR filt_v4f filt_mul_4(filt_v4f a, filt_v4f b) {
+    return a * b;
+}
+#ifdef __x86_64__
+static inline FILT_SIMD256_ATTR filt_v8f filt_mul_8(filt_v8f a, filt_v8f b) {
+    return a * b;
+}
+#endif
+
+// SHIFTL(y, 1), which float does as a multiply.
+#define FILT_SIMD_TWICE(y) ((y) * 2.0f)
+
+// S_ABS by clearing the sign bit; a compare gives the int lanes to do it in.
+#define FILTER_LANES_TRACK_MAX(V, y0) { \
+            typedef __typeof__(y0 > y0) filt_bits; \
+            V mag = (V)((filt_bits)y0 & INT32_MAX); \
+            filt_bits bigger = mag > max_lanes; \
+            max_lanes = (V)(((filt_bits)mag & bigger) | ((filt_bits)max_lanes & ~bigger)); \
+        }
+
+#endif  // AMY_USE_FIXEDPOINT
+
+// Lane k's sample i in and out.  The blocks are separate buffers, so this
+// is a load or store per lane.
+#define FILTER_LANES_IN(V, N, x0, i) \
+            V x0; \
+            for (int k = 0; k < N; ++k)  x0[k] = lanes[k].block[i];
+#define FILTER_LANES_OUT(N, y0, i) \
+            for (int k = 0; k < N; ++k)  lanes[k].block[i] = y0[k];
+
+// dsps_biquad_f32_ansi_split_fb on every lane.  It doesn't rescan its
+// output, so each lane's max stays the one it came in with.
+#define FILTER_BIQUAD_LANES_KERNEL(NAME, ATTR, V, N, MUL) \
+static ATTR void NAME(filter_lane_t *lanes, SAMPLE *max_values) { \
+    V b0, b1, b2, e, f, x1, x2, y1, y2; \
+    for (int k = 0; k < N; ++k) { \
+        b0[k] = lanes[k].coeffs[0]; \
+        b1[k] = lanes[k].coeffs[1]; \
+        b2[k] = lanes[k].coeffs[2]; \
+        e[k] = F2S(2.0f) + lanes[k].coeffs[3]; \
+        f[k] = F2S(1.0f) - lanes[k].coeffs[4]; \
+        x1[k] = lanes[k].state[0]; \
+        x2[k] = lanes[k].state[1]; \
+        y1[k] = lanes[k].state[2]; \
+        y2[k] = lanes[k].state[3]; \
+    } \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            FILTER_LANES_IN(V, N, x0, i) \
+            V y0 = MUL(b0, x0) + MUL(b1, x1) + MUL(b2, x2); \
+            y0 = y0 + FILT_SIMD_TWICE(y1) - y2; \
+            y0 = y0 - MUL(e, y1) + MUL(f, y2); \
+            x2 = x1; \
+            x1 = x0; \
+            y2 = y1; \
+            y1 = y0; \
+            FILTER_LANES_OUT(N, y0, i) \
+    } \
+    for (int k = 0; k < N; ++k) { \
+        lanes[k].state[0] = x1[k]; \
+        lanes[k].state[1] = x2[k]; \
+        lanes[k].state[2] = y1[k]; \
+        lanes[k].state[3] = y2[k]; \
+        max_values[k] = lanes[k].max_val; \
+    } \
+}
+
+// dsps_biquad_f32_ansi_split_fb_twice_fixedzeros (the LPF24) on every lane.
+#define FILTER_BIQUAD_TWICE_LANES_KERNEL(NAME, ATTR, V, N, MUL) \
+static ATTR void NAME(filter_lane_t *lanes, SAMPLE *max_values) { \
+    V a, e, f, x1, x2, y1, y2, v1, v2; \
+    for (int k = 0; k < N; ++k) { \
+        a[k] = lanes[k].coeffs[0]; \
+        e[k] = F2S(2.0f) + lanes[k].coeffs[3]; \
+        f[k] = F2S(1.0f) - lanes[k].coeffs[4]; \
+        x1[k] = lanes[k].state[0]; \
+        x2[k] = lanes[k].state[1]; \
+        y1[k] = lanes[k].state[2]; \
+        y2[k] = lanes[k].state[3]; \
+        v1[k] = lanes[k].state[4]; \
+        v2[k] = lanes[k].state[5]; \
+    } \
+    V max_lanes = {0}; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            FILTER_LANES_IN(V, N, in, i) \
+            V x0 = MUL(a, in); \
+            V w0 = x0 + FILT_SIMD_TWICE(x1) + x2; \
+            V v0 = w0 + FILT_SIMD_TWICE(v1) - v2; \
+            v0 = v0 - MUL(e, v1) + MUL(f, v2); \
+            w0 = MUL(a, v0 + FILT_SIMD_TWICE(v1) + v2); \
+            V y0 = w0 + FILT_SIMD_TWICE(y1) - y2; \
+            y0 = y0 - MUL(e, y1) + MUL(f, y2); \
+            x2 = x1; \
+            x1 = x0; \
+            v2 = v1; \
+            v1 = v0; \
+            y2 = y1; \
+            y1 = y0; \
+            FILTER_LANES_OUT(N, y0, i) \
+            FILTER_LANES_TRACK_MAX(V, y0) \
+    } \
+    for (int k = 0; k < N; ++k) { \
+        lanes[k].state[0] = x1[k]; \
+        lanes[k].state[1] = x2[k]; \
+        lanes[k].state[2] = y1[k]; \
+        lanes[k].state[3] = y2[k]; \
+        lanes[k].state[4] = v1[k]; \
+        lanes[k].state[5] = v2[k]; \
+        max_values[k] = max_lanes[k]; \
+    } \
+}
+
+#ifdef AMY_USE_FIXEDPOINT
+FILTER_BIQUAD_LANES_KERNEL(filter_biquad_lanes_simd128, FILT_SIMD128_ATTR, filt_v4i, 4, filt_mul_4)
+FILTER_BIQUAD_TWICE_LANES_KERNEL(filter_biquad_twice_lanes_simd128, FILT_SIMD128_ATTR, filt_v4i, 4, filt_mul_4)
+#ifdef __x86_64__
+FILTER_BIQUAD_LANES_KERNEL(filter_biquad_lanes_simd256, FILT_SIMD256_ATTR, filt_v8i, 8, filt_mul_8)
+FILTER_BIQUAD_TWICE_LANES_KERNEL(filter_biquad_twice_lanes_simd256, FILT_SIMD256_ATTR, filt_v8i, 8, filt_mul_8)
+#endif
+#else
+FILTER_BIQUAD_LANES_KERNEL(filter_biquad_lanes_simd128, FILT_SIMD128_ATTR, filt_v4f, 4, filt_mul_4)
+FILTER_BIQUAD_TWICE_LANES_KERNEL(filter_biquad_twice_lanes_simd128, FILT_SIMD128_ATTR, filt_v4f, 4, filt_mul_4)
+#ifdef __x86_64__
+FILTER_BIQUAD_LANES_KERNEL(filter_biquad_lanes_simd256, FILT_SIMD256_ATTR, filt_v8f, 8, filt_mul_8)
+FILTER_BIQUAD_TWICE_LANES_KERNEL(filter_biquad_twice_lanes_simd256, FILT_SIMD256_ATTR, filt_v8f, 8, filt_mul_8)
+#endif
+#endif
+
+#ifdef __x86_64__
+
+// Calls KERNEL##_simd256 or KERNEL##_simd128 per render_lut_simd.
+#define FILTER_SIMD_CALL(KERNEL, ...) \
+    (render_lut_simd == RENDER_LUT_SIMD256 ? KERNEL##_simd256(__VA_ARGS__) : KERNEL##_simd128(__VA_ARGS__))
+#else
+#define FILTER_SIMD_CALL(KERNEL, ...)  KERNEL##_simd128(__VA_ARGS__)
+#endif
+
+#endif  // AMY_RENDER_LUT_SIMD
+
+#endif  // __FILTER_SIMD_H
@@ -242,7 +242,13 @@ static AMY_IRAM_ATTR void dsps_phaser_f32_ansi(SAMPLE *block, int len, SAMPLE a,
     }
 }
 
-#ifndef AMY_HAS_MUL64
+// Float SAMPLEs have all the range and resolution the 64-bit multiply buys
+// fixed point, so they take the same plain-multiply paths.
+#if defined(AMY_HAS_MUL64) || !defined(AMY_USE_FIXEDPOINT)
+#define FILT_FULL_PRECISION
+#endif
+
+#ifndef FILT_FULL_PRECISION
 // On the RP2040 (and other ARMV6 platforms) we use block-floating-point)
 #define USE_BLOCK_FLOATING_POINT
 #endif
@@ -575,7 +581,7 @@ AMY_IRAM_ATTR SAMPLE dsps_biquad_f32_ansi_split_fb_once_fixedzeros(const SAMPLE
         y2 = y1;
         y1 = y0;
         output[i] = y0;
-        if (y0 < 0) y0 = -y0;
+        y0 = S_ABS(y0);
         if (y0 > max_out)
             max_out = y0;
     }
@@ -619,7 +625,7 @@ AMY_IRAM_ATTR SAMPLE dsps_biquad_f32_ansi_split_fb_twice_fixedzeros(const SAMPLE
         y2 = y1;
         y1 = y0;
         output[i] = y0;
-        if (y0 < 0) y0 = -y0;
+        y0 = S_ABS(y0);
         if (y0 > max_out)
             max_out = y0;
     }
@@ -681,7 +687,7 @@ void filters_init(uint16_t bus) {
 }
 
 
-#ifdef AMY_HAS_MUL64
+#ifdef FILT_FULL_PRECISION
 
 // No need for block-floating-point
 AMY_IRAM_ATTR void parametric_eq_process(uint16_t bus, SAMPLE *block) {
@@ -824,7 +830,7 @@ AMY_IRAM_ATTR void parametric_eq_process(uint16_t bus, SAMPLE *block) {
     AMY_PROFILE_STOP(PARAMETRIC_EQ_PROCESS)
 }
 
-#endif // AMY_HAS_MUL64
+#endif // FILT_FULL_PRECISION
 
 
 void hpf_buf(SAMPLE *buf, SAMPLE *state) {
@@ -910,9 +916,138 @@ SAMPLE block_denorm(SAMPLE* block, int len, int bits) {
     return block_norm(block, len, -bits);
 }
 
-AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val) {
+// The filter's cutoff this block, as a fraction of the sample rate.
+static inline float osc_filter_ratio(uint16_t osc) {
+    float ratio = freq_of_logfreq(msynth[osc]->filter_logfreq)/(float)AMY_SAMPLE_RATE;
+    if(ratio < LOWEST_RATIO) ratio = LOWEST_RATIO;
+    return ratio;
+}
+
+// Design a biquad of filter_type for a cutoff of ratio (as a fraction of the
+// sample rate) and Q.  Returns false for a filter_type that isn't a biquad.
+static bool design_biquad(uint8_t filter_type, float ratio, float q, SAMPLE *coeffs) {
+    if(filter_type==FILTER_LPF || filter_type==FILTER_LPF24)
+        dsps_biquad_gen_lpf_f32(coeffs, ratio, q);
+    else if(filter_type==FILTER_BPF)
+        dsps_biquad_gen_bpf_f32(coeffs, ratio, q);
+    else if(filter_type==FILTER_HPF)
+        dsps_biquad_gen_hpf_f32(coeffs, ratio, q);
+    else if(filter_type==FILTER_NOTCH)
+        dsps_biquad_gen_notch_f32(coeffs, ratio, q);
+    else
+        return false;
+    return true;
+}
+
+#ifdef AMY_FILTER_COEFF_TABLE
+// Biquads precomputed over a grid of filter_logfreq x log2(Q), so a filter
+// that's being swept -- an envelope or LFO on its cutoff -- gets its design
+// from four table rows rather than exp2, sin/cos and five divides.  Between
+// grid points the coefficients are interpolated, so they're close to (not
+// exactly) what design_biquad makes; tests/test_filter_coeffs.c bounds the
+// error.  The tables (about 29 KB per filter type) are filled once, by
+// filter_coeff_tables_init when AMY starts, before any render thread can read
+// them.  Qs off the grid are designed exactly.
+#define COEFF_TABLE_LOGFREQ_MIN MIN_FILTER_LOGFREQ
+#define COEFF_TABLE_LOGFREQ_STEPS 8  // per octave
+#define COEFF_TABLE_ROWS 69          // up to logfreq 5.75, past 0.45 * AMY_SAMPLE_RATE where the designs stop changing
+#define COEFF_TABLE_Q_MIN 0.5f
+#define COEFF_TABLE_Q_MAX 16.0f
+#define COEFF_TABLE_LOG2Q_MIN -1.0f  // log2(COEFF_TABLE_Q_MIN)
+#define COEFF_TABLE_LOG2Q_STEPS 4    // per octave
+#define COEFF_TABLE_COLS 21          // up to COEFF_TABLE_Q_MAX
+// One table each for LPF (and LPF24), BPF, HPF and notch.
+#define COEFF_TABLES 4
+
+static float coeff_table[COEFF_TABLES][COEFF_TABLE_ROWS][COEFF_TABLE_COLS][5];
+static bool coeff_tables_filled = false;
+
+static int coeff_table_index(uint8_t filter_type) {
+    switch (filter_type) {
+        case FILTER_LPF: case FILTER_LPF24: return 0;
+        case FILTER_BPF: return 1;
+        case FILTER_HPF: return 2;
+        case FILTER_NOTCH: return 3;
+        default: return -1;
+    }
+}
 
+static void fill_coeff_table(uint8_t filter_type, int t) {
     SAMPLE coeffs[5];
+    for (int row = 0; row < COEFF_TABLE_ROWS; ++row) {
+        float logfreq = COEFF_TABLE_LOGFREQ_MIN + row / (float)COEFF_TABLE_LOGFREQ_STEPS;
+        float ratio = freq_of_logfreq(logfreq) / (float)AMY_SAMPLE_RATE;
+        for (int col = 0; col < COEFF_TABLE_COLS; ++col) {
+            float q = exp2f(COEFF_TABLE_LOG2Q_MIN + col / (float)COEFF_TABLE_LOG2Q_STEPS);
+            design_biquad(filter_type, ratio, q, coeffs);
+            for (int i = 0; i < 5; ++i)  coeff_table[t][row][col][i] = S2F(coeffs[i]);
+        }
+    }
+}
+
+// Bilinear lookup of a design.  Returns false when the point is off the
+// table, for design_biquad to do.
+static bool table_biquad(uint8_t filter_type, float logfreq, float q, SAMPLE *coeffs) {
+    int t = coeff_table_index(filter_type);
+    if (t < 0 || !(q >= COEFF_TABLE_Q_MIN && q <= COEFF_TABLE_Q_MAX) || !(logfreq >= COEFF_TABLE_LOGFREQ_MIN))
+        return false;
+    float x = (logfreq - COEFF_TABLE_LOGFREQ_MIN) * COEFF_TABLE_LOGFREQ_STEPS;
+    if (x > COEFF_TABLE_ROWS - 1)  x = COEFF_TABLE_ROWS - 1;
+    float y = (log2f(q) - COEFF_TABLE_LOG2Q_MIN) * COEFF_TABLE_LOG2Q_STEPS;
+    int row = MIN((int)x, COEFF_TABLE_ROWS - 2);
+    int col = MIN((int)y, COEFF_TABLE_COLS - 2);
+    float fx = x - row, fy = y - col;
+    const float *c00 = coeff_table[t][row][col], *c01 = coeff_table[t][row][col + 1];
+    const float *c10 = coeff_table[t][row + 1][col], *c11 = coeff_table[t][row + 1][col + 1];
+    for (int i = 0; i < 5; ++i) {
+        float c0 = c00[i] + fy * (c01[i] - c00[i]);
+        float c1 = c10[i] + fy * (c11[i] - c10[i]);
+        coeffs[i] = F2S(c0 + fx * (c1 - c0));
+    }
+    return true;
+}
+#endif  // AMY_FILTER_COEFF_TABLE
+
+// Fill the biquad coefficient tables, if this build has them.  oscs_init calls
+// this before the render pool starts, so the render threads only ever read
+// them.
+void filter_coeff_tables_init(void) {
+#ifdef AMY_FILTER_COEFF_TABLE
+    if (coeff_tables_filled)  return;
+    fill_coeff_table(FILTER_LPF, coeff_table_index(FILTER_LPF));
+    fill_coeff_table(FILTER_BPF, coeff_table_index(FILTER_BPF));
+    fill_coeff_table(FILTER_HPF, coeff_table_index(FILTER_HPF));
+    fill_coeff_table(FILTER_NOTCH, coeff_table_index(FILTER_NOTCH));
+    coeff_tables_filled = true;
+#endif
+}
+
+// osc's biquad for this block, or NULL for a filter_type that isn't a
+// biquad.  The design only depends on filter_type, filter_logfreq and
+// resonance, which hold still for block after block of a sustained note or
+// an unmodulated filter, so each osc keeps its last design in
+// synth[osc]->filter_coeffs and only redoes it when one of them moves.
+static SAMPLE *osc_biquad_coeffs(uint16_t osc) {
+    struct synthinfo *s = synth[osc];
+    float logfreq = msynth[osc]->filter_logfreq;
+    float q = msynth[osc]->resonance;
+    if (s->filter_coeffs_type == s->filter_type && s->filter_coeffs_logfreq == logfreq
+        && s->filter_coeffs_resonance == q)
+        return s->filter_coeffs;
+#ifdef AMY_FILTER_COEFF_TABLE
+    if (!table_biquad(s->filter_type, logfreq, q, s->filter_coeffs))
+#endif
+    if (!design_biquad(s->filter_type, osc_filter_ratio(osc), q, s->filter_coeffs)) {
+        s->filter_coeffs_type = FILTER_NONE;
+        return NULL;
+    }
+    s->filter_coeffs_type = s->filter_type;
+    s->filter_coeffs_logfreq = logfreq;
+    s->filter_coeffs_resonance = q;
+    return s->filter_coeffs;
+}
+
+AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val) {
 
     SAMPLE filtmax = scan_max(synth[osc]->filter_delay, 2 * FILT_NUM_DELAYS);
     if (max_val == 0 && filtmax == 0) return 0;
@@ -921,11 +1056,9 @@ AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val
 
     AMY_PROFILE_START(FILTER_PROCESS_STAGE0)
 
-    float ratio = freq_of_logfreq(msynth[osc]->filter_logfreq)/(float)AMY_SAMPLE_RATE;
-    if(ratio < LOWEST_RATIO) ratio = LOWEST_RATIO;
     if(synth[osc]->filter_type==FILTER_PHASER) {
         // Not a biquad: dedicated allpass-chain runner, no coeffs[5], no BFP wrapper.
-        float f = ratio;
+        float f = osc_filter_ratio(osc);
         if (f > 0.45f) f = 0.45f;
         // Each stage is -90 degrees at f, centering the middle notch there.
         float t = sin2pi(f / 2) / cos2pi(f / 2);   // tan(pi*f)
@@ -943,15 +1076,8 @@ AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val
         // mix of two unity-gain paths keeps the incoming bound representative.
         return max_val;
     }
-    if(synth[osc]->filter_type==FILTER_LPF || synth[osc]->filter_type==FILTER_LPF24)
-        dsps_biquad_gen_lpf_f32(coeffs, ratio, msynth[osc]->resonance);
-    else if(synth[osc]->filter_type==FILTER_BPF)
-        dsps_biquad_gen_bpf_f32(coeffs, ratio, msynth[osc]->resonance);
-    else if(synth[osc]->filter_type==FILTER_HPF)
-        dsps_biquad_gen_hpf_f32(coeffs, ratio, msynth[osc]->resonance);
-    else if(synth[osc]->filter_type==FILTER_NOTCH)
-        dsps_biquad_gen_notch_f32(coeffs, ratio, msynth[osc]->resonance);
-    else {
+    SAMPLE *coeffs = osc_biquad_coeffs(osc);
+    if (coeffs == NULL) {
         fprintf(stderr, "Unrecognized filter type %d\n", synth[osc]->filter_type);
         return 0;
     }
@@ -960,7 +1086,7 @@ AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val
 #ifdef NOTDEF
     printf("FlPr t=%.3f f=%.3f q=%.3f %.3f %.3f %.3f %.3f %.3f ST %.6f %.6f %.6f %.6f %.6f %.6f %.6f %.6f B %.6f %.6f %.6f %.6f\n",
            amy_global.total_blocks*AMY_BLOCK_SIZE / (float)AMY_SAMPLE_RATE,
-           ratio * AMY_SAMPLE_RATE, msynth[osc]->resonance, 
+           osc_filter_ratio(osc) * AMY_SAMPLE_RATE, msynth[osc]->resonance, 
            S2F(coeffs[0]), S2F(coeffs[1]), S2F(coeffs[2]), S2F(coeffs[3]), S2F(coeffs[4]),
            S2F(synth[osc]->filter_delay[0]), 
            S2F(synth[osc]->filter_delay[1]), 
@@ -1011,7 +1137,7 @@ AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val
 #ifdef NOTDEF
     printf("FlP2 t=%.3f f=%.3f q=%.3f %.3f %.3f %.3f %.3f %.3f ST %.6f %.6f %.6f %.6f %.6f %.6f %.6f %.6f B %.6f %.6f %.6f %.6f\n",
            amy_global.total_blocks*AMY_BLOCK_SIZE / (float)AMY_SAMPLE_RATE,
-           ratio * AMY_SAMPLE_RATE, msynth[osc]->resonance, 
+           osc_filter_ratio(osc) * AMY_SAMPLE_RATE, msynth[osc]->resonance, 
            S2F(coeffs[0]), S2F(coeffs[1]), S2F(coeffs[2]), S2F(coeffs[3]), S2F(coeffs[4]),
            S2F(synth[osc]->filter_delay[0]), 
            S2F(synth[osc]->filter_delay[1]), 
@@ -1027,6 +1153,52 @@ AMY_IRAM_ATTR SAMPLE filter_process(SAMPLE * block, uint16_t osc, SAMPLE max_val
     return max_val;
 }
 
+#include "filter_simd.h"
+
+// Set up osc's filter_process for this block as a lane of filter_lanes, for
+// filtering in lockstep with other oscs' filters.  Only for the biquad
+// filter types.  Returns FILTER_LANE_NONE when filter_process would return
+// early -- silent input and a silent filter -- leaving block as it is.
+uint8_t osc_filter_lane(uint16_t osc, SAMPLE *block, SAMPLE max_val, filter_lane_t *lane) {
+    if (max_val == 0 && scan_max(synth[osc]->filter_delay, 2 * FILT_NUM_DELAYS) == 0)
+        return FILTER_LANE_NONE;
+    AMY_PROFILE_START(FILTER_PROCESS_STAGE0)
+    memcpy(lane->coeffs, osc_biquad_coeffs(osc), sizeof(lane->coeffs));
+    AMY_PROFILE_STOP(FILTER_PROCESS_STAGE0)
+    lane->block = block;
+    lane->state = synth[osc]->filter_delay;
+    lane->max_val = max_val;
+    return (synth[osc]->filter_type == FILTER_LPF24) ? FILTER_LANE_BIQUAD_TWICE : FILTER_LANE_BIQUAD;
+}
+
+// How many oscs filter_lanes filters at once; 0 if there are no lane kernels.
+uint8_t filter_lane_width(void) {
+    return render_lut_lane_width();
+}
+
+// Run n (up to filter_lane_width()) oscs' filters of one kind in
+// lockstep, in place on their blocks, and return each block's max as
+// filter_process would.
+void filter_lanes(uint8_t kind, filter_lane_t *lanes, uint8_t n, SAMPLE *max_values) {
+#ifdef AMY_RENDER_LUT_SIMD
+    AMY_PROFILE_START(FILTER_LANES)
+    // Spare lanes filter silence.
+    SAMPLE spare_block[AMY_BLOCK_SIZE], spare_state[2 * FILT_NUM_DELAYS];
+    for (uint8_t k = n; k < filter_lane_width(); ++k) {
+        bzero(&lanes[k], sizeof(filter_lane_t));
+        lanes[k].block = spare_block;
+        lanes[k].state = spare_state;
+    }
+    if (n < filter_lane_width()) {
+        bzero(spare_block, sizeof(spare_block));
+        bzero(spare_state, sizeof(spare_state));
+    }
+    if (kind == FILTER_LANE_BIQUAD) FILTER_SIMD_CALL(filter_biquad_lanes, lanes, max_values);
+    else if (kind == FILTER_LANE_BIQUAD_TWICE) FILTER_SIMD_CALL(filter_biquad_twice_lanes, lanes, max_values);
+    AMY_PROFILE_STOP(FILTER_LANES)
+#endif
+}
+
 
 void reset_filter(uint16_t osc) {
     // Reset all the filter state to zero.
@@ -1088,7 +1260,7 @@ AMY_IRAM_ATTR SAMPLE dist_block(SAMPLE * block, uint16_t len,
             SAMPLE y = MUL4_SS(v, F2S(1.0f) - MUL4_SS(MUL4_SS(v, v), F2S(0.33333334f)));
             y = MUL4_SS(dry, x) + MUL4_SS(mix, y);
             block[i] = y;
-            if (y < 0) y = -y;
+            y = S_ABS(y);
             if (y > max_out) max_out = y;
         }
         break;
@@ -1102,7 +1274,7 @@ AMY_IRAM_ATTR SAMPLE dist_block(SAMPLE * block, uint16_t len,
             // AND is a nonnegative mod-4 in two's complement.
             SAMPLE fold = (v + F2S(1.0f)) & ((4 << S_FRAC_BITS) - 1);
             y = fold - F2S(2.0f);
-            if (y < 0) y = -y;
+            y = S_ABS(y);
             y = F2S(1.0f) - y;
 #else
             SAMPLE fold = v + 1.0f;
@@ -1111,7 +1283,7 @@ AMY_IRAM_ATTR SAMPLE dist_block(SAMPLE * block, uint16_t len,
 #endif
             y = MUL4_SS(dry, x) + MUL4_SS(mix, y);
             block[i] = y;
-            if (y < 0) y = -y;
+            y = S_ABS(y);
             if (y > max_out) max_out = y;
         }
         break;
@@ -1167,7 +1339,7 @@ AMY_IRAM_ATTR SAMPLE dist_block(SAMPLE * block, uint16_t len,
             --count;
             SAMPLE y = MUL4_SS(dry, x) + MUL4_SS(mix, yn1);
             block[i] = y;
-            if (y < 0) y = -y;
+            y = S_ABS(y);
             if (y > max_out) max_out = y;
         }
         st->hold = hold;
@@ -29,15 +29,16 @@
 // We use this mechanism as follows:
 //   * esp_render_task (the task that runs on the second core):
 //      - Waits for notification (from main fill_audio thread)
-//      - renders half the oscs
+//      - renders its share of the voices (dealt by amy_render_plan)
 //      - notifies either fill_buffer (multithread) or amy_update (single thread) when done.
 //      - loop
 //   * esp_fill_audio_buffer_task (launched as one parallel task):
 //      - if not using I2S, waits for notification (from amy_update task)
 //      - read I2S input (if used)
 //      - execute AMY command updates (deltas)
+//      - Plan which voices each core renders (amy_render_plan)
 //      - Notify esp_render_task
-//      - render the other half of oscs
+//      - render the rest of the voices
 //      - Wait for notification (indicating that esp_render_task is done)
 //      - call amy_fill_buffer (to combine the rendered oscs into output samples)
 //      - Notify amy_update_handle that the new block is ready
@@ -261,7 +262,7 @@ TaskHandle_t amy_render_task_done_handle = NULL;
 void esp_render_task( void * pvParameters) {
     while(1) {
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // from esp_render_on_cores
-        amy_render(0, AMY_OSCS/2, 1);
+        amy_render_units(1);
         // Tell (someone) we're done.
         xTaskNotifyGive(amy_render_task_done_handle);  // to esp_render_on_cores
     }
@@ -270,12 +271,14 @@ void esp_render_task( void * pvParameters) {
 void esp_render_on_cores() {
     // Call amy_render on all the oscs, using multicore if available.
     if (amy_global.config.platform.multicore) {
+        // Split this block's voices between the cores by their recent cost.
+        amy_render_plan(2);
         // Tell the esp_render_task to inform *us* when it's done.
         amy_render_task_done_handle = xTaskGetCurrentTaskHandle();
         // Tell the other core to start rendering.
         xTaskNotifyGive(amy_render_handle);  // to esp_render_task
         // Render me
-        amy_render(AMY_OSCS/2, AMY_OSCS, 0);
+        amy_render_units(0);
         // Wait for the other core to finish
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // from esp_render_task
     } else {
@@ -538,7 +541,7 @@ void amy_update_tasks() {
 #define USE_SECOND_CORE
 
 int32_t render_other_core(int32_t data) {
-    amy_render(AMY_OSCS/2, AMY_OSCS, 1);
+    amy_render_units(1);
     return AMY_OK;
 }
 
@@ -547,9 +550,11 @@ int16_t *amy_render_audio() {
 #ifdef USE_SECOND_CORE
     if (amy_global.config.platform.multicore) {
         int32_t res;
+        // Split this block's voices between the cores by their recent cost.
+        amy_render_plan(2);
         queue_entry_t entry = {render_other_core, AMY_OK};
         queue_add_blocking(&call_queue, &entry);
-        amy_render(0, AMY_OSCS/2, 0);
+        amy_render_units(0);
         queue_remove_blocking(&results_queue, &res);
     } else
 #endif
@@ -51,6 +51,7 @@ void partials_note_on(uint16_t osc) {
         // This is used I think only at envelope.c:121 to avoid the normal partial preset special-case for PARTIALs.
         synth[o]->preset = synth[osc]->preset;
         synth[o]->logfreq_coefs[COEF_BEND] = 0;  // Each PARTIAL will receive pitch bend via the midi_note modulation from the parent osc, don't add it twice.
+        osc_coefs_changed(synth[o]);
         synth[o]->role = SYNTH_IS_ALGO_SOURCE;
         synth[o]->note_on_clock = amy_global.total_blocks*AMY_BLOCK_SIZE;
         AMY_UNSET(synth[o]->note_off_clock);
@@ -281,9 +282,11 @@ void _osc_on_with_harm_param(uint16_t o, float *harm_param, const interp_partial
     // Final release
     synth[o]->breakpoint_times[0][partials_voice->num_sample_times_ms + 1] = 200 * AMY_SAMPLE_RATE / 1000;
     synth[o]->breakpoint_values[0][partials_voice->num_sample_times_ms + 1] = 0;
+    osc_envelope_changed(synth[o], 0);
     // Decouple osc freq and amp from note and amp.
     synth[o]->logfreq_coefs[COEF_NOTE] = 0;
     synth[o]->amp_coefs[COEF_VEL] = 1.0;  // velocity is modified on-the-fly by the control osc to vary global amplitude.
+    osc_coefs_changed(synth[o]);
     // Other osc params.
     synth[o]->role = SYNTH_IS_ALGO_SOURCE;
     synth[o]->note_on_clock = amy_global.total_blocks*AMY_BLOCK_SIZE;
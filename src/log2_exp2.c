@@ -4,7 +4,9 @@
 #include "log2_exp2_fxpt_lutable.h"
 
 static inline SAMPLE lut_val(SAMPLE frac, const LUTSAMPLE *table, const int log2_tab_size) {
-    int index = INT_OF_S(frac, log2_tab_size);
+    // frac is in [0, 1), so the mask changes nothing -- except in a float
+    // build, where an inf or NaN argument makes INT_OF_S INT_MIN.
+    int index = INT_OF_S(frac, log2_tab_size) & ((1 << log2_tab_size) - 1);
     SAMPLE index_frac_part = S_FRAC_OF_S(frac, log2_tab_size);
     // Tables are constructed to extend one value beyond the log2_tab_size bits max.
     return L2S(table[index]) + MUL0_SS(L2S(table[index + 1] - table[index]), index_frac_part);
@@ -382,7 +382,7 @@ void *yield_midi_message_handler_events(uint8_t status, uint16_t channel, uint8_
                 substitute_midi_special_values(message, mapping->message_template, channel, code, value);
                 // Mark the event as already passed through mapping for this
                 // channel, so we don't send it back out again.
-                event->note_source_channel = channel;
+                AMY_EVENT_SET(event, note_source_channel, channel);
                 // If we're given a time, set it in the event.
                 if (AMY_IS_SET(time)) event->time = time;
             }  // If state is non-null, assume we're working through the later yields.
@@ -408,7 +408,7 @@ void midi_message_handler_to_queue(uint8_t status, uint16_t channel, uint8_t * d
     bool fake_note_on = (status == 0x90) && (len >= 2) && (data[1] == 0xFF);
     do {
         if (base_event) e = *base_event;
-        else amy_clear_event(&e);
+        else amy_clear_event_sparse(&e);
         state = yield_midi_message_handler_events(status, channel, data, len, time, &e, state);
         if (state != NULL) {
             if (fake_note_on) {
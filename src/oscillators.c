@@ -67,6 +67,8 @@ const LUT *choose_from_lutset(float period, const LUT *lutset) {
     if(lut == NULL)  return phase;\
     int lut_mask = lut->table_size - 1; \
     int lut_bits = lut->log_2_table_size; \
+    float lut_size = (float)lut->table_size; \
+    (void)lut_bits; (void)lut_size; \
     SAMPLE sample = 0; \
     SAMPLE max_value = 0; \
     SAMPLE current_amp = incoming_amp;                                      \
@@ -81,6 +83,7 @@ const LUT *choose_from_lutset(float period, const LUT *lutset) {
             past0 = sample;  \
             total_phase += S2P(MUL4_SS(feedback_level, SHIFTR(past1 + past0, 1)));
 
+#ifdef AMY_USE_FIXEDPOINT
 #define RENDER_LUT_GUTS(MOD_PART, FEEDBACK_PART, INTERP_PART) \
             MOD_PART \
             FEEDBACK_PART \
@@ -89,6 +92,28 @@ const LUT *choose_from_lutset(float period, const LUT *lutset) {
             SAMPLE b = L2S(lut->table[base_index]); \
             SAMPLE c = L2S(lut->table[(base_index + 1) & lut_mask]); \
             INTERP_PART
+#else
+// floorf without SSE4.1 is a dozen instructions and a branch; truncating and
+// stepping down for negative (modulated) positions is three.
+#define RENDER_LUT_FLOOR(x) ((int32_t)(x) - ((x) < (float)(int32_t)(x)))
+
+// Float phase: sample i is at phase + i * step, rather than at a phase summed
+// and wrapped sample by sample, which would put a floor in every iteration's
+// dependency chain.  One floor then gives both the table index and the
+// fraction (the generic INT_OF_P / S_FRAC_OF_P take one each, plus a modulo),
+// and the mask does the wrapping.  RENDER_LUT_LOOP_END moves phase on by the
+// whole block at the last sample.
+#define RENDER_LUT_GUTS(MOD_PART, FEEDBACK_PART, INTERP_PART) \
+            MOD_PART \
+            FEEDBACK_PART \
+            float table_pos = (total_phase + (float)i * step) * lut_size; \
+            int32_t table_floor = RENDER_LUT_FLOOR(table_pos); \
+            int16_t base_index = table_floor & lut_mask; \
+            SAMPLE frac = table_pos - (float)table_floor; \
+            SAMPLE b = L2S(lut->table[base_index]); \
+            SAMPLE c = L2S(lut->table[(base_index + 1) & lut_mask]); \
+            INTERP_PART
+#endif
 
 #define INTERP_LINEAR \
             sample = b + MUL0_SS(c - b, frac);
@@ -106,17 +131,47 @@ const LUT *choose_from_lutset(float period, const LUT *lutset) {
             SAMPLE next_bit = MUL0_SS(fr_d_ma_m3cmb + d + SHIFTL(a - b, 1) - b, MUL0_SS(F2S(1.0f) - frac, F2S(0.16666666666667f))); \
             sample = b + MUL0_SS(cminusb - next_bit, frac);
 
+#ifdef AMY_USE_FIXEDPOINT
+#define RENDER_LUT_PHASE_STEP \
+            phase = P_WRAPPED_SUM(phase, step);
+#define RENDER_LUT_AMP_STEP \
+            current_amp += incremental_amp;
+#else
+#define RENDER_LUT_PHASE_STEP \
+            if (i == AMY_BLOCK_SIZE - 1) phase = P_WRAPPED_SUM(phase, AMY_BLOCK_SIZE * step);
+// Amp likewise: sample i's is incoming_amp + i * incremental_amp, which is
+// also what the vector kernels (render_lut_simd.h) compute in each lane.
+#define RENDER_LUT_AMP_STEP \
+            current_amp = incoming_amp + (float)(i + 1) * incremental_amp;
+#endif
+
 #define RENDER_LUT_LOOP_END \
             SAMPLE value = buf[i] + MULA_SS(sample, current_amp);	\
             buf[i] = value;                            \
-            if (value < 0) value = -value;             \
+            value = S_ABS(value);                      \
             if (value > max_value) max_value = value;  \
-            current_amp += incremental_amp; \
-            phase = P_WRAPPED_SUM(phase, step);
+            RENDER_LUT_AMP_STEP \
+            RENDER_LUT_PHASE_STEP
 
 
 #define NOTHING ;
 
+#include "render_lut_simd.h"
+
+uint8_t render_lut_simd = RENDER_LUT_SCALAR;
+
+// Pick the widest render_lut kernels this CPU can run.
+void render_lut_simd_init(void) {
+    render_lut_simd = RENDER_LUT_SCALAR;
+#if defined(AMY_RENDER_LUT_SIMD) && defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))  render_lut_simd = RENDER_LUT_SIMD256;
+    else if (__builtin_cpu_supports("sse4.1"))  render_lut_simd = RENDER_LUT_SIMD128;
+#elif defined(AMY_RENDER_LUT_SIMD)
+    render_lut_simd = RENDER_LUT_SIMD128;  // NEON is always there on AArch64.
+#endif
+}
+
 /* is this in fact ever used? */
 PHASOR render_lut_fm_fb(SAMPLE* buf,
                         PHASOR phase, 
@@ -177,6 +232,13 @@ AMY_IRAM_ATTR PHASOR render_lut_fm(SAMPLE* buf,
                      SAMPLE* pmax_value) {
     AMY_PROFILE_START(RENDER_LUT_FM)
     RENDER_LUT_PREAMBLE
+#ifdef AMY_RENDER_LUT_SIMD
+    if (render_lut_simd != RENDER_LUT_SCALAR) {
+        phase = RENDER_LUT_SIMD_CALL(render_lut_fm, buf, phase, step, incoming_amp, ending_amp, lut, mod, pmax_value);
+        AMY_PROFILE_STOP(RENDER_LUT_FM)
+        return phase;
+    }
+#endif
     for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
         PHASOR total_phase = phase;
 
@@ -197,6 +259,13 @@ AMY_IRAM_ATTR PHASOR render_lut(SAMPLE* buf,
                   SAMPLE* pmax_value) {
     AMY_PROFILE_START(RENDER_LUT)
     RENDER_LUT_PREAMBLE
+#ifdef AMY_RENDER_LUT_SIMD
+    if (render_lut_simd != RENDER_LUT_SCALAR) {
+        phase = RENDER_LUT_SIMD_CALL(render_lut, buf, phase, step, incoming_amp, ending_amp, lut, NULL, pmax_value);
+        AMY_PROFILE_STOP(RENDER_LUT)
+        return phase;
+    }
+#endif
     for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
         PHASOR total_phase = phase;
 
@@ -216,6 +285,10 @@ AMY_IRAM_ATTR PHASOR render_lut_256(SAMPLE* buf,
                   SAMPLE incoming_amp, SAMPLE ending_amp,
                   const LUT* lut,
                   SAMPLE* pmax_value) {
+#ifdef AMY_RENDER_LUT_SIMD
+    if (render_lut_simd != RENDER_LUT_SCALAR)
+        return RENDER_LUT_SIMD_CALL(render_lut_256, buf, phase, step, incoming_amp, ending_amp, lut, NULL, pmax_value);
+#endif
     // RENDER_LUT_PREAMBLE
     //int lut_mask = 255;
     //int lut_bits = 8;
@@ -223,6 +296,7 @@ AMY_IRAM_ATTR PHASOR render_lut_256(SAMPLE* buf,
     SAMPLE max_value = 0;
     SAMPLE current_amp = incoming_amp;
     SAMPLE incremental_amp = SHIFTR(ending_amp - incoming_amp, BLOCK_SIZE_BITS);
+#ifdef AMY_USE_FIXEDPOINT
     phase = SHIFTL(phase, 1);  // Make phase into _32 instead of s_31
     step = SHIFTL(step, 1);
     for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
@@ -244,6 +318,24 @@ AMY_IRAM_ATTR PHASOR render_lut_256(SAMPLE* buf,
         phase = (int32_t)((uint32_t)(((uint32_t)phase) + ((uint32_t)step)));
     }
     phase = SHIFTR(phase, 1);  // Restore phase to s_31
+#else
+    // As in the float RENDER_LUT_GUTS, sample i is at phase + i * step.
+    for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
+        float table_pos = (phase + (float)i * step) * 256.0f;
+        int32_t table_floor = RENDER_LUT_FLOOR(table_pos);
+        int16_t base_index = table_floor & 255;
+        SAMPLE frac = table_pos - (float)table_floor;
+        SAMPLE b = L2S(lut->table[base_index]);
+        SAMPLE c = L2S(lut->table[base_index + 1]); // table has guard point at end
+        sample = b + MUL0_SS(c - b, frac);
+        SAMPLE value = buf[i] + MULA_SS(sample, current_amp);
+        buf[i] = value;
+        value = S_ABS(value);
+        if (value > max_value) max_value = value;
+        RENDER_LUT_AMP_STEP
+    }
+    phase = P_WRAPPED_SUM(phase, AMY_BLOCK_SIZE * step);
+#endif
     *pmax_value = max_value;
     return phase;
 }
@@ -256,6 +348,13 @@ AMY_IRAM_ATTR PHASOR render_lut_cub(SAMPLE* buf,
                       SAMPLE *pmax_value) {
     AMY_PROFILE_START(RENDER_LUT_CUB)
     RENDER_LUT_PREAMBLE
+#ifdef AMY_RENDER_LUT_SIMD
+    if (render_lut_simd != RENDER_LUT_SCALAR) {
+        phase = RENDER_LUT_SIMD_CALL(render_lut_cub, buf, phase, step, incoming_amp, ending_amp, lut, NULL, pmax_value);
+        AMY_PROFILE_STOP(RENDER_LUT_CUB)
+        return phase;
+    }
+#endif
     for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
         PHASOR total_phase = phase;
 
@@ -344,6 +443,18 @@ SAMPLE render_pulse(SAMPLE* buf, uint16_t osc) {
     return render_lpf_lut(buf, osc, true, 1, 0);
 }
 
+// How far a mod osc's phase moves each block, the block being its sample
+// (freq / mod_sr cycles).  An osc at or past a cycle a block can't be followed
+// at that rate, so it holds its phase; that's what fixed point's F2P, which
+// overflowed there, used to leave it doing, and now both SAMPLE formats do it
+// on purpose.
+static inline PHASOR mod_phase_step(float freq) {
+    float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;  // samples per sec / samples per call = calls per sec
+    float cycles = freq / mod_sr;  // cycles per sec / calls per sec = cycles per call
+    if (cycles >= 1.0f || cycles <= -1.0f)  return 0;
+    return F2P(cycles);
+}
+
 void pulse_mod_trigger(uint16_t osc) {
     //float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;
     //float freq = freq_of_logfreq(synth[osc]->logfreq);
@@ -360,9 +471,8 @@ SAMPLE compute_mod_pulse(uint16_t osc) {
     } else {
         sample = F2S(-1.0f);
     }
-    float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;  // samples per sec / samples per call = calls per sec
     float freq = freq_of_logfreq(msynth[osc]->logfreq);
-    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, F2P(freq / mod_sr));  // cycles per sec / calls per sec = cycles per call
+    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, mod_phase_step(freq));
     return MULA_SS(sample, F2S(msynth[osc]->amp));
 }
 
@@ -421,9 +531,8 @@ void saw_down_mod_trigger(uint16_t osc) {
 SAMPLE compute_mod_saw(uint16_t osc, int8_t direction) {
     // Saw waveform is just the phasor.
     SAMPLE sample = SHIFTL(P2S(synth[osc]->phase), 1) - F2S(1.0f);
-    float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;  // samples per sec / samples per call = calls per sec
     float freq = freq_of_logfreq(msynth[osc]->logfreq);
-    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, F2P(freq / mod_sr));  // cycles per sec / calls per sec = cycles per call
+    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, mod_phase_step(freq));
     return MULA_SS(sample, direction * F2S(msynth[osc]->amp));
 }
 
@@ -475,9 +584,8 @@ SAMPLE compute_mod_triangle(uint16_t osc) {
     if (sample > F2S(4.0f))  sample -= F2S(4.0f);  // 1..4/0..1
     if (sample > F2S(2.0f))  sample = F2S(4.0f) - sample;  // 0..2..0
     sample -= F2S(1.0f);  // -1 .. 1
-    float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;  // samples per sec / samples per call = calls per sec
     float freq = freq_of_logfreq(msynth[osc]->logfreq);
-    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, F2P(freq / mod_sr));  // cycles per sec / calls per sec = cycles per call
+    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, mod_phase_step(freq));
     return MULA_SS(sample, F2S(msynth[osc]->amp));
 }
 
@@ -562,6 +670,65 @@ SAMPLE render_sine(SAMPLE* buf, uint16_t osc) {
     return max_value;
 }
 
+// Set up osc's next block as render_sine, render_triangle or render_saw would
+// pass it to their kernel, for rendering in lockstep with other oscs.
+// Returns the kernel (LUT_LANE_*), or LUT_LANE_NONE for other waves.
+uint8_t osc_lut_lane(uint16_t osc, const LUT **lut, lut_lane_t *lane) {
+    uint8_t wave = synth[osc]->wave;
+    uint8_t kind;
+    SAMPLE direction = 1;
+    float freq = freq_of_logfreq(msynth[osc]->logfreq);
+    if (wave == SINE) {
+        _sine_note_on(osc, freq);
+        *lut = &sine_fxpt_lutset[0];
+        kind = LUT_LANE_SINE;
+    } else if (wave == TRIANGLE) {
+        _triangle_note_on(osc, freq);
+        *lut = synth[osc]->lut;
+        kind = LUT_LANE_LINEAR;
+    } else if (wave == SAW_DOWN || wave == SAW_UP) {
+        _saw_note_on(osc);
+        *lut = synth[osc]->lut;
+        kind = LUT_LANE_CUBIC;
+        if (wave == SAW_DOWN) direction = -1;
+    } else {
+        return LUT_LANE_NONE;
+    }
+    lane->phase = synth[osc]->phase;
+    lane->step = F2P(freq / (float)AMY_SAMPLE_RATE);
+    lane->incoming_amp = direction * F2S(msynth[osc]->last_amp);
+    lane->ending_amp = direction * F2S(msynth[osc]->amp);
+    return kind;
+}
+
+// How many oscs render_lut_lanes renders at once; 0 if there are no lane kernels.
+uint8_t render_lut_lane_width(void) {
+    if (render_lut_simd == RENDER_LUT_SIMD256) return 8;
+    if (render_lut_simd == RENDER_LUT_SIMD128) return 4;
+    return 0;
+}
+
+// Render render_lut_lane_width() oscs sharing lut in lockstep into a
+// lane-interleaved tile, and advance their lanes' phases.
+void render_lut_lanes(uint8_t kind, const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values) {
+#ifdef AMY_RENDER_LUT_SIMD
+    AMY_PROFILE_START(RENDER_LUT_LANES)
+    if (kind == LUT_LANE_SINE) RENDER_LUT_SIMD_CALL(render_lut_256_lanes, lut, lanes, tile, max_values);
+    else if (kind == LUT_LANE_LINEAR) RENDER_LUT_SIMD_CALL(render_lut_lanes, lut, lanes, tile, max_values);
+    else if (kind == LUT_LANE_CUBIC) RENDER_LUT_SIMD_CALL(render_lut_cub_lanes, lut, lanes, tile, max_values);
+    AMY_PROFILE_STOP(RENDER_LUT_LANES)
+#endif
+}
+
+// Pan every lane of a render_lut_lanes tile into a stereo block.
+void mix_lut_lanes(SAMPLE *stereo_dest, const SAMPLE *tile, const lut_lane_t *lanes) {
+#ifdef AMY_RENDER_LUT_SIMD
+    AMY_PROFILE_START(MIX_WITH_PAN)
+    RENDER_LUT_SIMD_CALL(mix_lut_lanes, stereo_dest, tile, lanes);
+    AMY_PROFILE_STOP(MIX_WITH_PAN)
+#endif
+}
+
 
 // TOOD -- not needed anymore
 SAMPLE compute_mod_sine(uint16_t osc) { 
@@ -577,8 +744,7 @@ SAMPLE compute_mod_sine(uint16_t osc) {
     LUTSAMPLE b = lut->table[base_index];
     LUTSAMPLE c = lut->table[(base_index + 1) & lut_mask];
     SAMPLE sample = L2S(b) + MUL0_SS(L2S(c - b), frac);
-    float mod_sr = (float)AMY_SAMPLE_RATE / (float)AMY_BLOCK_SIZE;  // samples per sec / samples per call = calls per sec
-    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, F2P(freq / mod_sr));  // cycles per sec / calls per sec = cycles per call
+    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, mod_phase_step(freq));
     return MULA_SS(sample, F2S(msynth[osc]->amp));
 }
 
@@ -614,7 +780,8 @@ static inline int32_t my_mrand48(void) {
 // Returns a SAMPLE between -1 and 1.
 inline static SAMPLE amy_get_random() {
 #ifndef AMY_USE_FIXEDPOINT
-    return ((float)drand48()) - 0.5f;
+    // The same sequence as fixed point, so seeded noise matches across builds.
+    return (float)my_mrand48() * (1.0f / 4294967296.0f);
 #else
     //assert(RAND_MAX == 2147483647); // 2^31 - 1
     return SHIFTR((SAMPLE)my_mrand48(), (32 - S_FRAC_BITS));  // - F2S(0.5f);
@@ -640,7 +807,7 @@ SAMPLE render_noise(SAMPLE *buf, uint16_t osc) {
         last_last_white = last_white;
         last_white = white;
         buf[i] += value;
-        if (value < 0) value = -value;
+        value = S_ABS(value);
         if (value > max_value) max_value = value;
     }
     synth[osc]->last_two[0] = last_white;
@@ -654,7 +821,7 @@ SAMPLE compute_mod_noise(uint16_t osc) {
     float fstep = freq / mod_sr;
     SAMPLE amp = F2S(msynth[osc]->amp);
     PHASOR starting_phase = synth[osc]->phase;
-    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, F2P(fstep));  // cycles per sec / calls per sec = cycles per call
+    synth[osc]->phase = P_WRAPPED_SUM(synth[osc]->phase, mod_phase_step(freq));
     if (fstep > 1.0f || synth[osc]->phase < starting_phase) {
         // phase wrapped, take new sample.
         synth[osc]->last_two[0] = MULA_SS(amy_get_random(), amp);
@@ -673,7 +840,7 @@ SAMPLE render_envelope(SAMPLE *buf, uint16_t osc) {
     for(uint16_t i = 0; i < AMY_BLOCK_SIZE; i++) {
         SAMPLE value = MULA_SS(buf[i], current_amp);
         buf[i] = value;
-        if (value < 0) value = -value;
+        value = S_ABS(value);
         if (value > max_value) max_value = value;
         current_amp += incremental_amp;
     }
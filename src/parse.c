@@ -455,22 +455,22 @@ int amy_parse_synth_layer_message(char *message, amy_event *e) {
     int skip_chars = 1;  // default is to skip one extra char.
     if (message[0] >= '0' && message[0] <= '9') {
         // It's just the instrument number.
-        e->synth = atoi(message);
+        AMY_EVENT_SET(e, synth, atoi(message));
         return 0;  // no extra skip.
     }
     char cmd = message[0];
     message++;
-    if (cmd == 'd')  e->synth_delay_ms = atoi(message);
-    else if (cmd == 'f')  e->synth_flags = atoi(message);
+    if (cmd == 'd')  AMY_EVENT_SET(e, synth_delay_ms, atoi(message));
+    else if (cmd == 'f')  AMY_EVENT_SET(e, synth_flags, atoi(message));
     else if (cmd == 'g')  skip_chars = cv_trigger_from_message(message, e->synth, skip_chars);
-    else if (cmd == 'm')  e->grab_midi_notes = atoi(message);
-    else if (cmd == 'M')  e->note_source_channel = atoi(message);  // To mark MIDI-in notes.
-    else if (cmd == 'n')  e->oscs_per_voice = atoi(message);
-    else if (cmd == 'p')  e->pedal = atoi(message);
-    else if (cmd == 't')  e->to_synth = atoi(message);
-    else if (cmd == 'v')  e->num_voices = atoi(message);
-    else if (cmd == 'V')  e->synth_level = atoff(message);  // Per-instrument level, default 1.
-    else if (cmd == 'y')  e->bus = atoi(message);  // 'i1iy1' is the same as 'i1y1'.
+    else if (cmd == 'm')  AMY_EVENT_SET(e, grab_midi_notes, atoi(message));
+    else if (cmd == 'M')  AMY_EVENT_SET(e, note_source_channel, atoi(message));  // To mark MIDI-in notes.
+    else if (cmd == 'n')  AMY_EVENT_SET(e, oscs_per_voice, atoi(message));
+    else if (cmd == 'p')  AMY_EVENT_SET(e, pedal, atoi(message));
+    else if (cmd == 't')  AMY_EVENT_SET(e, to_synth, atoi(message));
+    else if (cmd == 'v')  AMY_EVENT_SET(e, num_voices, atoi(message));
+    else if (cmd == 'V')  AMY_EVENT_SET(e, synth_level, atoff(message));  // Per-instrument level, default 1.
+    else if (cmd == 'y')  AMY_EVENT_SET(e, bus, atoi(message));  // 'i1iy1' is the same as 'i1y1'.
     else if (cmd == 'c' || cmd == 'o') skip_chars = midi_mapping_from_message(message, cmd, e->synth, skip_chars);
     else fprintf(stderr, "Unrecognized synth-level command '%s'\n", message - 1);
     return skip_chars;
@@ -483,26 +483,26 @@ int amy_parse_synth_layer_message(char *message, amy_event *e) {
 int amy_parse_dist_layer_message(char *message, amy_event *e) {
     if (message[0] >= '0' && message[0] <= '9') {
         // It's just the filter type.
-        e->filter_type = atoi(message);
+        AMY_EVENT_SET(e, filter_type, atoi(message));
         return 0;  // no extra skip.
     }
     char cmd = message[0];
     message++;
-    if (cmd == 'C')  e->dist_type = (atoff(message) != 0) ? DIST_CLIP : DIST_OFF;
-    else if (cmd == 'F')  e->dist_type = (atoff(message) != 0) ? DIST_FOLD : DIST_OFF;
+    if (cmd == 'C')  AMY_EVENT_SET(e, dist_type, (atoff(message) != 0) ? DIST_CLIP : DIST_OFF);
+    else if (cmd == 'F')  AMY_EVENT_SET(e, dist_type, (atoff(message) != 0) ? DIST_FOLD : DIST_OFF);
     else if (cmd == 'H') {
         uint16_t vals[2];
         parse_list_uint16_t(message, vals, 2, AMY_UNSET_VALUE(vals[0]));
         if (vals[0] == 0) {
-            e->dist_type = DIST_OFF;
+            AMY_EVENT_SET(e, dist_type, DIST_OFF);
         } else {
-            e->dist_type = DIST_CRUSH;
-            if (AMY_IS_SET(vals[0])) e->dist_bits = (uint8_t)MIN(vals[0], 24);
-            if (AMY_IS_SET(vals[1])) e->dist_rate = vals[1];
+            AMY_EVENT_SET(e, dist_type, DIST_CRUSH);
+            if (AMY_IS_SET(vals[0])) AMY_EVENT_SET(e, dist_bits, (uint8_t)MIN(vals[0], 24));
+            if (AMY_IS_SET(vals[1])) AMY_EVENT_SET(e, dist_rate, vals[1]);
         }
     }
-    else if (cmd == 'D')  e->dist_drive = atoff(message);
-    else if (cmd == 'M')  e->dist_mix = atoff(message);
+    else if (cmd == 'D')  AMY_EVENT_SET(e, dist_drive, atoff(message));
+    else if (cmd == 'M')  AMY_EVENT_SET(e, dist_mix, atoff(message));
     else fprintf(stderr, "Unrecognized distortion command '%s'\n", message - 1);
     return 1;  // skip the sub-command letter.
 }
@@ -580,6 +580,49 @@ uint16_t amy_parse_transfer_layer_message(char *message) {
         }
         return len;
     }
+    else if (cmd == 'M') {
+        // zM: setup PCM preset to play a WAV file on disk in place (mapped,
+        // where the platform can; otherwise streamed, as zF).
+        // Params: Preset number, filename, midi note
+        uint32_t preset = 0;
+        uint32_t midinote = 0;
+        char filename[MAX_FILENAME_LEN];
+        uint16_t len = parse_list_file_params(message, &preset, filename, sizeof(filename),
+                               &midinote);
+        if (filename[0] != '\0') {
+            #if (defined AMYBOARD) || (defined TULIP)
+                // Nothing to map on these; stream it from the MP "task", as zF does.
+                amy_global.transfer_stored_bytes = midinote;
+                strncpy(amy_global.transfer_filename, filename, MAX_FILENAME_LEN);
+                amy_global.transfer_file_handle = preset;
+                mp_sched_schedule(MP_OBJ_FROM_PTR(&tulip_pcm_load_file_obj), mp_const_none);
+            #else
+                pcm_map_file(preset, filename, midinote);
+            #endif
+        }
+        return len;
+    }
+    else if (cmd == 'R') {
+        // zR: read a WAV file on disk into RAM as a PCM preset that can be
+        // evicted under the sample RAM budget and read again.
+        // Params: Preset number, filename, midi note
+        uint32_t preset = 0;
+        uint32_t midinote = 0;
+        char filename[MAX_FILENAME_LEN];
+        uint16_t len = parse_list_file_params(message, &preset, filename, sizeof(filename),
+                               &midinote);
+        if (filename[0] != '\0') {
+            pcm_read_file(preset, filename, midinote);
+        }
+        return len;
+    }
+    else if (cmd == 'K') {
+        // zK: compress a PCM preset held in RAM (pcm_load's or zR's) to about
+        // half its size, in place.
+        // Params: Preset number
+        pcm_compress_preset((uint16_t)atoi(message));
+        return 1;
+    }
     else if (cmd == 'S') {
         // zS: sample from BUS[1] to a memorypcm patch. 
         // Params: Preset number,  bus, max length in frames,midinote,loopstart,loopend
@@ -698,9 +741,10 @@ size_t yield_event_from_message(char *message, amy_event *e, size_t pos) {
 }
 
 // Called from amy_add_message when the first char is 'H', indicating a ticks message.
-// It claims the rest of the message as its payload -- stored as a raw
-// wire string and only parsed when it comes due -- so a schedule command
-// is only ever honored as the first command of a message.
+// It claims the rest of the message as its payload -- handed to the sequencer
+// as a wire string, which it compiles to events if it can (see
+// sequencer_add_wire) -- so a schedule command is only ever honored as the
+// first command of a message.
 void handle_ticks_message(char *message) {
     assert(message[0] == 'H');
     uint32_t ticks[3] = {0, 0, 0};
@@ -720,6 +764,59 @@ void handle_ticks_message(char *message) {
     }
 }
 
+// True if parsing message does nothing but fill in events: none of its
+// commands acts as it's parsed (an immediate reset, a patch store, debug
+// output, a MIDI mapping or CV trigger, anything transfer-level).  The
+// sequencer parses such a message once, when it's stored, rather than every
+// time it fires.  This follows amy_parse_message's walk: every letter is a
+// command, except the sub-command letter after 'G', 'i', 'p' and 'w'.
+bool wire_message_parse_is_pure(const char *message) {
+    for (const char *p = message; *p; ++p) {
+        char cmd = *p;
+        if (!isalpha((unsigned char)cmd))  continue;
+        if (cmd == 'S' || cmd == 'u' || cmd == 'D' || cmd == 'z')  return false;
+        char sub = p[1];
+        if (cmd == 'i' && isalpha((unsigned char)sub)) {
+            if (sub == 'c' || sub == 'o' || sub == 'g')  return false;
+            ++p;
+        } else if ((cmd == 'G' && isalpha((unsigned char)sub))
+                   || (cmd == 'p' && (sub == 'o' || sub == 'F' || sub == 'S'))
+                   || (cmd == 'w' && sub == 'w')) {
+            ++p;
+        }
+    }
+    return true;
+}
+
+// RESET_AMY and RESET_EVENTS can only happen here, on the parse side,
+// because neither survives being carried IN a delta: RESET_AMY tears AMY down
+// and restarts it, and RESET_EVENTS empties the very queue the delta would be
+// sitting in.  Every other reset bit -- RESET_TIMEBASE included -- travels as
+// an ordinary delta, so it works identically from amy_add_event() and honours
+// time=/ticks= like the rest of the API.  Called for the wire string's 'S' and
+// for binary events.
+void handle_immediate_resets(amy_event *e) {
+    if (AMY_IS_UNSET(e->reset_osc) || !(e->reset_osc & (RESET_AMY | RESET_EVENTS)))  return;
+    if(e->reset_osc & RESET_AMY) {
+        amy_stop();
+        amy_start(amy_global.config);
+    }
+    if(e->reset_osc & RESET_EVENTS) {
+        // Under the lock: it drains the delta ring, which
+        // only whoever holds the lock may do.
+        amy_grab_lock();
+        amy_deltas_reset();
+        amy_release_lock();
+    }
+    // Clear only the bits handled here.  Unsetting the whole
+    // field dropped everything it was combined with, so e.g.
+    // RESET_EVENTS|RESET_ALL_OSCS silently skipped the osc
+    // reset.  Unset it entirely if nothing is left, since a
+    // reset_osc of 0 means "reset oscillator 0".
+    e->reset_osc &= ~(uint32_t)(RESET_AMY | RESET_EVENTS);
+    if (e->reset_osc == 0)  AMY_UNSET(e->reset_osc);
+}
+
 // given a string return a parsed event
 //
 // Transfer payloads never reach here: amy_add_message() traps them before
@@ -736,12 +833,13 @@ int amy_parse_message(char * message, amy_event *e) {
         char *arg = message + pos + 1;
         if(isalpha(cmd)) {
             switch(cmd) {
-            case 'a': parse_coef_message(arg, e->amp_coefs);break;
+            case 'a': parse_coef_message(arg, e->amp_coefs); AMY_EVENT_MARK(e, amp_coefs); break;
             case 'A': {
                 char bp_msg[MAX_PARAM_LEN];
                 copy_param_list_substring(bp_msg, arg);
                 parse_event_breakpoints(bp_msg, e->eg0_times, e->eg0_values);
                 e->bp_is_set[0] = 1;
+                AMY_EVENT_MARK(e, eg0_times);
                 break;
             }
             case 'B': {
@@ -749,15 +847,16 @@ int amy_parse_message(char * message, amy_event *e) {
                 copy_param_list_substring(bp_msg, arg);
                 parse_event_breakpoints(bp_msg, e->eg1_times, e->eg1_values);
                 e->bp_is_set[1] = 1;
+                AMY_EVENT_MARK(e, eg1_times);
                 break;
             }
-            case 'b': e->feedback = atoff(arg); break;
-            case 'c': e->chained_osc = atoi(arg); break;
+            case 'b': AMY_EVENT_SET(e, feedback, atoff(arg)); break;
+            case 'c': AMY_EVENT_SET(e, chained_osc, atoi(arg)); break;
             /* C available */
-            case 'd': parse_coef_message(arg, e->duty_coefs);break;
+            case 'd': parse_coef_message(arg, e->duty_coefs); AMY_EVENT_MARK(e, duty_coefs); break;
             case 'D': show_debug(atoi(arg)); break;
-            case 'f': parse_coef_message(arg, e->freq_coefs);break;
-            case 'F': parse_coef_message(arg, e->filter_freq_coefs); break;
+            case 'f': parse_coef_message(arg, e->freq_coefs); AMY_EVENT_MARK(e, freq_coefs); break;
+            case 'F': parse_coef_message(arg, e->filter_freq_coefs); AMY_EVENT_MARK(e, filter_freq_coefs); break;
             case 'G': pos += amy_parse_dist_layer_message(arg, e); break;  // Skip over second cmd letter, if any.
             /* g used for Alles for client # */
             // 'H' is the ticks= schedule command, it's caught in amy_add_message before this.
@@ -765,118 +864,96 @@ int amy_parse_message(char * message, amy_event *e) {
             case 'h': if (AMY_HAS_REVERB) {
                 float reverb_params[4];
                 parse_list_float(arg, reverb_params, 4, AMY_UNSET_VALUE(e->reverb_level));
-                e->reverb_level = reverb_params[0];
-                e->reverb_liveness = reverb_params[1];
-                e->reverb_damping = reverb_params[2];
-                e->reverb_xover_hz = reverb_params[3];
+                AMY_EVENT_SET(e, reverb_level, reverb_params[0]);
+                AMY_EVENT_SET(e, reverb_liveness, reverb_params[1]);
+                AMY_EVENT_SET(e, reverb_damping, reverb_params[2]);
+                AMY_EVENT_SET(e, reverb_xover_hz, reverb_params[3]);
             }
             break;
             /* i is used by alles for sync index -- but only for sync messages -- ok to use here but test */
             case 'i': pos += amy_parse_synth_layer_message(arg, e); break;  // Skip over second cmd letter, if any, or entire MIDI CC code string.
-            case 'I': e->ratio = atoff(arg); break;
-            case 'j': e->tempo = atoff(arg); break;
+            case 'I': AMY_EVENT_SET(e, ratio, atoff(arg)); break;
+            case 'j': AMY_EVENT_SET(e, tempo, atoff(arg)); break;
             // chorus.level
             case 'k': if(AMY_HAS_CHORUS) {
                 float chorus_params[4];
                 parse_list_float(arg, chorus_params, 4, AMY_UNSET_FLOAT);
-                e->chorus_level = chorus_params[0];
-                e->chorus_max_delay = chorus_params[1];
-                e->chorus_lfo_freq = chorus_params[2];
-                e->chorus_depth = chorus_params[3];
+                AMY_EVENT_SET(e, chorus_level, chorus_params[0]);
+                AMY_EVENT_SET(e, chorus_max_delay, chorus_params[1]);
+                AMY_EVENT_SET(e, chorus_lfo_freq, chorus_params[2]);
+                AMY_EVENT_SET(e, chorus_depth, chorus_params[3]);
             }
             break;
-            case 'K': e->patch_number = atoi(arg); break;
-            case 'l': e->velocity=atoff(arg); break;
-            case 'L': parse_mod_source(arg, e->mod_source); break;
-            case 'm': e->portamento_ms=atoi(arg); break;
+            case 'K': AMY_EVENT_SET(e, patch_number, atoi(arg)); break;
+            case 'l': AMY_EVENT_SET(e, velocity, atoff(arg)); break;
+            case 'L': parse_mod_source(arg, e->mod_source); AMY_EVENT_MARK(e, mod_source); break;
+            case 'm': AMY_EVENT_SET(e, portamento_ms, atoi(arg)); break;
             case 'M': if (AMY_HAS_ECHO) {
                 float echo_params[5];
                 parse_list_float(arg, echo_params, 5, AMY_UNSET_FLOAT);
-                e->echo_level = echo_params[0];
-                e->echo_delay_ms = echo_params[1];
-                e->echo_max_delay_ms = echo_params[2];
-                e->echo_feedback = echo_params[3];
-                e->echo_filter_coef = echo_params[4];
+                AMY_EVENT_SET(e, echo_level, echo_params[0]);
+                AMY_EVENT_SET(e, echo_delay_ms, echo_params[1]);
+                AMY_EVENT_SET(e, echo_max_delay_ms, echo_params[2]);
+                AMY_EVENT_SET(e, echo_feedback, echo_params[3]);
+                AMY_EVENT_SET(e, echo_filter_coef, echo_params[4]);
             }
             break;
-            case 'n': e->midi_note=atoff(arg); break;
-            case 'N': e->latency_ms = atoi(arg);  break;
-            case 'o': e->algorithm=atoi(arg); break;
-            case 'O': parse_algo_source(arg, e->algo_source); break;
+            case 'n': AMY_EVENT_SET(e, midi_note, atoff(arg)); break;
+            case 'N': AMY_EVENT_SET(e, latency_ms, atoi(arg));  break;
+            case 'o': AMY_EVENT_SET(e, algorithm, atoi(arg)); break;
+            case 'O': parse_algo_source(arg, e->algo_source); AMY_EVENT_MARK(e, algo_source); break;
             case 'p':
                 // 'p' is the preset/sampler layer: a bare number is the preset,
                 // a sub-letter addresses a PCM param.  Sampler params live here
                 // rather than at the top level because single letters are nearly
                 // exhausted (44 of 52 allocated) and this corner keeps growing.
                 if (arg[0] == 'o') {  // 'po' is PCM sample_offset.
-                    e->sample_offset = atoi(arg + 1);
+                    AMY_EVENT_SET(e, sample_offset, atoi(arg + 1));
                     ++pos;
                 } else if (arg[0] == 'F') {  // 'pF' is PCM fit (ticks).
-                    e->fit_ticks = atoff(arg + 1);
+                    AMY_EVENT_SET(e, fit_ticks, atoff(arg + 1));
                     ++pos;
                 } else if (arg[0] == 'S') {  // 'pS' is PCM fit grain search half-width.
-                    e->fit_search = atoi(arg + 1);
+                    AMY_EVENT_SET(e, fit_search, atoi(arg + 1));
                     ++pos;
                 } else {
-                    e->preset = atoi(arg);
+                    AMY_EVENT_SET(e, preset, atoi(arg));
                 }
                 break;
-            case 'P': e->trigger_phase=atoff(arg); break;
+            case 'P': AMY_EVENT_SET(e, trigger_phase, atoff(arg)); break;
             /* q unused */
-            case 'Q': parse_coef_message(arg, e->pan_coefs); break;
+            case 'Q': parse_coef_message(arg, e->pan_coefs); AMY_EVENT_MARK(e, pan_coefs); break;
             //case 'r': parse_voices(arg, e->voices); break;  // 'r' deprecated, you basically never control a voice directly from the API.  Planning to use it for multi-amyboard.
-            case 'R': e->resonance=atoff(arg); break;
-            case 's': e->pitch_bend = atoff(arg); break;
+            case 'R': AMY_EVENT_SET(e, resonance, atoff(arg)); break;
+            case 's': AMY_EVENT_SET(e, pitch_bend, atoff(arg)); break;
             case 'S':
-                e->reset_osc = atoi(arg);
-                // These two can only happen here, on the parse side, because
-                // neither survives being carried IN a delta: RESET_AMY tears
-                // AMY down and restarts it, and RESET_EVENTS empties the very
-                // queue the delta would be sitting in.  Every other reset bit
-                // -- RESET_TIMEBASE included -- travels as an ordinary delta,
-                // so it works identically from amy_add_event() and honours
-                // time=/ticks= like the rest of the API.
-                if (e->reset_osc & (RESET_AMY | RESET_EVENTS)) {
-                    if(e->reset_osc & RESET_AMY) {
-                        amy_stop();
-                        amy_start(amy_global.config);
-                    }
-                    if(e->reset_osc & RESET_EVENTS) {
-                        amy_deltas_reset();
-                    }
-                    // Clear only the bits handled here.  Unsetting the whole
-                    // field dropped everything it was combined with, so e.g.
-                    // RESET_EVENTS|RESET_ALL_OSCS silently skipped the osc
-                    // reset.  Unset it entirely if nothing is left, since a
-                    // reset_osc of 0 means "reset oscillator 0".
-                    e->reset_osc &= ~(uint32_t)(RESET_AMY | RESET_EVENTS);
-                    if (e->reset_osc == 0)  AMY_UNSET(e->reset_osc);
-                }
+                AMY_EVENT_SET(e, reset_osc, atoi(arg));
+                handle_immediate_resets(e);
                 break;
             /* t no longer used (was time=) */
-            case 'T': e->eg_type[0] = atoi(arg); break;
+            case 'T': e->eg_type[0] = atoi(arg); AMY_EVENT_MARK(e, eg_type); break;
             case 'u': patches_store_patch(e, arg); pos = strlen(message) - 1; break;  // patches_store_patch processes the patch as all the rest of the message and maybe sets patch.
             /* U used by Alles for sync */
             case 'v': e->osc=((atoi(arg)) % (AMY_OSCS+1));  break; // allow osc wraparound
-            case 'V': e->volume = atoff(arg); break;
+            case 'V': AMY_EVENT_SET(e, volume, atoff(arg)); break;
             case 'w': if (arg[0] == 'w') {  // 'ww' is wave submode.
-                    e->mode=atoi(arg + 1);
+                    AMY_EVENT_SET(e, mode, atoi(arg + 1));
                     ++pos;
                 } else {
-                    e->wave=atoi(arg);
+                    AMY_EVENT_SET(e, wave, atoi(arg));
                 }
                 break;
             /* W used by Tulip for CV, external_channel */
-            case 'X': e->eg_type[1] = atoi(arg); break;
+            case 'X': e->eg_type[1] = atoi(arg); AMY_EVENT_MARK(e, eg_type); break;
             case 'x': {
                   float eq[3] = {AMY_UNSET_VALUE(e->eq_l), AMY_UNSET_VALUE(e->eq_m), AMY_UNSET_VALUE(e->eq_h)};
                   parse_list_float(arg, eq, 3, AMY_UNSET_VALUE(e->eq_l));
-                  e->eq_l = eq[0];
-                  e->eq_m = eq[1];
-                  e->eq_h = eq[2];
+                  AMY_EVENT_SET(e, eq_l, eq[0]);
+                  AMY_EVENT_SET(e, eq_m, eq[1]);
+                  AMY_EVENT_SET(e, eq_h, eq[2]);
                 }
                 break;
-            case 'y': e->bus = atoi(arg); break;
+            case 'y': AMY_EVENT_SET(e, bus, atoi(arg)); break;
             case 'z': {
                 pos += amy_parse_transfer_layer_message(arg);
                 break;
@@ -899,3 +976,228 @@ int amy_parse_message(char * message, amy_event *e) {
     return pos;
 }
 
+
+
+/// Binary events
+//
+// A compact, versioned encoding of an amy_event, for hosts that generate
+// events at rates where parsing the wire string is the cost.  It carries the
+// same fields the wire string does, but no text: nothing to scan, no atoff.
+//
+//   byte 0      AMY_BINARY_EVENT_VERSION.  Never a letter, so a binary event
+//               can't be mistaken for a wire string.
+//   mask        which fields follow, one bit per entry of
+//               BINARY_EVENT_FIELDS, as a little-endian base-128 varint (7
+//               bits a byte, high bit set on all but the last).
+//   fields      each present field, in table order:
+//                 float      4 bytes, IEEE 754, little-endian
+//                 unsigned   varint
+//                 signed     zigzag varint (0, -1, 1, -2 .. -> 0, 1, 2, 3 ..)
+//                 array      a varint mask of the set elements, then each
+//                            set element as above.
+//
+// A field is present if it's set (AMY_IS_SET), so an unset field costs one
+// bit.  The fields a note-on uses come first so its mask is a single byte:
+// "v0n60l1" is 11 bytes.  A reader of this version rejects mask bits it
+// doesn't know, rather than guessing at their size.
+
+#define BINARY_EVENT_FIELDS(SCALAR, ARRAY)                                       \
+    SCALAR(time) SCALAR(osc) SCALAR(wave) SCALAR(midi_note) SCALAR(velocity)     \
+    SCALAR(synth) SCALAR(preset)                                                 \
+    ARRAY(amp_coefs, NUM_COMBO_COEFS) ARRAY(freq_coefs, NUM_COMBO_COEFS)         \
+    ARRAY(filter_freq_coefs, NUM_COMBO_COEFS) ARRAY(duty_coefs, NUM_COMBO_COEFS) \
+    ARRAY(pan_coefs, NUM_COMBO_COEFS) SCALAR(resonance) SCALAR(filter_type)      \
+    SCALAR(patch_number) SCALAR(mode) SCALAR(feedback) SCALAR(trigger_phase)     \
+    SCALAR(pitch_bend) SCALAR(ratio) SCALAR(portamento_ms)                       \
+    SCALAR(chained_osc) ARRAY(mod_source, NUM_MOD_SOURCES) SCALAR(algorithm)     \
+    ARRAY(algo_source, MAX_ALGO_OPS) ARRAY(bp_is_set, MAX_BREAKPOINT_SETS)       \
+    ARRAY(eg0_times, MAX_BPS) ARRAY(eg0_values, MAX_BPS)                         \
+    ARRAY(eg1_times, MAX_BPS) ARRAY(eg1_values, MAX_BPS)                         \
+    ARRAY(eg_type, MAX_BREAKPOINT_SETS)                                          \
+    SCALAR(sample_offset) SCALAR(fit_ticks) SCALAR(fit_search) SCALAR(volume)    \
+    SCALAR(tempo) SCALAR(latency_ms)                                             \
+    SCALAR(dist_type) SCALAR(dist_drive) SCALAR(dist_bits) SCALAR(dist_rate)     \
+    SCALAR(dist_mix)                                                             \
+    SCALAR(synth_flags) SCALAR(synth_level) SCALAR(synth_delay_ms)               \
+    SCALAR(to_synth) SCALAR(grab_midi_notes) SCALAR(pedal) SCALAR(num_voices)    \
+    SCALAR(oscs_per_voice) SCALAR(note_source_channel)                           \
+    ARRAY(ticks, 3) SCALAR(reset_osc) SCALAR(bus)                                \
+    SCALAR(eq_l) SCALAR(eq_m) SCALAR(eq_h)                                       \
+    SCALAR(echo_level) SCALAR(echo_delay_ms) SCALAR(echo_max_delay_ms)           \
+    SCALAR(echo_feedback) SCALAR(echo_filter_coef)                               \
+    SCALAR(chorus_level) SCALAR(chorus_max_delay) SCALAR(chorus_lfo_freq)        \
+    SCALAR(chorus_depth)                                                         \
+    SCALAR(reverb_level) SCALAR(reverb_liveness) SCALAR(reverb_damping)          \
+    SCALAR(reverb_xover_hz)
+
+#define _BINF_ENUM_SCALAR(FIELD) BINF_##FIELD,
+#define _BINF_ENUM_ARRAY(FIELD, LEN) BINF_##FIELD,
+enum { BINARY_EVENT_FIELDS(_BINF_ENUM_SCALAR, _BINF_ENUM_ARRAY) BINF_COUNT };
+#define BINF_MASK_WORDS ((BINF_COUNT + 31) / 32)
+
+typedef struct {
+    uint8_t *p;
+    uint8_t *end;
+    bool overflow;
+} bin_writer_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    bool bad;
+} bin_reader_t;
+
+static void bin_put_byte(bin_writer_t *w, uint8_t b) {
+    if (w->p < w->end)  *w->p++ = b;
+    else  w->overflow = true;
+}
+
+static void bin_put_varint(bin_writer_t *w, uint32_t v) {
+    while (v >= 0x80) {
+        bin_put_byte(w, (uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    bin_put_byte(w, (uint8_t)v);
+}
+
+static void bin_put_signed(bin_writer_t *w, int32_t v) {
+    bin_put_varint(w, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static void bin_put_float(bin_writer_t *w, float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    for (int i = 0; i < 4; ++i, u >>= 8)  bin_put_byte(w, (uint8_t)u);
+}
+
+#define BIN_PUT(W, VAL) _Generic((VAL),         \
+    float: bin_put_float,                       \
+    int16_t: bin_put_signed,                    \
+    int32_t: bin_put_signed,                    \
+    default: bin_put_varint)(W, VAL)
+
+static uint8_t bin_get_byte(bin_reader_t *r) {
+    if (r->p < r->end)  return *r->p++;
+    r->bad = true;
+    return 0;
+}
+
+static uint32_t bin_get_varint(bin_reader_t *r) {
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t b = bin_get_byte(r);
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))  return v;
+    }
+    r->bad = true;  // more than 32 bits' worth
+    return 0;
+}
+
+// Fetch a varint that has to fit in max.
+static uint32_t bin_get_varint_max(bin_reader_t *r, uint32_t max) {
+    uint32_t v = bin_get_varint(r);
+    if (v > max)  r->bad = true;
+    return v;
+}
+
+static void bin_get_u8(bin_reader_t *r, uint8_t *v) { *v = (uint8_t)bin_get_varint_max(r, UINT8_MAX); }
+static void bin_get_u16(bin_reader_t *r, uint16_t *v) { *v = (uint16_t)bin_get_varint_max(r, UINT16_MAX); }
+static void bin_get_u32(bin_reader_t *r, uint32_t *v) { *v = bin_get_varint(r); }
+
+static void bin_get_i16(bin_reader_t *r, int16_t *v) {
+    uint32_t z = bin_get_varint_max(r, UINT16_MAX);
+    *v = (int16_t)((z >> 1) ^ -(z & 1));
+}
+
+static void bin_get_float(bin_reader_t *r, float *f) {
+    uint32_t u = 0;
+    for (int i = 0; i < 4; ++i)  u |= (uint32_t)bin_get_byte(r) << (8 * i);
+    memcpy(f, &u, sizeof(u));
+}
+
+#define BIN_GET(R, PTR) _Generic((PTR),         \
+    float *: bin_get_float,                     \
+    int16_t *: bin_get_i16,                     \
+    uint8_t *: bin_get_u8,                      \
+    uint16_t *: bin_get_u16,                    \
+    uint32_t *: bin_get_u32)(R, PTR)
+
+#define _BIN_MASK_SET(MASK, BIT) (MASK)[(BIT) / 32] |= 1u << ((BIT) % 32)
+#define _BIN_MASK_HAS(MASK, BIT) ((MASK)[(BIT) / 32] & (1u << ((BIT) % 32)))
+
+#define _BIN_MARK_SCALAR(FIELD) if (AMY_IS_SET(e->FIELD))  _BIN_MASK_SET(mask, BINF_##FIELD);
+#define _BIN_MARK_ARRAY(FIELD, LEN)                                         \
+    for (int i = 0; i < (LEN); ++i) {                                       \
+        if (AMY_IS_SET(e->FIELD[i])) { _BIN_MASK_SET(mask, BINF_##FIELD); break; } \
+    }
+
+#define _BIN_PUT_SCALAR(FIELD) if (_BIN_MASK_HAS(mask, BINF_##FIELD))  BIN_PUT(&w, e->FIELD);
+#define _BIN_PUT_ARRAY(FIELD, LEN)                                          \
+    if (_BIN_MASK_HAS(mask, BINF_##FIELD)) {                                \
+        uint32_t elements = 0;                                              \
+        for (int i = 0; i < (LEN); ++i)                                     \
+            if (AMY_IS_SET(e->FIELD[i]))  elements |= 1u << i;              \
+        bin_put_varint(&w, elements);                                       \
+        for (int i = 0; i < (LEN); ++i)                                     \
+            if (elements & (1u << i))  BIN_PUT(&w, e->FIELD[i]);            \
+    }
+
+// Encode e into buf.  Returns the number of bytes written, or 0 if buf is too
+// small (AMY_BINARY_EVENT_MAX_LEN always suffices).
+size_t amy_event_to_binary(amy_event *e, uint8_t *buf, size_t len) {
+    uint32_t mask[BINF_MASK_WORDS] = {0};
+    BINARY_EVENT_FIELDS(_BIN_MARK_SCALAR, _BIN_MARK_ARRAY)
+    bin_writer_t w = { buf, buf + len, false };
+    bin_put_byte(&w, AMY_BINARY_EVENT_VERSION);
+    // The mask, 7 bits at a time, up to its last set bit.
+    int top = BINF_COUNT;
+    while (top > 0 && !_BIN_MASK_HAS(mask, top - 1))  --top;
+    int bit = 0;
+    do {
+        uint8_t b = 0;
+        for (int i = 0; i < 7 && bit < top; ++i, ++bit)
+            if (_BIN_MASK_HAS(mask, bit))  b |= 1 << i;
+        bin_put_byte(&w, b | ((bit < top) ? 0x80 : 0));
+    } while (bit < top);
+    BINARY_EVENT_FIELDS(_BIN_PUT_SCALAR, _BIN_PUT_ARRAY)
+    if (w.overflow)  return 0;
+    return (size_t)(w.p - buf);
+}
+
+#define _BIN_GET_SCALAR(FIELD)                                              \
+    if (_BIN_MASK_HAS(mask, BINF_##FIELD)) {                                \
+        BIN_GET(&r, &e->FIELD);                                             \
+        AMY_EVENT_MARK(e, FIELD);                                           \
+    }
+#define _BIN_GET_ARRAY(FIELD, LEN)                                          \
+    if (_BIN_MASK_HAS(mask, BINF_##FIELD)) {                                \
+        uint32_t elements = bin_get_varint_max(&r, (1u << (LEN)) - 1);      \
+        for (int i = 0; i < (LEN); ++i)                                     \
+            if (elements & (1u << i))  BIN_GET(&r, &e->FIELD[i]);           \
+        AMY_EVENT_MARK(e, FIELD);                                           \
+    }
+
+// Decode a binary event from buf into e, which is cleared (sparse) first.  Returns the
+// number of bytes it took up, or -1 if it isn't one this version can read (a
+// different version, fields it doesn't know, or cut short).  osc wraps as it
+// does for the wire string's 'v'.
+int amy_binary_to_event(const uint8_t *buf, size_t len, amy_event *e) {
+    amy_clear_event_sparse(e);
+    bin_reader_t r = { buf, buf + len, false };
+    if (bin_get_byte(&r) != AMY_BINARY_EVENT_VERSION)  return -1;
+    uint32_t mask[BINF_MASK_WORDS] = {0};
+    int bit = 0;
+    uint8_t b;
+    do {
+        b = bin_get_byte(&r);
+        for (int i = 0; i < 7; ++i, ++bit) {
+            if (!(b & (1 << i)))  continue;
+            if (bit >= BINF_COUNT)  return -1;
+            _BIN_MASK_SET(mask, bit);
+        }
+    } while ((b & 0x80) && !r.bad);
+    BINARY_EVENT_FIELDS(_BIN_GET_SCALAR, _BIN_GET_ARRAY)
+    if (r.bad)  return -1;
+    if (AMY_IS_SET(e->osc))  e->osc = e->osc % (AMY_OSCS + 1);
+    return (int)(r.p - buf);
+}
@@ -23,7 +23,12 @@ uint16_t next_user_patch_index = 0;
 uint16_t * osc_to_voice = NULL;
 uint16_t *voice_to_base_osc = NULL;
 
+// The builtin patch cache, below.
+static void patch_cache_init(uint32_t slots);
+static void patch_cache_deinit(void);
+
 void patches_deinit() {
+    patch_cache_deinit();
     memory_patch_deltas = NULL;
     memory_patch_oscs = NULL;
     memory_patch_auto = NULL;
@@ -48,6 +53,7 @@ void patches_init(int max_memory_patches) {
     memory_patch_auto = (uint8_t *)(voice_to_base_osc + amy_global.config.max_voices);
     bzero(memory_patch_deltas, max_num_memory_patches * sizeof(struct delta *));
     bzero(memory_patch_auto, max_num_memory_patches * sizeof(uint8_t));
+    patch_cache_init(amy_global.config.max_cached_patches);
     patches_reset();
 }
 
@@ -391,7 +397,9 @@ int sprint_event(amy_event *e, char *s, size_t len, bool wirecode) {
     }
     _EPRINT_F(dist_drive, "dist_drive", "GD");
     _EPRINT_F(dist_mix, "dist_mix", "GM");
-    _EPRINT_I_SEQ(bp_is_set, "bp_is_set", MAX_BREAKPOINT_SETS, "??");
+    // bp_is_set has no wire code of its own: 'A' and 'B' set it.  Printing
+    // it as "??" left junk in the wire string for the parser to trip over.
+    if (!wirecode)  _EPRINT_I_SEQ(bp_is_set, "bp_is_set", MAX_BREAKPOINT_SETS, "");
     // Convert these two at least to vectors of ints, save several hundred bytes
     _EPRINT_I_SEQ(algo_source, "algo_source", MAX_ALGO_OPS, "O");
     _EPRINT_BP(eg0_times, eg0_values, "eg0", "A");
@@ -736,6 +744,7 @@ void set_event_for_osc(int base_osc, int rel_osc, struct amy_event *event) {
         empty_synth.breakpoint_times[i] = times + i * MAX_BREAKPOINTS;
         empty_synth.breakpoint_values[i] = values + i * MAX_BREAKPOINTS;
    }
+    empty_synth.stretch = NULL;
     reset_osc_by_pointer(&empty_synth, /* msynth */ NULL);
     // Go through parameter fields picking out the ones that are nondefault.
     EVENT_FROM_OSC(wave);
@@ -930,11 +939,11 @@ void parse_patch_string_to_queue(char *message, int base_osc, uint16_t oscs_per_
     // whatever the string last said, not what we were told before it ran.
     uint16_t voice_oscs = oscs_per_voice;
     do {
-        amy_clear_event(&e);
+        amy_clear_event_sparse(&e);
         e.time = time;
         if (message[pos] == 'i') {
             // It's a synth-layer message, it needs a synth defined.
-            e.synth = synth;
+            AMY_EVENT_SET(&e, synth, synth);
         }
         pos = yield_event_from_message(message, &e, pos);
         if (pos > 0) {
@@ -949,13 +958,198 @@ void parse_patch_string_to_queue(char *message, int base_osc, uint16_t oscs_per_
             // to the default bus 0.  Give it the synth being loaded and
             // the bus resolves from the synth, exactly as if the synth
             // had sent it itself.
-            if (event_addresses_bus(&e))  e.synth = synth;
+            if (event_addresses_bus(&e))  AMY_EVENT_SET(&e, synth, synth);
             if (event_addresses_oscs(&e) || is_first_voice)
                 amy_event_to_deltas_queue(&e, base_osc, voice_oscs, queue);
         }
     } while (pos > 0);
 }
 
+///////////////////////////////////////
+// The builtin patch cache
+//
+// Loading a builtin patch parsed its wire string once per voice, so a program
+// change on a 6-voice Juno synth ran the text parser six times over the same
+// few hundred characters.  Now the first load of one parses it into a
+// voice-relative list of deltas, kept in one of max_cached_patches slots (the
+// least recently loaded goes first), and each voice of each load after that
+// gets the list with base_osc added, as a stored memory patch does.
+//
+// Only patches of osc commands, plus bus-FX commands that name no oscs (the
+// Juno patches' trailing "x...k..." phrase, which goes to the first voice
+// only), are cached.  A patch that reaches the synth layer (the drum kits open
+// with "if3iv1in38Z") is parsed every time, as before.  Which deltas get
+// base_osc added isn't worked out here: the patch is parsed at base 0 and at
+// base 1, and the difference says -- so the cache can't drift from what parsing
+// does.
+
+#define PATCH_DELTA_REBASE 1  // data is one of the voice's oscs, so gets base_osc added
+#define PATCH_DELTA_BUS 2  // osc is the synth's bus, not one of the voice's oscs
+#define PATCH_DELTA_FIRST_VOICE 4  // from a command that names no oscs: the first voice only
+
+typedef struct {
+    union d data;
+    uint16_t osc;
+    uint8_t param;
+    uint8_t flags;
+} patch_delta_t;
+
+typedef struct {
+    uint16_t patch_number;  // AMY_UNSET for a free slot
+    uint16_t oscs_per_voice;
+    uint32_t len;
+    uint32_t last_used;
+    patch_delta_t *deltas;
+} patch_cache_slot_t;
+
+static patch_cache_slot_t *patch_cache = NULL;
+static uint32_t patch_cache_slots = 0;
+static uint32_t patch_cache_clock = 0;
+// Builtin patches found not to be cacheable, so they aren't tried again.
+static uint8_t patch_uncacheable[(_PATCHES_NUM_BUILTIN + 7) / 8];
+
+static void patch_cache_init(uint32_t slots) {
+    bzero(patch_uncacheable, sizeof(patch_uncacheable));
+    patch_cache_clock = 0;
+    patch_cache_slots = 0;
+    patch_cache = NULL;
+    if (slots == 0)  return;
+    patch_cache = (patch_cache_slot_t *)malloc_caps(slots * sizeof(patch_cache_slot_t), amy_global.config.ram_caps_synth);
+    if (patch_cache == NULL)  return;  // no cache, only slower loads
+    patch_cache_slots = slots;
+    for (uint32_t i = 0; i < slots; ++i) {
+        AMY_UNSET(patch_cache[i].patch_number);
+        patch_cache[i].deltas = NULL;
+    }
+}
+
+static void patch_cache_deinit(void) {
+    for (uint32_t i = 0; i < patch_cache_slots; ++i)  free(patch_cache[i].deltas);
+    free(patch_cache);
+    patch_cache = NULL;
+    patch_cache_slots = 0;
+}
+
+// Parse message into deltas, as parse_patch_string_to_queue would for the
+// first voice, into *out (which the caller frees).  Returns how many, or -1 if
+// the patch can't be cached.
+static int32_t parse_patch_for_cache(const char *message, uint16_t oscs_per_voice, uint8_t synth, patch_delta_t **out) {
+    amy_event e;
+    size_t pos = 0;
+    uint32_t len = 0, room = 0;
+    patch_delta_t *deltas = NULL;
+    do {
+        // A synth-layer command (or the osc count it could set) can't be replayed.
+        if (message[pos] == 'i')  goto fail;
+        amy_clear_event_sparse(&e);
+        e.time = 0;
+        pos = yield_event_from_message((char *)message, &e, pos);
+        if (pos == 0)  break;
+        if (event_addresses_synth(&e) || AMY_IS_SET(e.patch_number) || AMY_IS_SET(e.bus))  goto fail;
+        bool names_oscs = event_addresses_oscs(&e);
+        if (event_addresses_bus(&e)) {
+            if (names_oscs)  goto fail;
+            AMY_EVENT_SET(&e, synth, synth);
+        }
+        struct delta *at0 = NULL, *at1 = NULL;
+        amy_event_to_deltas_queue(&e, 0, oscs_per_voice, &at0);
+        amy_event_to_deltas_queue(&e, 1, oscs_per_voice, &at1);
+        bool ok = true;
+        for (struct delta *d0 = at0, *d1 = at1; ok && (d0 || d1); d0 = d0->next, d1 = d1->next) {
+            if (d0 == NULL || d1 == NULL || d0->param != d1->param || d0->param > UINT8_MAX) {
+                ok = false;
+                break;
+            }
+            if (len == room) {
+                room = room ? 2 * room : 64;
+                patch_delta_t *more = (patch_delta_t *)malloc_caps(room * sizeof(patch_delta_t), amy_global.config.ram_caps_synth);
+                if (more == NULL) {
+                    ok = false;
+                    break;
+                }
+                if (deltas)  memcpy(more, deltas, len * sizeof(patch_delta_t));
+                free(deltas);
+                deltas = more;
+            }
+            patch_delta_t *pd = &deltas[len++];
+            pd->data = d0->data;
+            pd->osc = d0->osc;
+            pd->param = (uint8_t)d0->param;
+            pd->flags = names_oscs ? 0 : PATCH_DELTA_FIRST_VOICE;
+            if (d1->osc == d0->osc && !names_oscs)  pd->flags |= PATCH_DELTA_BUS;
+            else if (d1->osc != d0->osc + 1)  ok = false;
+            if (d1->data.i == d0->data.i + 1)  pd->flags |= PATCH_DELTA_REBASE;
+            else if (d1->data.i != d0->data.i)  ok = false;
+        }
+        amy_grab_lock();
+        delta_release_list(at0);
+        delta_release_list(at1);
+        amy_release_lock();
+        if (!ok)  goto fail;
+    } while (pos > 0);
+    *out = deltas;
+    return (int32_t)len;
+fail:
+    free(deltas);
+    return -1;
+}
+
+// The cache slot holding patch_number, parsing it into one if need be; NULL
+// if it can't be cached.
+static patch_cache_slot_t *patch_cache_slot(uint16_t patch_number, uint16_t oscs_per_voice, uint8_t synth) {
+    if (patch_cache_slots == 0 || patch_number >= _PATCHES_NUM_BUILTIN || patch_commands[patch_number] == NULL
+        || (patch_uncacheable[patch_number / 8] & (1 << (patch_number % 8))))
+        return NULL;
+    patch_cache_slot_t *oldest = &patch_cache[0];
+    for (uint32_t i = 0; i < patch_cache_slots; ++i) {
+        patch_cache_slot_t *slot = &patch_cache[i];
+        if (slot->patch_number == patch_number && slot->oscs_per_voice == oscs_per_voice) {
+            slot->last_used = ++patch_cache_clock;
+            return slot;
+        }
+        if (AMY_IS_UNSET(slot->patch_number))  oldest = slot;  // a free one beats any
+        else if (AMY_IS_SET(oldest->patch_number) && slot->last_used < oldest->last_used)  oldest = slot;
+    }
+    patch_delta_t *deltas = NULL;
+    int32_t len = parse_patch_for_cache(patch_commands[patch_number], oscs_per_voice, synth, &deltas);
+    if (len < 0) {
+        patch_uncacheable[patch_number / 8] |= (1 << (patch_number % 8));
+        return NULL;
+    }
+    free(oldest->deltas);
+    oldest->patch_number = patch_number;
+    oldest->oscs_per_voice = oscs_per_voice;
+    oldest->len = (uint32_t)len;
+    oldest->deltas = deltas;
+    oldest->last_used = ++patch_cache_clock;
+    return oldest;
+}
+
+bool patches_builtin_to_queue(uint16_t patch_number, int base_osc, uint16_t oscs_per_voice, struct delta **queue, uint8_t synth, uint32_t time, bool is_first_voice) {
+    patch_cache_slot_t *slot = patch_cache_slot(patch_number, oscs_per_voice, synth);
+    if (slot == NULL)  return false;
+    // The bus a bus-FX command goes to, resolved as amy_event_to_deltas_queue does.
+    uint16_t bus = amy_validate_bus((AMY_IS_SET(synth) && instrument_get_bus(synth) >= 0) ? instrument_get_bus(synth) : AMY_DEFAULT_BUS);
+    struct delta d;
+    d.time = time;
+    d.next = NULL;
+    for (uint32_t i = 0; i < slot->len; ++i) {
+        patch_delta_t *pd = &slot->deltas[i];
+        if ((pd->flags & PATCH_DELTA_FIRST_VOICE) && !is_first_voice)  continue;
+        d.param = (enum params)pd->param;
+        d.data = pd->data;
+        if (pd->flags & PATCH_DELTA_REBASE)  d.data.i += base_osc;
+        if (pd->flags & PATCH_DELTA_BUS) {
+            d.osc = bus;
+            if (bus > amy_global.highest_bus)  amy_global.highest_bus = bus;
+        } else {
+            d.osc = pd->osc + base_osc;
+        }
+        add_delta_to_queue(&d, queue);
+    }
+    return true;
+}
+
 // So emscripten knows how big to make this struct.
 int size_of_amy_event(void) {
     return sizeof(amy_event);
@@ -976,12 +1170,12 @@ void patches_store_patch(amy_event *e, char * patch_string) {
         // store.
         for (uint32_t i = 0; i < max_num_memory_patches; ++i) {
             if (memory_patch_deltas[i] == NULL && memory_patch_oscs[i] == 0) {
-                e->patch_number = i + _PATCHES_FIRST_USER_PATCH;
+                AMY_EVENT_SET(e, patch_number, i + _PATCHES_FIRST_USER_PATCH);
                 break;
             }
         }
         if (!AMY_IS_SET(e->patch_number))
-            e->patch_number = _PATCHES_FIRST_USER_PATCH + max_num_memory_patches;
+            AMY_EVENT_SET(e, patch_number, _PATCHES_FIRST_USER_PATCH + max_num_memory_patches);
         //fprintf(stderr, "store_patch: auto-assigning patch number %d for '%s'\n", e->patch_number, patch_string);
     }
     int patch_index = (int)e->patch_number - _PATCHES_FIRST_USER_PATCH;
@@ -1073,7 +1267,7 @@ void patches_grab_synth_tier(amy_event *e) {
     if (AMY_IS_SET(e->to_synth)) {
         // This involves moving the instrument number.
         instrument_change_number(e->synth, e->to_synth);
-        e->synth = e->to_synth;
+        AMY_EVENT_SET(e, synth, e->to_synth);
         AMY_UNSET(e->to_synth);
         // Then continue handling any other args.
     }
@@ -1121,7 +1315,7 @@ uint8_t patches_voices_for_event(amy_event *e, uint16_t voices[]) {
         // A sustain release can result in note-off events for multiple voices.
         num_voices = instrument_sustain(e->synth, sustain, voices);
         if (num_voices) {
-            e->velocity = 0;
+            AMY_EVENT_SET(e, velocity, 0);
         }
         //fprintf(stderr, "synth %d pedal %d num_voices %d\n", e->synth, e->pedal, num_voices);
     } else if (AMY_IS_SET(e->velocity)) {
@@ -1272,6 +1466,20 @@ void schedule_osc_free(uint32_t time, uint16_t osc, struct delta **queue) {
     add_delta_to_queue(&d, queue);
 }
 
+// Queue the copying of a configured voice's oscs into another voice's (see
+// clone_voice_oscs in amy.c).  It has to come after the deltas that configure
+// the source voice, at the same time.
+void schedule_voice_clone(uint32_t time, uint16_t to_base, uint16_t from_base, uint16_t num_oscs) {
+    struct delta d = {
+        .time = time,
+        .osc = to_base,
+        .param = CLONE_OSC,
+        .data.i = from_base | ((uint32_t)num_oscs << 16),
+        .next = NULL,
+    };
+    add_delta_to_queue(&d, &amy_global.delta_queue);
+}
+
 void release_voice_oscs(int32_t voice, uint32_t time) {
     if(AMY_IS_SET(voice_to_base_osc[voice])) {
         //fprintf(stderr, "Already set voice %d, removing it\n", voice);
@@ -1396,7 +1604,7 @@ void patches_load_patch(amy_event *e) {
     // patches_event_has_voices) re-route exactly as an explicit bus would.
     if (AMY_IS_UNSET(e->bus) && instrument_number_exists(e->synth, NULL)) {
         int prev_bus = instrument_get_bus(e->synth);
-        if (prev_bus > 0) e->bus = (uint16_t)prev_bus;
+        if (prev_bus > 0) AMY_EVENT_SET(e, bus, (uint16_t)prev_bus);
     }
     uint16_t voices[MAX_VOICES_PER_INSTRUMENT];
     uint8_t num_voices = 0;
@@ -1575,16 +1783,32 @@ void patches_load_patch(amy_event *e) {
         if (auto_patch)  AMY_UNSET(stored_patch_number);
         instrument_add_new(e->synth, num_voices, voices, stored_patch_number, oscs_per_voice, bus, flags);
     }
-    // Now actually initialize the newly-allocated osc blocks with the patch
+    // Now actually initialize the newly-allocated osc blocks with the patch.
+    // Only the first voice plays the patch's deltas; the others are copied
+    // from it once it's configured, which for a many-voice synth is much
+    // less work than playing them all again per voice.
+    // (Unless playing the first voice's patch re-shaped the synth -- the drum
+    // kits do -- and the voices are no longer where they were; then the rest
+    // play it too, as they always did.)
     bool is_first_voice = true;  // flag for once-only messages.
+    uint16_t template_voice = 0, template_base_osc = 0;
     for(uint8_t v = 0; v < num_voices; v++) {
         if(AMY_IS_SET(voice_to_base_osc[voices[v]])) {
-            if (deltas) {
-                add_deltas_to_queue_with_baseosc(deltas, voice_to_base_osc[voices[v]], oscs_per_voice, &amy_global.delta_queue, e->time);
+            uint16_t base_osc = voice_to_base_osc[voices[v]];
+            if (!is_first_voice && (deltas || message)
+                && osc_to_voice[template_base_osc] == template_voice && osc_to_voice[base_osc] == voices[v]) {
+                schedule_voice_clone(e->time, base_osc, template_base_osc, oscs_per_voice);
+            } else if (deltas) {
+                add_deltas_to_queue_with_baseosc(deltas, base_osc, oscs_per_voice, &amy_global.delta_queue, e->time);
             } else if (message) {
-                parse_patch_string_to_queue(message, voice_to_base_osc[voices[v]], oscs_per_voice, &amy_global.delta_queue, e->synth, e->time, is_first_voice);
+                if (!patches_builtin_to_queue(patch_number, base_osc, oscs_per_voice, &amy_global.delta_queue, e->synth, e->time, is_first_voice))
+                    parse_patch_string_to_queue(message, base_osc, oscs_per_voice, &amy_global.delta_queue, e->synth, e->time, is_first_voice);
             }
             // Or maybe there's no deltas and no message, in which case we just set oscs_per_voice, waiting for config.
+            if (is_first_voice) {
+                template_voice = voices[v];
+                template_base_osc = base_osc;
+            }
             is_first_voice = false;
         }
     }
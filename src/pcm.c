@@ -12,6 +12,25 @@
 #define free(a) qspi_free(a)
 #endif
 
+#ifdef AMY_PCM_STREAM_THREAD
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#endif
+
+// Presets evicted under the sample RAM budget are read back off the render
+// thread wherever the compiler has C11 atomics (see "Sample RAM budget").
+#if !defined(__STDC_NO_ATOMICS__) && !defined(AMY_NO_PCM_RELOADER)
+#define AMY_PCM_RELOADER
+#include <stdatomic.h>
+#endif
+
+#ifdef AMY_PCM_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 
 // This is for any in-memory PCM samples.
 typedef struct {
@@ -20,7 +39,20 @@ typedef struct {
     uint8_t channels;
     uint32_t file_handle;
     uint32_t file_bytes_remaining;
+    // A file preset's read-ahead, when it has a reader thread; NULL means the
+    // render thread reads the file itself.
+    struct pcm_stream *stream;
+    // A MAPPED preset's mapping of its whole file; sample_ram points into it.
+    void *map;
+    size_t map_bytes;
+    // When it was last played, for choosing what to evict under the sample
+    // RAM budget (see "Sample RAM budget").
+    uint32_t last_used;
     int16_t * sample_ram;
+    // A compressed preset's frames, in place of sample_ram (which is NULL):
+    // see "Compressed presets".
+    const int8_t *codes;
+    const uint8_t *shifts;
     uint32_t length;
     uint32_t loopstart;
     uint32_t loopend;
@@ -29,15 +61,155 @@ typedef struct {
     float log2sr;
 } memorypcm_preset_t;
 
-// linked list of memorypcm presets
+// memorypcm presets, indexed by preset number: each bucket of the index is a
+// linked list of the presets whose numbers hash to it, so finding one walks a
+// list of (usually) one, not every preset loaded.
 typedef struct memorypcm_ll_t{
     memorypcm_preset_t *preset;
     struct memorypcm_ll_t *next;
     uint16_t preset_number;
+    bool in_use;  // scratch, while choosing what to evict
 } memorypcm_ll_t;
 
+#define PCM_PRESET_INDEX_SIZE 64  // power of 2
+static memorypcm_ll_t *memorypcm_index[PCM_PRESET_INDEX_SIZE];
+// Stamps last_used, for the budget's least recently played.
+static uint32_t pcm_use_clock;
+
+static inline memorypcm_ll_t **pcm_index_bucket(uint16_t preset_number) {
+    return &memorypcm_index[preset_number & (PCM_PRESET_INDEX_SIZE - 1)];
+}
+
+static memorypcm_ll_t *pcm_index_find(uint16_t preset_number) {
+    for (memorypcm_ll_t *entry = *pcm_index_bucket(preset_number); entry != NULL; entry = entry->next) {
+        if (entry->preset_number == preset_number)  return entry;
+    }
+    return NULL;
+}
+
+// Once its preset is filled in, as the most recently used: under the queue
+// lock, an eviction can be walking the index from the render side (see
+// "Sample RAM budget").
+static void pcm_index_insert(memorypcm_ll_t *entry, uint16_t preset_number) {
+    amy_grab_lock();
+    memorypcm_ll_t **bucket = pcm_index_bucket(preset_number);
+    entry->preset_number = preset_number;
+    entry->in_use = false;
+    entry->preset->last_used = ++pcm_use_clock;
+    entry->next = *bucket;
+    *bucket = entry;
+    amy_release_lock();
+}
+
+// A preset read from its file into RAM (pcm_read_file), whose frames can be
+// let go of and read again.
+static inline bool preset_is_reloadable(const memorypcm_preset_t *preset) {
+    return preset->type == AMY_PCM_TYPE_MEMORY && preset->filename[0] != '\0';
+}
+
+// Which values a frame read gives: a mono preset's frames, one channel of a
+// stereo one's (PCM_LEFT, PCM_RIGHT), or both mixed (PCM).
+enum { PCM_LAYOUT_MONO, PCM_LAYOUT_LEFT, PCM_LAYOUT_RIGHT, PCM_LAYOUT_MIX };
 
-memorypcm_ll_t * memorypcm_ll_start;
+static inline uint8_t pcm_layout(uint8_t channels, uint16_t wave) {
+    if (channels != 2)  return PCM_LAYOUT_MONO;
+    if (wave == PCM_LEFT)  return PCM_LAYOUT_LEFT;
+    if (wave == PCM_RIGHT)  return PCM_LAYOUT_RIGHT;
+    return PCM_LAYOUT_MIX;
+}
+
+static inline LUTSAMPLE pcm_frame(const LUTSAMPLE *table, uint32_t index, uint8_t layout) {
+    switch (layout) {
+        case PCM_LAYOUT_LEFT:  return table[index * 2];
+        case PCM_LAYOUT_RIGHT:  return table[index * 2 + 1];
+        case PCM_LAYOUT_MIX:  return (LUTSAMPLE)(((int32_t)table[index * 2] + (int32_t)table[index * 2 + 1]) / 2);
+        default:  return table[index];
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Compressed presets.
+//
+// A compressed preset (pcm_compress_preset, 'zK', or a ROM set amy.headers
+// emitted compressed) keeps each sample as an 8-bit code, and one shift for
+// each PCM_C8_BLOCK frames (shared by both channels of a stereo one); the
+// sample is code << shift.  The shift is the smallest that gets the block's
+// samples into codes, so a loud block keeps its top 8 bits and a quiet one
+// keeps more of its detail, in about half the RAM of int16 frames.
+//
+// ADPCM would take a quarter, but each of its samples depends on the ones
+// before it, so reaching a frame means decoding up to it from a block's
+// start.  Here every frame decodes on its own, from its code and its
+// block's shift: loops, pcm_find_next_zero_crossing's search, retriggers
+// and the fit stretcher's grains all read anywhere, as they do int16
+// frames, and render_pcm's kernels decode as they interpolate, with no
+// table or state (pcm_simd.h gathers codes and shifts as it does frames).
+//
+// The codes run PCM_C8_PAD bytes past the last frame's, and the shifts
+// PCM_C8_PAD past the last block's, so the vector kernels can read whole
+// 32-bit words at a frame.
+
+static inline LUTSAMPLE pcm_c8_sample(const int8_t *codes, uint8_t shift, uint32_t i) {
+    return (LUTSAMPLE)((int32_t)codes[i] * (1 << shift));
+}
+
+static inline LUTSAMPLE pcm_frame_c8(const int8_t *codes, const uint8_t *shifts, uint32_t index, uint8_t layout) {
+    uint8_t shift = shifts[index / PCM_C8_BLOCK];
+    switch (layout) {
+        case PCM_LAYOUT_LEFT:  return pcm_c8_sample(codes, shift, index * 2);
+        case PCM_LAYOUT_RIGHT:  return pcm_c8_sample(codes, shift, index * 2 + 1);
+        case PCM_LAYOUT_MIX:
+            return (LUTSAMPLE)(((int32_t)pcm_c8_sample(codes, shift, index * 2)
+                                + (int32_t)pcm_c8_sample(codes, shift, index * 2 + 1)) / 2);
+        default:  return pcm_c8_sample(codes, shift, index);
+    }
+}
+
+// A frame of any in-memory preset, compressed or not.
+static inline LUTSAMPLE pcm_preset_frame(const memorypcm_preset_t *preset, uint32_t index, uint8_t layout) {
+    if (preset->codes != NULL)  return pcm_frame_c8(preset->codes, preset->shifts, index, layout);
+    return pcm_frame(preset->sample_ram, index, layout);
+}
+
+static inline bool preset_has_frames(const memorypcm_preset_t *preset) {
+    return preset->sample_ram != NULL || preset->codes != NULL;
+}
+
+static inline uint32_t pcm_c8_blocks(uint32_t length) {
+    return (length + PCM_C8_BLOCK - 1) / PCM_C8_BLOCK;
+}
+
+// Bytes of codes and shifts, pads included, for `length` frames.
+static inline uint32_t pcm_c8_bytes(uint32_t length, uint8_t channels) {
+    return length * channels + PCM_C8_PAD + pcm_c8_blocks(length) + PCM_C8_PAD;
+}
+
+// Encode `length` frames of int16 into codes and shifts (sized as
+// pcm_c8_bytes says): each block takes the smallest shift its samples fit
+// under, and each sample its nearest code.
+static void pcm_c8_encode(const int16_t *frames, uint32_t length, uint8_t channels,
+                          int8_t *codes, uint8_t *shifts) {
+    for (uint32_t block = 0; block < pcm_c8_blocks(length); ++block) {
+        uint32_t first = block * PCM_C8_BLOCK * channels;
+        uint32_t end = MIN(length, (block + 1) * PCM_C8_BLOCK) * channels;
+        int32_t lowest = 0, highest = 0;
+        for (uint32_t i = first; i < end; ++i) {
+            lowest = MIN(lowest, (int32_t)frames[i]);
+            highest = MAX(highest, (int32_t)frames[i]);
+        }
+        // No more than 8, where all of int16 fits.
+        uint8_t shift = 0;
+        while (shift < 8 && ((highest >> shift) > 127 || (lowest >> shift) < -128))  ++shift;
+        shifts[block] = shift;
+        int32_t half = (1 << shift) >> 1;
+        for (uint32_t i = first; i < end; ++i) {
+            int32_t code = ((int32_t)frames[i] + half) >> shift;
+            codes[i] = (int8_t)MAX(-128, MIN(127, code));
+        }
+    }
+    memset(codes + length * channels, 0, PCM_C8_PAD);
+    memset(shifts + pcm_c8_blocks(length), 0, PCM_C8_PAD);
+}
 
 #define PCM_AMY_LOG2_SAMPLE_RATE log2f(PCM_AMY_SAMPLE_RATE / ZERO_LOGFREQ_IN_HZ)
 
@@ -57,14 +229,14 @@ void amy_set_gamma9001_pcm(const int16_t * data) {
 memorypcm_preset_t * get_preset_for_preset_number(uint16_t preset_number,
                                                   memorypcm_preset_t *rom_local) {
     // Get the memory preset. If we can't find it, it could be a ROM preset. So copy params in from ROM preset
-    memorypcm_ll_t *preset = memorypcm_ll_start;
-    while(preset != NULL) {
-        if(preset->preset_number == preset_number) {
-            if(preset->preset->sample_ram != NULL || preset->preset->file_handle > 0) {
-                return preset->preset;
-            }
+    memorypcm_ll_t *preset = pcm_index_find(preset_number);
+    if (preset != NULL) {
+        // An evicted preset is still this preset, though it has no frames
+        // until pcm_note_on reads them back.
+        if (preset_has_frames(preset->preset) || preset->preset->file_handle > 0
+            || preset_is_reloadable(preset->preset)) {
+            return preset->preset;
         }
-        preset = preset->next;
     }
 
 #ifdef GAMMA9001
@@ -105,7 +277,12 @@ memorypcm_preset_t * get_preset_for_preset_number(uint16_t preset_number,
         length = PCM_LENGTH - offset;
     }
 #endif
-    rom_local->sample_ram = (int16_t*)pcm + offset;
+    if (preset_number < pcm_c8_rom_samples) {
+        rom_local->codes = pcm_c8_rom_codes + offset;
+        rom_local->shifts = pcm_c8_rom_shifts + offset / PCM_C8_BLOCK;
+    } else {
+        rom_local->sample_ram = (int16_t*)pcm + offset;
+    }
     rom_local->length = length;
     rom_local->loopstart = cpreset.loopstart;
     rom_local->loopend = cpreset.loopend;
@@ -132,6 +309,7 @@ const int16_t *pcm_get_sample_ram_for_preset(uint16_t preset_number, uint32_t *l
     if (preset == NULL) {
         return NULL;
     }
+    // (NULL for a compressed one, which has no int16 frames to give.)
     return preset->sample_ram;
 }
 
@@ -142,8 +320,18 @@ const int16_t *pcm_get_sample_ram_for_preset(uint16_t preset_number, uint32_t *l
 // render path is all fixed point).
 static int16_t stretch_win[PCM_STRETCH_GRAIN];
 
+static void pcm_stream_stop(void);
+static void pcm_reload_reset(void);
+
 void pcm_init() {
-    memorypcm_ll_start = NULL;
+    memset(memorypcm_index, 0, sizeof(memorypcm_index));
+    pcm_use_clock = 0;
+    amy_global.pcm_stream_underruns = 0;
+    amy_global.pcm_cache_hits = 0;
+    amy_global.pcm_cache_misses = 0;
+    amy_global.pcm_cache_evictions = 0;
+    amy_global.pcm_resident_bytes = 0;
+    pcm_reload_reset();
     for (int i = 0; i < PCM_STRETCH_GRAIN; ++i) {
         float w = 0.5f * (1.0f - cosf(2.0f * (float)M_PI * (float)i / (float)PCM_STRETCH_GRAIN));
         stretch_win[i] = (int16_t)(w * 32767.0f);
@@ -151,6 +339,8 @@ void pcm_init() {
 }
 void pcm_deinit() {
     pcm_unload_all_presets();
+    pcm_stream_stop();
+    pcm_reload_reset();
 }
 
 // How many bits used for fractional part of PCM table index.
@@ -160,10 +350,494 @@ void pcm_deinit() {
 // The phase advance step within a block is calculated with this many additional bits beyond PCM_INDEX_FRAC_BITS
 #define PCM_INDEX_STEP_EXTRA_BITS 8
 
-static void fclose_if_file(memorypcm_preset_t *preset) {
+///////////////////////////////////////////////////////////////////////////
+// Reading WAV files into RAM.
+
+// Open a WAV file and parse its header, leaving the handle at its first
+// frame; 0 if it can't be opened or isn't 16-bit mono or stereo.
+static uint32_t pcm_open_wave(char *filename, wave_info_t *info, uint32_t *data_bytes) {
+    if (amy_global.config.amy_external_fopen_hook == NULL || amy_global.config.amy_external_fclose_hook == NULL) {
+        fprintf(stderr, "fopen hook not enabled on platform\n");
+        return 0;
+    }
+    uint32_t handle = amy_global.config.amy_external_fopen_hook(filename, "rb");
+    if (handle == 0) {
+        fprintf(stderr, "Could not open file %s\n", filename);
+        return 0;
+    }
+    if (!wave_parse_header(handle, info, data_bytes) || info->channels == 0 || info->channels > 2) {
+        fprintf(stderr, "Could not parse WAVE file %s\n", filename);
+        amy_global.config.amy_external_fclose_hook(handle);
+        return 0;
+    }
+    return handle;
+}
+
+// Read up to `frames` frames from a file pcm_open_wave opened into `ram`
+// (none if it's NULL), and close it.  Returns how many it got.
+static uint32_t pcm_read_wave(uint32_t handle, uint8_t channels, uint32_t data_bytes,
+                              int16_t *ram, uint32_t frames) {
+    uint32_t got = 0, n;
+    while (ram != NULL && got < frames &&
+           (n = wave_read_pcm_frames_s16(handle, channels, &data_bytes, ram + got * channels, frames - got)) > 0) {
+        got += n;
+    }
+    amy_global.config.amy_external_fclose_hook(handle);
+    return got;
+}
+
+// A note-on can't read an evicted preset back itself: that's a file open and
+// a read of the whole file, and an allocation to hold it, inside the block's
+// deadline.  Instead it leaves a request in pcm_reloads, and another thread
+// reads the file into a new allocation: the reader thread where there is one
+// (see "Streaming from files"), or else whichever thread next sends AMY an
+// event (pcm_service_reloads).  A later note-on finds the frames there and
+// puts them in the preset (pcm_reload_install), evicting to make room as a
+// load would.  The render side moves a request from IDLE to WANTED and from
+// DONE back to IDLE; the reading thread from WANTED, through READING, to DONE.
+#ifdef AMY_PCM_RELOADER
+
+enum { PCM_RELOAD_IDLE, PCM_RELOAD_WANTED, PCM_RELOAD_READING, PCM_RELOAD_DONE };
+
+// Presets that can be on their way back at once; a miss past that many is
+// asked for again at its next note-on.
+#define PCM_RELOAD_MAX 4
+
+typedef struct {
+    atomic_uint state;
+    uint16_t preset_number;
+    char filename[MAX_FILENAME_LEN];
+    // What the reading thread got: frames in their own allocation, or NULL.
+    int16_t *ram;
+    uint32_t frames;
+    uint8_t channels;
+    uint32_t samplerate;
+} pcm_reload_t;
+
+static pcm_reload_t pcm_reloads[PCM_RELOAD_MAX];
+
+// Take the next request nobody is reading yet; NULL if there are none.
+static pcm_reload_t *pcm_reload_claim(void) {
+    for (int i = 0; i < PCM_RELOAD_MAX; ++i) {
+        unsigned int wanted = PCM_RELOAD_WANTED;
+        if (atomic_compare_exchange_strong_explicit(&pcm_reloads[i].state, &wanted, PCM_RELOAD_READING,
+                                                    memory_order_acquire, memory_order_relaxed))
+            return &pcm_reloads[i];
+    }
+    return NULL;
+}
+
+// Read a claimed request's file, and hand the frames back to the render side.
+static void pcm_reload_read(pcm_reload_t *r) {
+    wave_info_t info = {0};
+    uint32_t data_bytes = 0;
+    r->ram = NULL;
+    r->frames = 0;
+    uint32_t handle = pcm_open_wave(r->filename, &info, &data_bytes);
+    if (handle != 0) {
+        uint32_t frames = data_bytes / (info.channels * 2);
+        int16_t *ram = NULL;
+        if (frames > 0) {
+            ram = malloc_caps(frames * info.channels * sizeof(int16_t), amy_global.config.ram_caps_sample);
+            if (ram == NULL)  fprintf(stderr, "No RAM left for sample load\n");
+        }
+        r->frames = pcm_read_wave(handle, info.channels, data_bytes, ram, frames);
+        if (r->frames == 0) {
+            free(ram);
+            ram = NULL;
+        }
+        r->ram = ram;
+        r->channels = info.channels;
+        r->samplerate = info.sample_rate;
+    }
+}
+
+static void pcm_reload_finish(pcm_reload_t *r) {
+    atomic_store_explicit(&r->state, PCM_RELOAD_DONE, memory_order_release);
+}
+
+// Forget every request, freeing what came back for them.  No thread may be
+// reading one.
+static void pcm_reload_reset(void) {
+    for (int i = 0; i < PCM_RELOAD_MAX; ++i) {
+        if (atomic_load_explicit(&pcm_reloads[i].state, memory_order_acquire) == PCM_RELOAD_DONE)
+            free(pcm_reloads[i].ram);
+        pcm_reloads[i].ram = NULL;
+        atomic_store_explicit(&pcm_reloads[i].state, PCM_RELOAD_IDLE, memory_order_relaxed);
+    }
+}
+
+#else  // !AMY_PCM_RELOADER: a note-on reads an evicted preset back itself.
+
+static void pcm_reload_reset(void) {}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Streaming from files.
+//
+// A file preset plays through its small sample_ram buffer, refilled with the
+// next frames of the file every block.  Reading them on the render thread
+// puts a blocking fread (through amy_external_fread_hook) inside the block's
+// deadline, so a slow disk or a page-cache miss is a dropout.  Where there
+// are threads, a reader thread keeps each file preset's frames read ahead
+// into a ring instead, and the render thread only copies out of that.
+//
+// Each preset has one file handle, so the read-ahead is per preset, not per
+// osc (two oscs on one file preset share its stream, as they always have).
+// The render plan (amy.c) keeps every osc on a file preset on one core, so
+// only one render thread takes from a stream, and fills its preset's
+// sample_ram, in a block.  At load the file's first frames (the head) are
+// read into memory, so a note-on can start playing at once: it only asks the
+// reader to seek back to just past the head and fill the ring from there,
+// which it has the head's worth of blocks to do.  The ring is
+// single-producer single-consumer: the reader thread moves `write` and the
+// render side `read`, and a note-on is a new `want`, which the reader
+// acknowledges in `have` once it has emptied the ring and seeked; until then
+// the ring reads as empty.
+//
+// If the reader hasn't got far enough ahead, a block with a deadline (a real
+// audio device) skips the stream rather than waiting, and counts it in
+// amy_global.pcm_stream_underruns; the stream resumes where it was next
+// block.  Rendering with no audio device has no deadline, and waits for the
+// reader instead, so offline renders come out the same every time.  The
+// reader also reads back presets evicted under the sample RAM budget (see
+// "Reading WAV files into RAM").
+
+#define PCM_STREAM_HEAD_FRAMES (AMY_BLOCK_SIZE * PCM_FILE_BUFFER_MULT * PCM_STREAM_HEAD_BUFFERS)
+#define PCM_STREAM_RING_FRAMES (AMY_BLOCK_SIZE * PCM_FILE_BUFFER_MULT * PCM_STREAM_RING_BUFFERS)
+
+#ifdef AMY_PCM_STREAM_THREAD
+
+// Streams the reader thread looks after; it's a file handle each, so no more
+// than there can be open files.
+#define PCM_STREAM_MAX MAX_OPEN_FILES
+// How long the reader sleeps when nobody has asked it for anything, as a
+// backstop for a wakeup it missed.
+#define PCM_STREAM_IDLE_US 5000
+
+typedef struct pcm_stream {
+    uint32_t handle;
+    uint8_t channels;
+    uint32_t data_offset;    // where the frames start in the file
+    uint32_t data_bytes;
+    int16_t *head;           // the file's first head_frames frames
+    uint32_t head_frames;
+    int16_t *ring;           // PCM_STREAM_RING_FRAMES frames after them, or NULL if there are none
+    uint32_t bytes_left;     // reader thread only: still to read since its last seek
+    uint32_t pos;            // render side: frames taken since note-on
+    atomic_uint want;        // note-ons so far (render side)
+    atomic_uint have;        // the note-on the ring is filled for (reader thread)
+    atomic_uint write;       // frames put in the ring since then (reader thread)
+    atomic_uint read;        // and taken out of it (render side)
+    atomic_uint ended;       // the reader has read all the frames there are (reader thread)
+} pcm_stream_t;
+
+// The lock covers the stream list and the reader's use of each stream (and
+// so its reads of their files); the render side never takes it unless it's
+// going to wait anyway.
+static pthread_mutex_t pcm_stream_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pcm_stream_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pcm_stream_filled = PTHREAD_COND_INITIALIZER;
+static pcm_stream_t *pcm_streams[PCM_STREAM_MAX];
+static pthread_t pcm_stream_thread;
+static bool pcm_stream_running = false;
+static bool pcm_stream_quit = false;
+// Set by the render side when it wants the reader; cleared by the reader.
+static atomic_uint pcm_stream_kicked;
+
+static void pcm_stream_kick(void) {
+    if (atomic_exchange_explicit(&pcm_stream_kicked, 1, memory_order_acq_rel) == 0)
+        pthread_cond_signal(&pcm_stream_wake);
+}
+
+// Frames ready in the ring for the current note-on; *ended if no more will
+// come.  Render side.
+static uint32_t pcm_stream_ready(pcm_stream_t *s, bool *ended) {
+    *ended = false;
+    if (atomic_load_explicit(&s->have, memory_order_acquire) != atomic_load_explicit(&s->want, memory_order_relaxed))
+        return 0;
+    *ended = atomic_load_explicit(&s->ended, memory_order_acquire) != 0;
+    return atomic_load_explicit(&s->write, memory_order_acquire) - atomic_load_explicit(&s->read, memory_order_relaxed);
+}
+
+// One read into one stream's ring, seeking first if there's been a note-on.
+// Reader thread, under the lock.  True if it read something and there's room
+// for more.
+static bool pcm_stream_fill(pcm_stream_t *s) {
+    uint32_t bytes_per_frame = s->channels * 2;
+    uint32_t want = atomic_load_explicit(&s->want, memory_order_acquire);
+    if (want != atomic_load_explicit(&s->have, memory_order_relaxed)) {
+        // The render side is playing the head again; follow it from there.
+        uint32_t head_bytes = s->head_frames * bytes_per_frame;
+        s->bytes_left = (s->data_bytes > head_bytes) ? s->data_bytes - head_bytes : 0;
+        if (s->bytes_left >= bytes_per_frame)
+            amy_global.config.amy_external_fseek_hook(s->handle, s->data_offset + head_bytes);
+        atomic_store_explicit(&s->write, 0, memory_order_relaxed);
+        atomic_store_explicit(&s->read, 0, memory_order_relaxed);
+        atomic_store_explicit(&s->ended, s->bytes_left < bytes_per_frame, memory_order_relaxed);
+        atomic_store_explicit(&s->have, want, memory_order_release);
+    }
+    if (atomic_load_explicit(&s->ended, memory_order_relaxed))  return false;
+    uint32_t write = atomic_load_explicit(&s->write, memory_order_relaxed);
+    uint32_t room = PCM_STREAM_RING_FRAMES - (write - atomic_load_explicit(&s->read, memory_order_acquire));
+    uint32_t at = write % PCM_STREAM_RING_FRAMES;
+    uint32_t frames = MIN(room, PCM_STREAM_RING_FRAMES - at);
+    if (frames == 0)  return false;
+    uint32_t got = wave_read_pcm_frames_s16(s->handle, s->channels, &s->bytes_left,
+                                            s->ring + at * s->channels, frames);
+    atomic_store_explicit(&s->write, write + got, memory_order_release);
+    if (got == 0 || s->bytes_left < bytes_per_frame) {
+        // A short read is a truncated file: the frames stop here.
+        atomic_store_explicit(&s->ended, 1, memory_order_release);
+        return false;
+    }
+    return got < room;
+}
+
+static void *pcm_stream_reader(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&pcm_stream_lock);
+    while (!pcm_stream_quit) {
+        // A read per stream per pass, so one long file can't hold up the rest.
+        bool more = false;
+        for (int i = 0; i < PCM_STREAM_MAX; ++i)
+            if (pcm_streams[i] != NULL && pcm_stream_fill(pcm_streams[i]))  more = true;
+#ifdef AMY_PCM_RELOADER
+        // And an evicted preset the render side wants back.  That's a whole
+        // file, so the streams aren't kept waiting on the lock for it.
+        pcm_reload_t *r = pcm_reload_claim();
+        if (r != NULL) {
+            pthread_mutex_unlock(&pcm_stream_lock);
+            pcm_reload_read(r);
+            pthread_mutex_lock(&pcm_stream_lock);
+            pcm_reload_finish(r);
+            more = true;
+        }
+#endif
+        pthread_cond_broadcast(&pcm_stream_filled);
+        if (more || atomic_exchange_explicit(&pcm_stream_kicked, 0, memory_order_acq_rel))  continue;
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_nsec += PCM_STREAM_IDLE_US * 1000;
+        if (until.tv_nsec >= 1000000000) {
+            until.tv_sec += 1;
+            until.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(&pcm_stream_wake, &pcm_stream_lock, &until);
+    }
+    pthread_mutex_unlock(&pcm_stream_lock);
+    return NULL;
+}
+
+// Start the reader thread if it isn't running; false if it can't be.  Under
+// the lock.
+static bool pcm_reader_start(void) {
+    if (!pcm_stream_running) {
+        pcm_stream_quit = false;
+        pcm_stream_running = (pthread_create(&pcm_stream_thread, NULL, pcm_stream_reader, NULL) == 0);
+        if (!pcm_stream_running)  fprintf(stderr, "pcm: couldn't start the file reader thread\n");
+    }
+    return pcm_stream_running;
+}
+
+// Set up a read-ahead for a file preset whose header has just been parsed
+// (so the handle is at its first frame), and hand it to the reader thread,
+// starting that if need be.  NULL if there's no thread to read it (the
+// platform runs single-threaded, or can't seek), and the render thread
+// reads the file itself.
+static pcm_stream_t *pcm_stream_open(uint32_t handle, const wave_info_t *info, uint32_t data_bytes) {
+    if (!amy_global.config.platform.multithread || amy_global.config.amy_external_fseek_hook == NULL)
+        return NULL;
+    uint32_t bytes_per_frame = info->channels * 2;
+    uint32_t total_frames = data_bytes / bytes_per_frame;
+    uint32_t head_frames = MIN(total_frames, PCM_STREAM_HEAD_FRAMES);
+    uint32_t ring_frames = (total_frames > head_frames) ? PCM_STREAM_RING_FRAMES : 0;
+    pcm_stream_t *s = malloc_caps(sizeof(pcm_stream_t) + (head_frames + ring_frames) * bytes_per_frame,
+                                  amy_global.config.ram_caps_sample);
+    if (s == NULL)  return NULL;
+    s->handle = handle;
+    s->channels = info->channels;
+    s->data_offset = info->data_offset;
+    s->data_bytes = data_bytes;
+    s->head = (int16_t *)(s + 1);
+    s->ring = ring_frames ? s->head + head_frames * info->channels : NULL;
+    s->bytes_left = data_bytes;
+    s->head_frames = 0;
+    while (s->head_frames < head_frames) {
+        uint32_t got = wave_read_pcm_frames_s16(handle, info->channels, &s->bytes_left,
+                                                s->head + s->head_frames * info->channels,
+                                                head_frames - s->head_frames);
+        if (got == 0)  break;
+        s->head_frames += got;
+    }
+    // The handle is just past the head, so the ring carries on from there
+    // without a note-on.
+    s->pos = 0;
+    atomic_init(&s->want, 0);
+    atomic_init(&s->have, 0);
+    atomic_init(&s->write, 0);
+    atomic_init(&s->read, 0);
+    atomic_init(&s->ended, s->ring == NULL || s->bytes_left < bytes_per_frame);
+    pthread_mutex_lock(&pcm_stream_lock);
+    int slot = -1;
+    for (int i = 0; i < PCM_STREAM_MAX && slot < 0; ++i)
+        if (pcm_streams[i] == NULL)  slot = i;
+    if (slot < 0 || !pcm_reader_start()) {
+        pthread_mutex_unlock(&pcm_stream_lock);
+        // The render thread reads it instead, from the top.
+        amy_global.config.amy_external_fseek_hook(handle, info->data_offset);
+        free(s);
+        return NULL;
+    }
+    pcm_streams[slot] = s;
+    pthread_mutex_unlock(&pcm_stream_lock);
+    pcm_stream_kick();
+    return s;
+}
+
+// Take the stream back from the reader thread and free it.
+static void pcm_stream_close(pcm_stream_t *s) {
+    pthread_mutex_lock(&pcm_stream_lock);
+    for (int i = 0; i < PCM_STREAM_MAX; ++i)
+        if (pcm_streams[i] == s)  pcm_streams[i] = NULL;
+    pthread_mutex_unlock(&pcm_stream_lock);
+    free(s);
+}
+
+static void pcm_stream_stop(void) {
+    pthread_mutex_lock(&pcm_stream_lock);
+    bool running = pcm_stream_running;
+    pcm_stream_quit = true;
+    pthread_cond_signal(&pcm_stream_wake);
+    pthread_mutex_unlock(&pcm_stream_lock);
+    if (running)  pthread_join(pcm_stream_thread, NULL);
+    pcm_stream_running = false;
+    pcm_stream_quit = false;
+}
+
+// Note-on: play from the head again, and have the reader follow.
+static void pcm_stream_restart(pcm_stream_t *s) {
+    s->pos = 0;
+    atomic_fetch_add_explicit(&s->want, 1, memory_order_release);
+    pcm_stream_kick();
+}
+
+// Copy the stream's next frames_needed frames into the preset's sample_ram,
+// as fill_sample_from_file does straight from the file.  Returns how many it
+// copied, fewer only at the end of the file.  If the reader is behind and
+// the block can't wait, it copies none and sets *starved.
+static uint32_t pcm_stream_take(memorypcm_preset_t *preset, uint32_t frames_needed, bool *starved) {
+    pcm_stream_t *s = preset->stream;
+    uint8_t channels = s->channels;
+    uint32_t total_frames = s->data_bytes / (channels * 2);
+    if (s->pos >= total_frames)  return 0;
+    if (frames_needed > total_frames - s->pos)  frames_needed = total_frames - s->pos;
+    uint32_t from_head = (s->pos < s->head_frames) ? MIN(frames_needed, s->head_frames - s->pos) : 0;
+    uint32_t from_ring = frames_needed - from_head;
+    if (from_ring > 0) {
+        bool ended;
+        uint32_t ready = pcm_stream_ready(s, &ended);
+        if (ready < from_ring && !ended) {
+            if (amy_global.config.audio != AMY_AUDIO_IS_NONE) {
+                // Streams on other render cores count here too.
+                atomic_fetch_add_explicit((_Atomic uint32_t *)&amy_global.pcm_stream_underruns, 1, memory_order_relaxed);
+                *starved = true;
+                pcm_stream_kick();
+                return 0;
+            }
+            pthread_mutex_lock(&pcm_stream_lock);
+            while ((ready = pcm_stream_ready(s, &ended)) < from_ring && !ended) {
+                atomic_store_explicit(&pcm_stream_kicked, 1, memory_order_release);
+                pthread_cond_signal(&pcm_stream_wake);
+                pthread_cond_wait(&pcm_stream_filled, &pcm_stream_lock);
+            }
+            pthread_mutex_unlock(&pcm_stream_lock);
+        }
+        if (ready < from_ring)  from_ring = ready;  // a truncated file
+    }
+    int16_t *dest = preset->sample_ram;
+    if (from_head > 0) {
+        memcpy(dest, s->head + s->pos * channels, from_head * channels * sizeof(int16_t));
+        dest += from_head * channels;
+    }
+    if (from_ring > 0) {
+        uint32_t read = atomic_load_explicit(&s->read, memory_order_relaxed);
+        uint32_t at = read % PCM_STREAM_RING_FRAMES;
+        uint32_t first = MIN(from_ring, PCM_STREAM_RING_FRAMES - at);
+        memcpy(dest, s->ring + at * channels, first * channels * sizeof(int16_t));
+        memcpy(dest + first * channels, s->ring, (from_ring - first) * channels * sizeof(int16_t));
+        atomic_store_explicit(&s->read, read + from_ring, memory_order_release);
+        pcm_stream_kick();
+    }
+    s->pos += from_head + from_ring;
+    return from_head + from_ring;
+}
+
+#ifdef AMY_PCM_RELOADER
+// Whether the reader thread is running, starting it first if `start` and
+// the platform runs threads.
+static bool pcm_reader_running(bool start) {
+    if (start && !pcm_stream_running && amy_global.config.platform.multithread) {
+        pthread_mutex_lock(&pcm_stream_lock);
+        pcm_reader_start();
+        pthread_mutex_unlock(&pcm_stream_lock);
+    }
+    return pcm_stream_running;
+}
+
+// Wait for the reader thread to read a preset back, as a block with no
+// deadline waits for a stream.
+static void pcm_reload_wait(pcm_reload_t *r) {
+    pthread_mutex_lock(&pcm_stream_lock);
+    while (atomic_load_explicit(&r->state, memory_order_acquire) != PCM_RELOAD_DONE) {
+        atomic_store_explicit(&pcm_stream_kicked, 1, memory_order_release);
+        pthread_cond_signal(&pcm_stream_wake);
+        pthread_cond_wait(&pcm_stream_filled, &pcm_stream_lock);
+    }
+    pthread_mutex_unlock(&pcm_stream_lock);
+}
+#endif
+
+#else  // !AMY_PCM_STREAM_THREAD: the render thread reads files itself.
+
+typedef struct pcm_stream pcm_stream_t;
+static pcm_stream_t *pcm_stream_open(uint32_t handle, const wave_info_t *info, uint32_t data_bytes) {
+    (void)handle; (void)info; (void)data_bytes;
+    return NULL;
+}
+static void pcm_stream_close(pcm_stream_t *s) { (void)s; }
+static void pcm_stream_stop(void) {}
+static void pcm_stream_restart(pcm_stream_t *s) { (void)s; }
+static uint32_t pcm_stream_take(memorypcm_preset_t *preset, uint32_t frames_needed, bool *starved) {
+    (void)preset; (void)frames_needed; (void)starved;
+    return 0;
+}
+#ifdef AMY_PCM_RELOADER
+static void pcm_stream_kick(void) {}
+static bool pcm_reader_running(bool start) { (void)start; return false; }
+static void pcm_reload_wait(pcm_reload_t *r) { (void)r; }
+#endif
+
+#endif
+
+// Let go of whatever a preset holds of its file: the reader thread's
+// read-ahead and the handle of a streamed one, or a mapped one's mapping.
+static void release_preset_file(memorypcm_preset_t *preset) {
     if (preset == NULL) {
         return;
     }
+#ifdef AMY_PCM_MMAP
+    if (preset->type == AMY_PCM_TYPE_MAPPED && preset->map != NULL) {
+        munmap(preset->map, preset->map_bytes);
+        preset->map = NULL;
+        preset->sample_ram = NULL;
+    }
+#endif
+    if (preset->stream != NULL) {
+        pcm_stream_close(preset->stream);
+        preset->stream = NULL;
+    }
     if (preset->type == AMY_PCM_TYPE_FILE &&
         preset->file_handle != 0 &&
         amy_global.config.amy_external_fclose_hook != NULL) {
@@ -172,6 +846,225 @@ static void fclose_if_file(memorypcm_preset_t *preset) {
     }
 }
 
+// Sample RAM budget.  amy_global.pcm_resident_bytes counts the frames
+// presets hold in RAM (pcm_load's and pcm_read_file's; a mapped or streamed
+// preset holds next to none).  With config.sample_ram_budget set, a load that
+// would take that past the budget first evicts presets read from a file that
+// no sounding osc is playing, least recently played first.  An evicted preset
+// keeps its place in the index, with no frames.  A note-on on it is a miss:
+// it asks for the file to be read again off the render thread (see "Reading
+// WAV files into RAM") and is silent, unless there's no audio device, when
+// it waits for the reader as a stream does.  A later note-on finds the
+// frames back.  A load that still doesn't fit is refused, as if there were
+// no RAM left.
+//
+// Evicting frees presets no osc is sounding, so it mustn't overlap a note-on,
+// which could be starting one of them, or another eviction.  Note-ons are
+// played under the queue lock, so evictions are too: the render side's
+// happen during a note-on, and a load from another thread (pcm_load,
+// pcm_read_file) takes the lock to make its room (pcm_reserve), and to put a
+// preset in the index or take one out (pcm_unload_preset, pcm_compress_preset).
+
+static uint32_t preset_ram_bytes(const memorypcm_preset_t *preset) {
+    if (preset->codes != NULL)  return pcm_c8_bytes(preset->length, preset->channels);
+    return preset->length * preset->channels * sizeof(int16_t);
+}
+
+// Make room for `bytes` more of frames; false if evicting can't.
+static bool pcm_make_room(uint32_t bytes) {
+    uint32_t budget = amy_global.config.sample_ram_budget;
+    if (budget == 0 || (uint64_t)amy_global.pcm_resident_bytes + bytes <= budget)  return true;
+    if (bytes > budget)  return false;
+    // What's sounding stays.
+    for (uint16_t osc = 0; synth != NULL && osc < AMY_OSCS; ++osc) {
+        if (synth[osc] == NULL || synth[osc]->status == SYNTH_OFF || AMY_IS_UNSET(synth[osc]->preset))  continue;
+        if (synth[osc]->wave != PCM && synth[osc]->wave != PCM_LEFT && synth[osc]->wave != PCM_RIGHT)  continue;
+        memorypcm_ll_t *entry = pcm_index_find(synth[osc]->preset);
+        if (entry != NULL)  entry->in_use = true;
+    }
+    bool fits = false;
+    while (!fits) {
+        memorypcm_preset_t *oldest = NULL;
+        for (int b = 0; b < PCM_PRESET_INDEX_SIZE; ++b) {
+            for (memorypcm_ll_t *entry = memorypcm_index[b]; entry != NULL; entry = entry->next) {
+                memorypcm_preset_t *preset = entry->preset;
+                if (entry->in_use || !preset_is_reloadable(preset) || preset->sample_ram == NULL)  continue;
+                if (oldest == NULL || (int32_t)(preset->last_used - oldest->last_used) < 0)  oldest = preset;
+            }
+        }
+        if (oldest == NULL)  break;
+        free(oldest->sample_ram);
+        oldest->sample_ram = NULL;
+        amy_global.pcm_resident_bytes -= preset_ram_bytes(oldest);
+        amy_global.pcm_cache_evictions++;
+        fits = (uint64_t)amy_global.pcm_resident_bytes + bytes <= budget;
+    }
+    for (int b = 0; b < PCM_PRESET_INDEX_SIZE; ++b)
+        for (memorypcm_ll_t *entry = memorypcm_index[b]; entry != NULL; entry = entry->next)  entry->in_use = false;
+    return fits;
+}
+
+// Make room for `bytes` more of frames and count them as held, or false if
+// there's no room.  `locked` if the caller holds the queue lock already (it's
+// playing a note-on).
+static bool pcm_reserve(uint32_t bytes, bool locked) {
+    if (!locked)  amy_grab_lock();
+    bool fits = pcm_make_room(bytes);
+    if (fits)  amy_global.pcm_resident_bytes += bytes;
+    if (!locked)  amy_release_lock();
+    return fits;
+}
+
+// Give back bytes pcm_reserve counted that weren't used after all.
+static void pcm_unreserve(uint32_t bytes, bool locked) {
+    if (bytes == 0)  return;
+    if (!locked)  amy_grab_lock();
+    amy_global.pcm_resident_bytes -= bytes;
+    if (!locked)  amy_release_lock();
+}
+
+// Give a reloadable preset the frames read from its file, taking the format
+// the file has now; their bytes have been reserved.  A file that comes up
+// short plays what there is.
+static void pcm_set_frames(memorypcm_preset_t *preset, int16_t *ram, uint32_t frames,
+                           uint8_t channels, uint32_t samplerate) {
+    preset->sample_ram = ram;
+    preset->length = frames;
+    preset->channels = channels;
+    preset->samplerate = samplerate;
+    preset->log2sr = log2f((float)samplerate / ZERO_LOGFREQ_IN_HZ);
+    if (preset->loopend >= frames)  preset->loopend = frames - 1;
+    if (preset->loopstart > preset->loopend)  preset->loopstart = 0;
+}
+
+// Read a reloadable preset's frames from its file into their own allocation.
+// `locked` as for pcm_reserve.
+static bool pcm_read_frames(memorypcm_preset_t *preset, bool locked) {
+    wave_info_t info = {0};
+    uint32_t data_bytes = 0;
+    uint32_t handle = pcm_open_wave(preset->filename, &info, &data_bytes);
+    if (handle == 0)  return false;
+    uint32_t frames = data_bytes / (info.channels * 2);
+    uint32_t bytes_per_frame = info.channels * sizeof(int16_t);
+    int16_t *ram = NULL;
+    if (frames > 0 && !pcm_reserve(frames * bytes_per_frame, locked)) {
+        fprintf(stderr, "No room in the sample RAM budget for %s\n", preset->filename);
+        frames = 0;
+    }
+    if (frames > 0) {
+        ram = malloc_caps(frames * bytes_per_frame, amy_global.config.ram_caps_sample);
+        if (ram == NULL)  fprintf(stderr, "No RAM left for sample load\n");
+    }
+    uint32_t got = pcm_read_wave(handle, info.channels, data_bytes, ram, frames);
+    pcm_unreserve((frames - got) * bytes_per_frame, locked);
+    if (got == 0) {
+        free(ram);
+        return false;
+    }
+    pcm_set_frames(preset, ram, got, info.channels, info.sample_rate);
+    return true;
+}
+
+#ifdef AMY_PCM_RELOADER
+// Put the frames of every request that's come back into its preset, making
+// room for them, or let them go if there's no room or the preset has moved
+// on (unloaded, or read again).  Render side, in a note-on.
+static void pcm_reload_install(void) {
+    for (int i = 0; i < PCM_RELOAD_MAX; ++i) {
+        pcm_reload_t *r = &pcm_reloads[i];
+        if (atomic_load_explicit(&r->state, memory_order_acquire) != PCM_RELOAD_DONE)  continue;
+        memorypcm_ll_t *entry = pcm_index_find(r->preset_number);
+        memorypcm_preset_t *preset = (entry != NULL) ? entry->preset : NULL;
+        int16_t *ram = r->ram;
+        if (ram != NULL && preset != NULL && preset_is_reloadable(preset) && preset->sample_ram == NULL
+            && strcmp(preset->filename, r->filename) == 0) {
+            if (pcm_reserve(r->frames * r->channels * sizeof(int16_t), true)) {
+                pcm_set_frames(preset, ram, r->frames, r->channels, r->samplerate);
+                ram = NULL;
+            } else {
+                fprintf(stderr, "No room in the sample RAM budget for %s\n", preset->filename);
+            }
+        }
+        free(ram);
+        r->ram = NULL;
+        atomic_store_explicit(&r->state, PCM_RELOAD_IDLE, memory_order_release);
+    }
+}
+
+// Ask for an evicted preset to be read back, unless it already has been.
+// The request, or NULL if there are too many in flight.  Render side.
+static pcm_reload_t *pcm_reload_request(uint16_t preset_number, const memorypcm_preset_t *preset) {
+    pcm_reload_t *idle = NULL;
+    for (int i = 0; i < PCM_RELOAD_MAX; ++i) {
+        pcm_reload_t *r = &pcm_reloads[i];
+        unsigned int state = atomic_load_explicit(&r->state, memory_order_acquire);
+        if (state == PCM_RELOAD_IDLE) {
+            if (idle == NULL)  idle = r;
+        } else if (r->preset_number == preset_number && strcmp(r->filename, preset->filename) == 0) {
+            return r;
+        }
+    }
+    if (idle == NULL)  return NULL;
+    idle->preset_number = preset_number;
+    memcpy(idle->filename, preset->filename, MAX_FILENAME_LEN);
+    atomic_store_explicit(&idle->state, PCM_RELOAD_WANTED, memory_order_release);
+    pcm_stream_kick();
+    return idle;
+}
+
+// Read the evicted presets note-ons have asked for, if there's no reader
+// thread to.  amy_add_event calls this, so it runs on the thread sending
+// events -- but not for the events the render thread sends itself.
+void pcm_service_reloads() {
+    if (amy_global.render_adding_events || pcm_reader_running(false))  return;
+    pcm_reload_t *r;
+    while ((r = pcm_reload_claim()) != NULL) {
+        pcm_reload_read(r);
+        pcm_reload_finish(r);
+    }
+}
+#else
+void pcm_service_reloads() {}
+#endif
+
+// Note a preset being played, and if it was evicted, ask for it back.  If it
+// isn't back yet, it has no frames, and its notes are silent.
+static void pcm_preset_touch(uint16_t preset_number) {
+    memorypcm_ll_t *entry = pcm_index_find(preset_number);
+    if (entry == NULL)  return;
+    memorypcm_preset_t *preset = entry->preset;
+    preset->last_used = ++pcm_use_clock;
+    if (!preset_is_reloadable(preset))  return;
+#ifdef AMY_PCM_RELOADER
+    pcm_reload_install();
+#endif
+    if (preset->sample_ram != NULL) {
+        amy_global.pcm_cache_hits++;
+        return;
+    }
+    amy_global.pcm_cache_misses++;
+#ifdef AMY_PCM_RELOADER
+    pcm_reload_t *r = pcm_reload_request(preset_number, preset);
+    if (r != NULL && amy_global.config.audio == AMY_AUDIO_IS_NONE && pcm_reader_running(false)) {
+        pcm_reload_wait(r);
+        pcm_reload_install();
+    }
+#else
+    pcm_read_frames(preset, true);
+#endif
+}
+
+// Free a preset and everything it holds.
+static void pcm_free_entry(memorypcm_ll_t *entry) {
+    memorypcm_preset_t *preset = entry->preset;
+    release_preset_file(preset);
+    if (preset->type == AMY_PCM_TYPE_MEMORY && preset_has_frames(preset)) {
+        amy_global.pcm_resident_bytes -= preset_ram_bytes(preset);
+        if (preset_is_reloadable(preset))  free(preset->sample_ram);
+    }
+    free(entry);
+}
+
 static bool mode_is_looping(uint16_t mode) {
     return mode == PCM_LOOP || mode == PCM_LOOP_STOP || mode == PCM_LOOP_FOREVER;
 }
@@ -187,6 +1080,13 @@ static bool preset_is_file(uint16_t preset_number, const char **filename_out) {
     return true;
 }
 
+// For the render plan (amy.c): every osc playing a file preset takes its
+// frames from the preset's one stream, or its one file handle, in turn, so
+// they all have to render on the same core.
+bool pcm_preset_is_file(uint16_t preset_number) {
+    return preset_is_file(preset_number, NULL);
+}
+
 // A file-backed preset streams through a small sliding buffer rather than
 // sitting in a table we can index freely, so there is nothing to loop back
 // into: render_pcm refills from the file each block and rewinds phase to the
@@ -236,30 +1136,19 @@ int pcm_find_next_zero_crossing(uint16_t osc, uint32_t base_index) {
         memorypcm_preset_t *preset =
             get_preset_for_preset_number(synth[osc]->preset, &rom_local);
         uint32_t sample_length = preset->length;
-        const LUTSAMPLE* table = preset->sample_ram;
         int last_sign = 0;
         int sign;
         if (preset->type != AMY_PCM_TYPE_FILE
-            && table != NULL
+            && preset_has_frames(preset)
             && sample_length != 0) {
-            const LUTSAMPLE* table = preset->sample_ram;
+            uint8_t layout = pcm_layout(preset->channels, synth[osc]->wave);
             //uint32_t start_index = base_index;  // for debug only
             LUTSAMPLE min_val = SAMPLE_MAX;
             LUTSAMPLE val;
             for(uint16_t i=0; i < PCM_MAX_ZERO_SEARCH_LEN; i++) {
                 // For non-file samples, we have to check for end of sample/looping.
                 if (base_index >= sample_length) break;
-                if (preset->channels == 2) {
-                    if (synth[osc]->wave == PCM_LEFT) {
-                        val = table[base_index * 2];
-                    } else if (synth[osc]->wave == PCM_RIGHT) {
-                        val = table[base_index * 2 + 1];
-                    } else { // PCM or PCM_MIX
-                        val = (LUTSAMPLE)(((int32_t)table[base_index * 2] + (int32_t)table[base_index * 2 + 1]) / 2);
-                    }
-                } else {
-                    val = table[base_index];
-                }
+                val = pcm_preset_frame(preset, base_index, layout);
                 sign = 1;
                 if (val < 0) {sign = -1; val = -val;}
                 if (val < min_val) {
@@ -302,18 +1191,26 @@ int pcm_find_next_zero_crossing(uint16_t osc, uint32_t base_index) {
 // input exactly: drum transients are not softened by a window fade-in.
 
 // Read one frame for the stretcher, honoring PCM_LEFT/PCM_RIGHT/mix.
-static inline LUTSAMPLE pcm_stretch_read(const LUTSAMPLE *table, uint8_t channels, uint16_t wave, uint32_t idx) {
-    if (channels == 2) {
-        if (wave == PCM_LEFT) return table[idx * 2];
-        if (wave == PCM_RIGHT) return table[idx * 2 + 1];
-        return (LUTSAMPLE)(((int32_t)table[idx * 2] + (int32_t)table[idx * 2 + 1]) / 2);
-    }
-    return table[idx];
+static inline LUTSAMPLE pcm_stretch_read(const memorypcm_preset_t *preset, uint16_t wave, uint32_t idx) {
+    return pcm_preset_frame(preset, idx, pcm_layout(preset->channels, wave));
+}
+
+static inline bool pcm_stretch_active(uint16_t osc) {
+    return synth[osc]->stretch != NULL && synth[osc]->stretch->active;
 }
 
 // Configure the stretcher at note-on.  preset must be in-memory (not FILE).
+// The osc's stretch state is allocated here on its first fit note; without
+// the memory for it the note plays pitch-shifted at its own length.
 static void pcm_stretch_note_on(uint16_t osc, memorypcm_preset_t *preset) {
-    pcm_stretch_t *st = &synth[osc]->stretch;
+    if (synth[osc]->stretch == NULL) {
+        synth[osc]->stretch = osc_arena_alloc(sizeof(pcm_stretch_t));
+        if (synth[osc]->stretch == NULL) {
+            amy_oom("pcm_stretch_note_on: out of memory for osc %d fit state\n", osc);
+            return;
+        }
+    }
+    pcm_stretch_t *st = synth[osc]->stretch;
     uint32_t start_frame = INT_OF_P(synth[osc]->phase, PCM_INDEX_BITS);
     if (start_frame >= preset->length) start_frame = 0;
     uint32_t remaining = preset->length - start_frame;
@@ -384,7 +1281,7 @@ static inline uint16_t pcm_stretch_search_width(uint16_t osc) {
     return s;
 }
 
-static int32_t pcm_stretch_best_offset(const LUTSAMPLE *table, uint8_t channels, uint16_t wave,
+static int32_t pcm_stretch_best_offset(const memorypcm_preset_t *preset, uint16_t wave,
                                        uint32_t length, uint32_t target, uint32_t nominal,
                                        uint16_t search) {
 #if PCM_STRETCH_SEARCH > 0
@@ -404,15 +1301,15 @@ static int32_t pcm_stretch_best_offset(const LUTSAMPLE *table, uint8_t channels,
     for (int32_t d = lo; d <= hi; ++d) {
         int32_t corr = 0;
         for (uint32_t i = 0; i < win; i += stride) {
-            int32_t a = pcm_stretch_read(table, channels, wave, target + i) >> 4;
-            int32_t b = pcm_stretch_read(table, channels, wave, nominal + d + i) >> 4;
+            int32_t a = pcm_stretch_read(preset, wave, target + i) >> 4;
+            int32_t b = pcm_stretch_read(preset, wave, nominal + d + i) >> 4;
             corr += a * b;
         }
         if (corr > best_corr) { best_corr = corr; best_d = d; }
     }
     return best_d;
 #else
-    (void)table; (void)channels; (void)wave; (void)length; (void)target; (void)nominal;
+    (void)preset; (void)wave; (void)length; (void)target; (void)nominal;
     (void)search;
     return 0;
 #endif
@@ -453,8 +1350,7 @@ static void pcm_stretch_spawn(pcm_stretch_t *st, memorypcm_preset_t *preset, uin
     int other = 1 - gi;  // PCM_STRETCH_GRAINS == 2
     if (st->grain[other].active) {
         uint32_t target = st->grain[other].start_frame + (st->grain[other].phase_q16 >> 16);
-        d = pcm_stretch_best_offset(preset->sample_ram, preset->channels, wave, length, target, frame,
-                                    search);
+        d = pcm_stretch_best_offset(preset, wave, length, target, frame, search);
     }
     st->grain[gi].active = 1;
     st->grain[gi].start_frame = (uint32_t)((int32_t)frame + d);
@@ -464,7 +1360,7 @@ static void pcm_stretch_spawn(pcm_stretch_t *st, memorypcm_preset_t *preset, uin
 }
 
 static SAMPLE render_pcm_stretch(SAMPLE *buf, uint16_t osc, memorypcm_preset_t *preset) {
-    pcm_stretch_t *st = &synth[osc]->stretch;
+    pcm_stretch_t *st = synth[osc]->stretch;
     // A tempo change has to reach notes that are ALREADY sounding: fit= locks
     // a note to a number of ticks, and a tick just got longer or shorter, so
     // a note left alone would run on at the old tempo and land off the grid.
@@ -495,7 +1391,6 @@ static SAMPLE render_pcm_stretch(SAMPLE *buf, uint16_t osc, memorypcm_preset_t *
     // envelopes/LFOs on freq keep working.
     uint32_t pitch_step_q16 = (uint32_t)((playback_freq / (float)AMY_SAMPLE_RATE) * 65536.0f);
     SAMPLE amp = F2S(msynth[osc]->amp);
-    const LUTSAMPLE *table = preset->sample_ram;
     uint32_t length = preset->length;
     // Re-read each block, so 'pS' can be swept while the note is sounding.
     uint16_t search = pcm_stretch_search_width(osc);
@@ -521,9 +1416,9 @@ static SAMPLE render_pcm_stretch(SAMPLE *buf, uint16_t osc, memorypcm_preset_t *
             if (looping && idx >= loopend)
                 idx = loopstart + ((idx - loopend) % (loopend - loopstart));
             if (idx < length) {
-                LUTSAMPLE b = pcm_stretch_read(table, preset->channels, synth[osc]->wave, idx);
-                LUTSAMPLE c = (idx + 1 < length) ? pcm_stretch_read(table, preset->channels, synth[osc]->wave, idx + 1) : b;
-                SAMPLE frac = (SAMPLE)(st->grain[g].phase_q16 & 0xffff) << (S_FRAC_BITS - 16);
+                LUTSAMPLE b = pcm_stretch_read(preset, synth[osc]->wave, idx);
+                LUTSAMPLE c = (idx + 1 < length) ? pcm_stretch_read(preset, synth[osc]->wave, idx + 1) : b;
+                SAMPLE frac = AMY_I2S(st->grain[g].phase_q16 & 0xffff, 16);
                 SAMPLE samp = L2S(b) + MUL4_SS(L2S(c - b), frac);
                 out += MUL0_SS(samp, L2S(stretch_win[st->grain[g].win_pos]));
             }
@@ -539,19 +1434,41 @@ static SAMPLE render_pcm_stretch(SAMPLE *buf, uint16_t osc, memorypcm_preset_t *
         }
         SAMPLE value = buf[i] + MUL4_SS(amp, out);
         buf[i] = value;
-        if (value < 0) value = -value;
+        value = S_ABS(value);
         if (value > max_value) max_value = value;
     }
     return max_value;
 }
 
+#ifdef AMY_PCM_MMAP
+// How far past where a note on a mapped preset starts (and past its
+// loopstart, if it loops) to ask the kernel to read in ahead of the render
+// thread, which otherwise waits on the disk at each page it touches.
+#define PCM_MAP_WILLNEED_FRAMES (AMY_BLOCK_SIZE * PCM_FILE_BUFFER_MULT * 4)
+
+static void pcm_map_will_need(memorypcm_preset_t *preset, uint32_t frame) {
+    if (frame >= preset->length)  return;
+    uint32_t frames = MIN(PCM_MAP_WILLNEED_FRAMES, preset->length - frame);
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t)(preset->sample_ram + (size_t)frame * preset->channels);
+    uintptr_t end = start + (size_t)frames * preset->channels * sizeof(int16_t);
+    start &= ~(page - 1);
+    // Only a hint: it returns at once, and the pages come in behind it.
+    posix_madvise((void *)start, end - start, POSIX_MADV_WILLNEED);
+}
+#endif
+
 void pcm_note_on(uint16_t osc) {
     if(AMY_IS_SET(synth[osc]->preset)) {
+        pcm_preset_touch(synth[osc]->preset);
         memorypcm_preset_t rom_local;
         memorypcm_preset_t *preset =
             get_preset_for_preset_number(synth[osc]->preset, &rom_local);
         if (preset->type == AMY_PCM_TYPE_FILE) {
-            if (preset->file_handle != 0) {
+            if (preset->stream != NULL) {
+                // The header was read at load; the reader thread does the seek.
+                pcm_stream_restart(preset->stream);
+            } else if (preset->file_handle != 0) {
                 wave_info_t info = {0};
                 uint32_t data_bytes = 0;
                 amy_global.config.amy_external_fseek_hook(preset->file_handle, 0);
@@ -580,10 +1497,10 @@ void pcm_note_on(uint16_t osc) {
         // presets: it needs random access, which a streamed file can't give.
         bool want_stretch = AMY_IS_SET(synth[osc]->fit_ticks)
             && preset->type != AMY_PCM_TYPE_FILE
-            && preset->sample_ram != NULL && preset->length > 0;
+            && preset_has_frames(preset) && preset->length > 0;
         bool fresh_start = true;
         if (synth[osc]->status == SYNTH_AUDIBLE && preset->type != AMY_PCM_TYPE_FILE
-            && !want_stretch && !synth[osc]->stretch.active) {
+            && !want_stretch && !pcm_stretch_active(osc)) {
             // Restarting a currently-playing (non-file) PCM, delay reonset to next zero crossing to avoid click.
             // (Not for the fit engine: its grains are windowed, so a restart is click-free by construction.)
             fresh_start = false;
@@ -608,7 +1525,13 @@ void pcm_note_on(uint16_t osc) {
         if (fresh_start && AMY_IS_SET(synth[osc]->sample_offset))
             msynth[osc]->pcm_delay = synth[osc]->sample_offset % AMY_BLOCK_SIZE;
         if (want_stretch) pcm_stretch_note_on(osc, preset);
-        else synth[osc]->stretch.active = 0;
+        else if (synth[osc]->stretch != NULL) synth[osc]->stretch->active = 0;
+#ifdef AMY_PCM_MMAP
+        if (preset->type == AMY_PCM_TYPE_MAPPED) {
+            pcm_map_will_need(preset, INT_OF_P(phase, PCM_INDEX_BITS));
+            if (mode_is_looping(synth[osc]->mode))  pcm_map_will_need(preset, preset->loopstart);
+        }
+#endif
         // Make sure PCM waveforms are excluded from auto-termination, so we don't cut-off samples with silent gaps.  May be modified by note_off.
         synth[osc]->terminate_on_silence = 0;
     }
@@ -649,8 +1572,12 @@ void pcm_note_off(uint16_t osc) {
 }
 
 
-uint32_t fill_sample_from_file(memorypcm_preset_t *preset_p, uint32_t frames_needed) {
+uint32_t fill_sample_from_file(memorypcm_preset_t *preset_p, uint32_t frames_needed, bool *starved) {
     //fprintf(stderr, "fsff %ld frames\n", frames_needed);
+    *starved = false;
+    if (preset_p->stream != NULL) {
+        return pcm_stream_take(preset_p, frames_needed, starved);
+    }
     uint32_t bytes_per_frame = preset_p->channels * 2;
     uint32_t frames_available = 0;
     if (bytes_per_frame > 0) {
@@ -668,6 +1595,129 @@ uint32_t fill_sample_from_file(memorypcm_preset_t *preset_p, uint32_t frames_nee
     return frames_read;
 }
 
+///////////////////////////////////////////////////////////////////////////
+// render_pcm's kernels.
+//
+// Most of a block's samples need none of the checks render_pcm makes per
+// sample (the loop end, the sample end, a last frame with nothing after it
+// to interpolate toward).  So it works out ahead how many samples it can go
+// before the next one that does (pcm_run_length), renders those straight
+// through with the kernel for the preset's channel layout and the osc's wave,
+// picked once a block (pcm_run), and takes only the sample at the boundary
+// through the checks.  The kernels do the checked path's arithmetic exactly,
+// so the output is the same; where there are vector units, pcm_simd.h does
+// it several samples at a time.
+
+// Phase's bits above this are the frame (INT_OF_P's shift).
+#define PCM_RUN_SHIFT (P_FRAC_BITS - (PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS))
+
+static inline bool pcm_state_is_looping(uint16_t state) {
+    return mode_is_looping(state) || state == PCM_LOOP_ONCE_INTERNAL;
+}
+
+// How many of the next `room` samples, from frame base_index_base + the
+// frame in `phase`, stay below frame `limit`.
+static inline uint16_t pcm_run_length(uint32_t base_index_base, PHASOR phase, PHASOR step,
+                                      uint32_t limit, uint16_t room) {
+#ifdef AMY_USE_FIXEDPOINT
+    if (base_index_base >= limit)  return 0;
+    // The first sample whose phase, unwrapped, reaches limit's frame.  Until
+    // then phase can't have wrapped (a wrapped phase would be in a lower frame
+    // still, so counting it out is only cautious).
+    uint64_t target = (uint64_t)(limit - base_index_base) << PCM_RUN_SHIFT;
+    if ((uint32_t)phase >= target)  return 0;
+    // (A negative step, from a pitch past freq_of_logfreq's range, runs
+    // backwards; leave it to the checks.)
+    if (step < 0)  return 0;
+    if (step == 0)  return room;
+    uint64_t samples = (target - (uint32_t)phase + (uint32_t)step - 1) / (uint32_t)step;
+    return samples < room ? (uint16_t)samples : room;
+#else
+    // Float phases round differently; every sample takes the checks.
+    (void)base_index_base; (void)phase; (void)step; (void)limit; (void)room;
+    return 0;
+#endif
+}
+
+static inline PHASOR pcm_phase_after(PHASOR phase, PHASOR step, uint16_t samples) {
+#ifdef AMY_USE_FIXEDPOINT
+    return P_WRAPPED_SUM(phase, (PHASOR)((uint32_t)step * samples));
+#else
+    for (uint16_t k = 0; k < samples; ++k)  phase = P_WRAPPED_SUM(phase, step);
+    return phase;
+#endif
+}
+
+// Mix `n` samples into buf, reading frames from base_index_base + the frame
+// in `phase` on; each frame read, and the one after it, must be in the
+// preset.  `compressed` says which of its frames to read.  Returns the
+// largest magnitude it left in buf.
+static inline __attribute__((always_inline)) SAMPLE pcm_run_scalar(
+        SAMPLE *buf, uint16_t n, const memorypcm_preset_t *preset, uint8_t layout, bool compressed,
+        uint32_t base_index_base, PHASOR phase, PHASOR step, SAMPLE amp) {
+    const LUTSAMPLE *table = preset->sample_ram;
+    const int8_t *codes = preset->codes;
+    const uint8_t *shifts = preset->shifts;
+    SAMPLE max_value = 0;
+    for (uint16_t i = 0; i < n; ++i) {
+        uint32_t base_index = base_index_base + INT_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
+        SAMPLE frac = S_FRAC_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
+        LUTSAMPLE b, c;
+        if (compressed) {
+            b = pcm_frame_c8(codes, shifts, base_index, layout);
+            c = pcm_frame_c8(codes, shifts, base_index + 1, layout);
+        } else {
+            b = pcm_frame(table, base_index, layout);
+            c = pcm_frame(table, base_index + 1, layout);
+        }
+        SAMPLE sample = L2S(b) + MUL4_SS(L2S(c - b), frac);
+        SAMPLE value = buf[i] + MUL4_SS(amp, sample);
+        buf[i] = value;
+        value = S_ABS(value);
+        if (value > max_value) max_value = value;
+        phase = P_WRAPPED_SUM(phase, step);
+    }
+    return max_value;
+}
+
+#include "pcm_simd.h"
+
+// pcm_run_scalar with the layout and the frames' format built in.
+#define PCM_RUN_SCALAR(LAYOUT, COMPRESSED) \
+    pcm_run_scalar(buf, n, preset, LAYOUT, COMPRESSED, base_index_base, phase, step, amp)
+
+static SAMPLE pcm_run(SAMPLE *buf, uint16_t n, const memorypcm_preset_t *preset, uint8_t layout,
+                      uint32_t base_index_base, PHASOR phase, PHASOR step, SAMPLE amp) {
+    SAMPLE max_value = 0;
+    bool compressed = preset->codes != NULL;
+#if defined(AMY_RENDER_LUT_SIMD) && defined(AMY_USE_FIXEDPOINT)
+    if (render_lut_simd != RENDER_LUT_SCALAR) {
+        uint16_t done = pcm_run_simd(buf, n, preset, layout, compressed, base_index_base, phase, step, amp,
+                                     &max_value);
+        buf += done;
+        n -= done;
+        phase = pcm_phase_after(phase, step, done);
+    }
+#endif
+    SAMPLE tail_max;
+    // The switch picks a copy of the loop with the layout and format built in.
+    switch (layout) {
+        case PCM_LAYOUT_LEFT:
+            tail_max = compressed ? PCM_RUN_SCALAR(PCM_LAYOUT_LEFT, true) : PCM_RUN_SCALAR(PCM_LAYOUT_LEFT, false);
+            break;
+        case PCM_LAYOUT_RIGHT:
+            tail_max = compressed ? PCM_RUN_SCALAR(PCM_LAYOUT_RIGHT, true) : PCM_RUN_SCALAR(PCM_LAYOUT_RIGHT, false);
+            break;
+        case PCM_LAYOUT_MIX:
+            tail_max = compressed ? PCM_RUN_SCALAR(PCM_LAYOUT_MIX, true) : PCM_RUN_SCALAR(PCM_LAYOUT_MIX, false);
+            break;
+        default:
+            tail_max = compressed ? PCM_RUN_SCALAR(PCM_LAYOUT_MONO, true) : PCM_RUN_SCALAR(PCM_LAYOUT_MONO, false);
+            break;
+    }
+    return MAX(max_value, tail_max);
+}
+
 SAMPLE render_pcm(SAMPLE* buf, uint16_t osc) {
     if(AMY_IS_SET(synth[osc]->preset)) {
         SAMPLE max_value = 0;
@@ -675,8 +1725,8 @@ SAMPLE render_pcm(SAMPLE* buf, uint16_t osc) {
         memorypcm_preset_t *preset =
             get_preset_for_preset_number(synth[osc]->preset, &rom_local);
         // fit= notes render through the granular stretch engine instead.
-        if (synth[osc]->stretch.active && preset->type != AMY_PCM_TYPE_FILE
-            && preset->sample_ram != NULL && preset->length > 0) {
+        if (pcm_stretch_active(osc) && preset->type != AMY_PCM_TYPE_FILE
+            && preset_has_frames(preset) && preset->length > 0) {
             return render_pcm_stretch(buf, osc, preset);
         }
         float logfreq = msynth[osc]->logfreq;
@@ -700,24 +1750,28 @@ SAMPLE render_pcm(SAMPLE* buf, uint16_t osc) {
             if (frames_needed > max_frames) {
                 frames_needed = max_frames;
             }
-            sample_length = fill_sample_from_file(preset, frames_needed);
+            bool starved;
+            sample_length = fill_sample_from_file(preset, frames_needed, &starved);
+            if (starved) {
+                // The reader thread is behind; this block goes without.
+                return 0;
+            }
             if(sample_length != frames_needed) {
                 // reached end of file
                 synth[osc]->status = SYNTH_OFF;
             }
             synth[osc]->phase = 0;
         }
-        if (preset->sample_ram == NULL || sample_length == 0) {
+        if (!preset_has_frames(preset) || sample_length == 0) {
             synth[osc]->status = SYNTH_OFF;
             return 0;
         }
 
         SAMPLE amp = F2S(msynth[osc]->amp);
         PHASOR step = F2P((playback_freq / (float)AMY_SAMPLE_RATE) / (float)(1 << (PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS)));
-        const LUTSAMPLE* table = preset->sample_ram;
         uint32_t base_index_base = INT_OF_P(synth[osc]->phase, PCM_INDEX_BITS);
         uint32_t base_index = base_index_base;
-        PHASOR phase = (synth[osc]->phase - (base_index_base << PCM_INDEX_FRAC_BITS)) << PCM_INDEX_STEP_EXTRA_BITS;
+        PHASOR phase = SHIFTL(synth[osc]->phase - I2P(base_index_base, PCM_INDEX_BITS), PCM_INDEX_STEP_EXTRA_BITS);
         // sample_offset (po): a fresh note-on starts partway into this block,
         // leaving the head silent, so slices can butt-join sample-accurately.
         uint16_t start_i = 0;
@@ -725,21 +1779,31 @@ SAMPLE render_pcm(SAMPLE* buf, uint16_t osc) {
             start_i = msynth[osc]->pcm_delay;
             msynth[osc]->pcm_delay = 0;
         }
-        for(uint16_t i=start_i; i < AMY_BLOCK_SIZE; i++) {
+        uint8_t layout = pcm_layout(preset->channels, synth[osc]->wave);
+        uint16_t i = start_i;
+        while (i < AMY_BLOCK_SIZE) {
+            // Straight through to the next sample that needs the checks: the
+            // one at the loop end, or at the last frame.
+            uint32_t limit = sample_length - 1;
+            bool looping = preset->type != AMY_PCM_TYPE_FILE && pcm_state_is_looping(msynth[osc]->state);
+            if (looping && msynth[osc]->loopend < limit)  limit = msynth[osc]->loopend;
+            uint16_t run = pcm_run_length(base_index_base, phase, step, limit, AMY_BLOCK_SIZE - i);
+            if (run > 0) {
+                SAMPLE run_max = pcm_run(buf + i, run, preset, layout, base_index_base, phase, step, amp);
+                if (run_max > max_value) max_value = run_max;
+                phase = pcm_phase_after(phase, step, run);
+                base_index = base_index_base + INT_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
+                i += run;
+                if (i == AMY_BLOCK_SIZE)  break;
+            }
             SAMPLE frac = S_FRAC_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
-            LUTSAMPLE b = 0;
-            LUTSAMPLE c = 0;
             uint32_t next_index = base_index + 1;
             // For non-file samples, we have to check for end of sample/looping.
             if(preset->type != AMY_PCM_TYPE_FILE) {
-                if ((msynth[osc]->state == PCM_LOOP
-                     || msynth[osc]->state == PCM_LOOP_ONCE_INTERNAL
-                     || msynth[osc]->state == PCM_LOOP_STOP
-                     || msynth[osc]->state == PCM_LOOP_FOREVER)
-                    && base_index >= msynth[osc]->loopend) { // loopend
+                if (looping && base_index >= msynth[osc]->loopend) { // loopend
                     // still looping.  The state may be modified by pcm_note_off.
                     // back to loopstart
-                    phase &= ((1L << (PCM_INDEX_FRAC_BITS + PCM_INDEX_STEP_EXTRA_BITS)) - 1);
+                    phase -= I2P(INT_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS), PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
                     base_index_base = msynth[osc]->loopstart + (base_index - msynth[osc]->loopend);
                     if (msynth[osc]->state == PCM_LOOP_ONCE_INTERNAL) {
                         msynth[osc]->state = msynth[osc]->next_state;  // Only loops once.
@@ -754,41 +1818,19 @@ SAMPLE render_pcm(SAMPLE* buf, uint16_t osc) {
                     break;
                 }
             }
-            if (preset->channels == 2) {
-                uint32_t base_offset = base_index * 2;
-                uint32_t next_offset = next_index * 2;
-                if (synth[osc]->wave == PCM_LEFT) {
-                    b = table[base_offset];
-                    c = (next_index < sample_length) ? table[next_offset] : b;
-                } else if (synth[osc]->wave == PCM_RIGHT) {
-                    b = table[base_offset + 1];
-                    c = (next_index < sample_length) ? table[next_offset + 1] : b;
-                } else { // PCM or PCM_MIX
-                    LUTSAMPLE bl = table[base_offset];
-                    LUTSAMPLE br = table[base_offset + 1];
-                    b = (LUTSAMPLE)(((int32_t)bl + (int32_t)br) / 2);
-                    if (next_index < sample_length) {
-                        LUTSAMPLE cl = table[next_offset];
-                        LUTSAMPLE cr = table[next_offset + 1];
-                        c = (LUTSAMPLE)(((int32_t)cl + (int32_t)cr) / 2);
-                    } else {
-                        c = b;
-                    }
-                }
-            } else {
-                b = table[base_index];
-                c = (next_index < sample_length) ? table[next_index] : b;
-            }
+            LUTSAMPLE b = pcm_preset_frame(preset, base_index, layout);
+            LUTSAMPLE c = (next_index < sample_length) ? pcm_preset_frame(preset, next_index, layout) : b;
             SAMPLE sample = L2S(b) + MUL4_SS(L2S(c - b), frac);
             SAMPLE value = buf[i] + MUL4_SS(amp, sample);
             buf[i] = value;   
-            if (value < 0) value = -value;
+            value = S_ABS(value);
             if (value > max_value) max_value = value;  
             phase = P_WRAPPED_SUM(phase, step);
             base_index = base_index_base + INT_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS);
+            i++;
         }
         //synth[osc]->phase = phase;
-        synth[osc]->phase = I2P(base_index, PCM_INDEX_BITS) + (S_FRAC_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS) >> (S_FRAC_BITS - (PCM_INDEX_FRAC_BITS)) ); //  + PCM_INDEX_STEP_EXTRA_BITS
+        synth[osc]->phase = I2P(base_index, PCM_INDEX_BITS) + SHIFTR(S2P(S_FRAC_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS)), PCM_INDEX_BITS);
         //fprintf(stderr, "\rtime %.3f osc %d render_pcm7: preset %d len %d base_ix 0x%lx phase 0x%lx sfracofp 0x%lx step 0x%lx synthphase 0x%lx amp %.3f\n",
         //        amy_global.time, osc, synth[osc]->preset, preset->length, base_index, phase, S_FRAC_OF_P(phase, PCM_INDEX_BITS - PCM_INDEX_STEP_EXTRA_BITS) >> (S_FRAC_BITS - (PCM_INDEX_FRAC_BITS + PCM_INDEX_STEP_EXTRA_BITS)), step, synth[osc]->phase, S2F(msynth[osc]->amp));
         return max_value; 
@@ -847,9 +1889,6 @@ int pcm_load_file() {
         fprintf(stderr, "No RAM left for sample load\n");
         return 0;
     }
-    new_preset_pointer->next = memorypcm_ll_start;
-    memorypcm_ll_start = new_preset_pointer;
-    new_preset_pointer->preset_number = preset_number;
     memorypcm_preset_t *memory_preset =
         (memorypcm_preset_t *)(((uint8_t *)new_preset_pointer) + sizeof(memorypcm_ll_t));
     strncpy(memory_preset->filename, filename, MAX_FILENAME_LEN - 1);
@@ -864,28 +1903,213 @@ int pcm_load_file() {
     memory_preset->file_handle = handle;
     memory_preset->sample_ram = malloc_caps(buffer_frames * info.channels * sizeof(int16_t),
                                                      amy_global.config.ram_caps_sample);
+    memory_preset->stream = pcm_stream_open(handle, &info, total_frames * info.channels * 2);
+    memory_preset->map = NULL;
+    memory_preset->codes = NULL;
+    memory_preset->shifts = NULL;
     new_preset_pointer->preset = memory_preset;
+    pcm_index_insert(new_preset_pointer, preset_number);
     //fprintf(stderr, "read file %s frames %ld channels %d preset %d handle %ld\n", filename, total_frames, info.channels, preset_number, handle);
     return 1;
 }
 
 
+// Set up a preset to play a WAV file in place: the file is mapped, and the
+// preset's sample_ram points at its frames, so loading costs a header parse
+// and the file is only in memory as far as it's played (and the page cache
+// keeps it).  Unlike a streamed preset it can be indexed anywhere, so it
+// loops, fits and restarts like one in RAM.  It loops the whole file, as
+// pcm_load does by default.  Where it can't be mapped (no mmap, or frames
+// that aren't 16-bit aligned in the file) it's streamed instead, as zF does.
+int pcm_map_file(uint16_t preset_number, const char *filename, float midinote) {
+    pcm_unload_preset(preset_number);
+    if (filename == NULL || filename[0] == '\0') {
+        return 0;
+    }
+#ifdef AMY_PCM_MMAP
+    if (amy_global.config.amy_external_fopen_hook == NULL || amy_global.config.amy_external_fclose_hook == NULL) {
+        fprintf(stderr, "fopen hook not enabled on platform\n");
+        return 0;
+    }
+    uint32_t handle = amy_global.config.amy_external_fopen_hook((char *)filename, "rb");
+    if (handle == 0) {
+        fprintf(stderr, "Could not open file %s\n", filename);
+        return 0;
+    }
+    wave_info_t info = {0};
+    uint32_t data_bytes = 0;
+    int parsed = wave_parse_header(handle, &info, &data_bytes);
+    amy_global.config.amy_external_fclose_hook(handle);
+    if (!parsed) {
+        fprintf(stderr, "Could not parse WAVE file %s\n", filename);
+        return 0;
+    }
+    void *map = MAP_FAILED;
+    size_t map_bytes = 0;
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && (info.data_offset & 1) == 0 && fstat(fd, &st) == 0 && (uint64_t)st.st_size > info.data_offset) {
+        // A data chunk that claims more than the file has stops at its end.
+        if (data_bytes > (uint64_t)st.st_size - info.data_offset)
+            data_bytes = (uint32_t)(st.st_size - info.data_offset);
+        map_bytes = (size_t)info.data_offset + data_bytes;
+        map = mmap(NULL, map_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    if (fd >= 0)  close(fd);
+    uint32_t total_frames = data_bytes / (info.channels * 2);
+    if (map != MAP_FAILED && total_frames == 0) {
+        munmap(map, map_bytes);
+        map = MAP_FAILED;
+    }
+    if (map != MAP_FAILED) {
+        memorypcm_ll_t *new_preset_pointer = malloc_caps(sizeof(memorypcm_ll_t) + sizeof(memorypcm_preset_t),
+                                                         amy_global.config.ram_caps_sample);
+        if (new_preset_pointer == NULL) {
+            munmap(map, map_bytes);
+            fprintf(stderr, "No RAM left for sample load\n");
+            return 0;
+        }
+        memorypcm_preset_t *memory_preset =
+            (memorypcm_preset_t *)(((uint8_t *)new_preset_pointer) + sizeof(memorypcm_ll_t));
+        strncpy(memory_preset->filename, filename, MAX_FILENAME_LEN - 1);
+        memory_preset->filename[MAX_FILENAME_LEN - 1] = '\0';
+        memory_preset->type = AMY_PCM_TYPE_MAPPED;
+        memory_preset->channels = info.channels;
+        memory_preset->samplerate = info.sample_rate;
+        memory_preset->log2sr = log2f((float)info.sample_rate / ZERO_LOGFREQ_IN_HZ);
+        memory_preset->midinote = midinote;
+        memory_preset->length = total_frames;
+        memory_preset->loopstart = 0;
+        memory_preset->loopend = total_frames - 1;
+        memory_preset->file_handle = 0;
+        memory_preset->file_bytes_remaining = 0;
+        memory_preset->stream = NULL;
+        memory_preset->map = map;
+        memory_preset->map_bytes = map_bytes;
+        memory_preset->codes = NULL;
+        memory_preset->shifts = NULL;
+        memory_preset->sample_ram = (int16_t *)((uint8_t *)map + info.data_offset);
+        new_preset_pointer->preset = memory_preset;
+        pcm_index_insert(new_preset_pointer, preset_number);
+        return 1;
+    }
+#endif
+    amy_global.transfer_stored_bytes = (uint32_t)midinote;
+    strncpy(amy_global.transfer_filename, filename, MAX_FILENAME_LEN - 1);
+    amy_global.transfer_filename[MAX_FILENAME_LEN - 1] = '\0';
+    amy_global.transfer_file_handle = preset_number;
+    return pcm_load_file();
+}
+
+
+// Read a WAV file on disk into RAM as a preset, looping the whole file as
+// pcm_load does by default.  It plays like one loaded with pcm_load, but it
+// remembers its file, so under the sample RAM budget it can be evicted while
+// it isn't sounding and read again when it's next played.
+int pcm_read_file(uint16_t preset_number, const char *filename, float midinote) {
+    pcm_unload_preset(preset_number);
+    if (filename == NULL || filename[0] == '\0') {
+        return 0;
+    }
+    memorypcm_ll_t *new_preset_pointer = malloc_caps(sizeof(memorypcm_ll_t) + sizeof(memorypcm_preset_t),
+                                                     amy_global.config.ram_caps_sample);
+    if (new_preset_pointer == NULL) {
+        fprintf(stderr, "No RAM left for sample load\n");
+        return 0;
+    }
+    memorypcm_preset_t *memory_preset =
+        (memorypcm_preset_t *)(((uint8_t *)new_preset_pointer) + sizeof(memorypcm_ll_t));
+    memset(memory_preset, 0, sizeof(*memory_preset));
+    strncpy(memory_preset->filename, filename, MAX_FILENAME_LEN - 1);
+    memory_preset->type = AMY_PCM_TYPE_MEMORY;
+    memory_preset->midinote = midinote;
+    memory_preset->loopend = UINT32_MAX;  // clamped to the last frame
+    if (!pcm_read_frames(memory_preset, false)) {
+        free(new_preset_pointer);
+        return 0;
+    }
+    new_preset_pointer->preset = memory_preset;
+    pcm_index_insert(new_preset_pointer, preset_number);
+#ifdef AMY_PCM_RELOADER
+    // Under a budget it can be evicted, and the reader thread reads it back.
+    if (amy_global.config.sample_ram_budget != 0)  pcm_reader_running(true);
+#endif
+    return 1;
+}
+
+
+// Compress a preset held in RAM as int16 frames (pcm_load's, or
+// pcm_read_file's) in place, to about half its size (see "Compressed
+// presets").  It plays as before, less the quantization, but it's no longer
+// tied to its file: the budget won't evict it, and pcm_get_sample_ram_for_preset
+// has no int16 frames to give for it.  Returns 1 if it compressed it.
+static int pcm_compress_locked(uint16_t preset_number) {
+    memorypcm_ll_t **entry_pointer = pcm_index_bucket(preset_number);
+    while (*entry_pointer != NULL && (*entry_pointer)->preset_number != preset_number)
+        entry_pointer = &(*entry_pointer)->next;
+    memorypcm_ll_t *old_entry = *entry_pointer;
+    if (old_entry == NULL)  return 0;
+    memorypcm_preset_t *old_preset = old_entry->preset;
+    if (old_preset->type != AMY_PCM_TYPE_MEMORY || old_preset->sample_ram == NULL
+        || old_preset->length == 0 || old_preset->channels == 0 || old_preset->channels > 2) {
+        return 0;
+    }
+    // Not while a transfer ('z') or zS is still writing its frames.
+    if ((amy_global.transfer_flag == AMY_TRANSFER_TYPE_AUDIO || amy_global.transfer_flag == AMY_TRANSFER_TYPE_SAMPLE)
+        && amy_global.transfer_storage == (uint8_t *)old_preset->sample_ram) {
+        fprintf(stderr, "Preset %d is still being loaded; not compressing it\n", preset_number);
+        return 0;
+    }
+    uint32_t c8_bytes = pcm_c8_bytes(old_preset->length, old_preset->channels);
+    memorypcm_ll_t *new_entry = malloc_caps(sizeof(memorypcm_ll_t) + sizeof(memorypcm_preset_t) + c8_bytes,
+                                            amy_global.config.ram_caps_sample);
+    if (new_entry == NULL) {
+        fprintf(stderr, "No RAM left to compress preset %d\n", preset_number);
+        return 0;
+    }
+    memorypcm_preset_t *preset = (memorypcm_preset_t *)(((uint8_t *)new_entry) + sizeof(memorypcm_ll_t));
+    *preset = *old_preset;
+    int8_t *codes = (int8_t *)(((uint8_t *)preset) + sizeof(memorypcm_preset_t));
+    uint8_t *shifts = (uint8_t *)(codes + old_preset->length * old_preset->channels + PCM_C8_PAD);
+    pcm_c8_encode(old_preset->sample_ram, old_preset->length, old_preset->channels, codes, shifts);
+    preset->codes = codes;
+    preset->shifts = shifts;
+    preset->sample_ram = NULL;
+    preset->filename[0] = '\0';
+    *new_entry = *old_entry;
+    new_entry->preset = preset;
+    *entry_pointer = new_entry;
+    amy_global.pcm_resident_bytes += preset_ram_bytes(preset);
+    pcm_free_entry(old_entry);
+    return 1;
+}
+
+int pcm_compress_preset(uint16_t preset_number) {
+    // Under the lock, so the budget can't evict the frames it's reading.
+    amy_grab_lock();
+    int compressed = pcm_compress_locked(preset_number);
+    amy_release_lock();
+    return compressed;
+}
+
 // load mono samples (let python parse wave files) into preset # 
 // set loopstart, loopend, midinote, samplerate (and log2sr)
 // return the allocated sample ram that AMY will fill in.
 int16_t * pcm_load(uint16_t preset_number, uint32_t length, uint32_t samplerate, uint8_t channels, float midinote, uint32_t loopstart, uint32_t loopend) {
     // if preset was already a memorypcm, we need to unload it
     pcm_unload_preset(preset_number); // this is a no-op if preset doesn't exist or is a const pcm
+    if (!pcm_reserve(length * channels * sizeof(int16_t), false)) {
+        fprintf(stderr, "No room in the sample RAM budget for sample load\n");
+        return NULL;
+    }
     // now alloc a new LL entry and preset (the old LL entry is removed with pcm_unload_preset)
     memorypcm_ll_t *new_preset_pointer = malloc_caps(sizeof(memorypcm_ll_t) + sizeof(memorypcm_preset_t) + length * channels * sizeof(int16_t),
 						     amy_global.config.ram_caps_sample);
     if(new_preset_pointer  == NULL) {
         fprintf(stderr, "No RAM left for sample load\n");
+        pcm_unreserve(length * channels * sizeof(int16_t), false);
         return NULL; // no ram for sample
     }
-    new_preset_pointer->next = memorypcm_ll_start;
-    memorypcm_ll_start = new_preset_pointer;
-    new_preset_pointer->preset_number = preset_number;
     memorypcm_preset_t *memory_preset = (memorypcm_preset_t *)(((uint8_t *)new_preset_pointer) + sizeof(memorypcm_ll_t));
     memory_preset->samplerate = samplerate;
     memory_preset->log2sr = log2f((float)samplerate / ZERO_LOGFREQ_IN_HZ);
@@ -896,6 +2120,10 @@ int16_t * pcm_load(uint16_t preset_number, uint32_t length, uint32_t samplerate,
     memory_preset->filename[0] = '\0';
     memory_preset->file_bytes_remaining = 0;
     memory_preset->file_handle = 0;
+    memory_preset->stream = NULL;
+    memory_preset->map = NULL;
+    memory_preset->codes = NULL;
+    memory_preset->shifts = NULL;
     memory_preset->type = AMY_PCM_TYPE_MEMORY;
     memory_preset->sample_ram = (int16_t *)(((uint8_t *)memory_preset) + sizeof(memorypcm_preset_t));
     if(loopend == 0) {  // loop whole sample
@@ -904,36 +2132,39 @@ int16_t * pcm_load(uint16_t preset_number, uint32_t length, uint32_t samplerate,
         memory_preset->loopend = loopend;
     }
     new_preset_pointer->preset = memory_preset;
+    pcm_index_insert(new_preset_pointer, preset_number);
     return memory_preset->sample_ram;
 }
 
 void pcm_unload_preset(uint16_t preset_number) {
-    // run through the LL looking for the preset
-    memorypcm_ll_t **preset_pointer = &memorypcm_ll_start;
+    // Under the lock, as an eviction is (see "Sample RAM budget").
+    amy_grab_lock();
+    memorypcm_ll_t **preset_pointer = pcm_index_bucket(preset_number);
     while(*preset_pointer != NULL) {
         if((*preset_pointer)->preset_number == preset_number) {
-            memorypcm_ll_t *next = (*preset_pointer)->next;
-            fclose_if_file((*preset_pointer)->preset);
-            // free the memory we allocated
-            free((*preset_pointer));
+            memorypcm_ll_t *entry = *preset_pointer;
             // close up the list
-            *preset_pointer = next;
+            *preset_pointer = entry->next;
+            pcm_free_entry(entry);
+            amy_release_lock();
             return;
         } else {
             preset_pointer = &(*preset_pointer)->next;
         }
     }
+    amy_release_lock();
     //fprintf(stderr, "pcm_unload_preset: preset %d not found\n", preset_number);  // This happens during a routine load_preset.
 }
 
 void pcm_unload_all_presets() {
-    memorypcm_ll_t *preset_pointer = memorypcm_ll_start;
-    while(preset_pointer != NULL) {
-        memorypcm_ll_t *next_pointer = preset_pointer->next;
-        fclose_if_file(preset_pointer->preset);
-        free(preset_pointer);
-        // Go to the next one
-        preset_pointer = next_pointer;
-    }
-    memorypcm_ll_start = NULL;
+    for (int b = 0; b < PCM_PRESET_INDEX_SIZE; ++b) {
+        memorypcm_ll_t *preset_pointer = memorypcm_index[b];
+        while(preset_pointer != NULL) {
+            memorypcm_ll_t *next_pointer = preset_pointer->next;
+            pcm_free_entry(preset_pointer);
+            // Go to the next one
+            preset_pointer = next_pointer;
+        }
+        memorypcm_index[b] = NULL;
+    }
 }
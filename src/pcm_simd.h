@@ -0,0 +1,207 @@
+// pcm_simd.h
+// Vectorized render_pcm runs (pcm_run), included by pcm.c.
+//
+// Like render_lut_simd.h's, these kernels do N consecutive samples a pass,
+// one per lane: lane k's phase is the run's phase plus k steps, wrapped as
+// P_WRAPPED_SUM wraps it, and its frame and interpolation fraction come out
+// of that as INT_OF_P and S_FRAC_OF_P take them.  The interpolation and the
+// mix into buf are MUL4_SS's 32-bit integer math, so the output is
+// bit-identical to pcm_run_scalar's; tests/test_pcm_kernels.c checks that.
+//
+// pcm_run_length keeps a run from reading past the frame after its last, so
+// the AVX2 kernels gather frames whole: one 32-bit gather fetches a mono
+// frame and the one after it, or both channels of a stereo frame.  The
+// 128-bit ones read lane by lane and do the arithmetic in vectors.
+//
+// A compressed preset's kernels ("Compressed presets" in pcm.c) decode as
+// they go: the AVX2 ones gather a word of codes and one of shifts a lane,
+// which the pads after each keep inside the preset, and shift the codes up
+// in vectors.
+
+#ifndef __PCM_SIMD_H
+#define __PCM_SIMD_H
+
+// Fixed point only: float runs are all sample-by-sample (pcm_run_length).
+#if defined(AMY_RENDER_LUT_SIMD) && defined(AMY_USE_FIXEDPOINT)  // see amy.h
+
+typedef int32_t pcm_v4i __attribute__((vector_size(16)));
+typedef uint32_t pcm_v4u __attribute__((vector_size(16)));
+#ifdef __x86_64__
+#include <immintrin.h>
+typedef int32_t pcm_v8i __attribute__((vector_size(32)));
+typedef uint32_t pcm_v8u __attribute__((vector_size(32)));
+#define PCM_SIMD128_ATTR __attribute__((target("sse4.1")))
+#define PCM_SIMD256_ATTR __attribute__((target("avx2")))
+#else
+#define PCM_SIMD128_ATTR
+#endif
+
+// MUL4_SS on lanes.  The product is formed unsigned so that it wraps, as the
+// scalar one does in practice, rather than being undefined.
+#define PCM_SIMD_MUL4(V, U, a, b) \
+    ((V)((U)((a) >> 10) * (U)((b) >> 9)) >> (S_FRAC_BITS - 19))
+
+// The low and high 16 bits of each lane, sign-extended.
+#define PCM_SIMD_LO(V, x) (((x) << 16) >> 16)
+#define PCM_SIMD_HI(V, x) ((x) >> 16)
+
+// (l + r) / 2 per lane, truncating toward zero as C's division does.
+#define PCM_SIMD_MIX(V, U, l, r) \
+    ((V)((l) + (r) + (V)((U)((l) + (r)) >> 31)) >> 1)
+
+// Frames b (at idx) and c (the one after), lane by lane.
+#define PCM_SIMD_FRAMES_LANES(V, U, N, LAYOUT, table, codes, shifts, idx, b, c) \
+    for (int k = 0; k < N; ++k) { \
+        b[k] = pcm_frame(table, idx[k], LAYOUT); \
+        c[k] = pcm_frame(table, idx[k] + 1, LAYOUT); \
+    }
+
+#define PCM_SIMD_FRAMES_LANES_C8(V, U, N, LAYOUT, table, codes, shifts, idx, b, c) \
+    for (int k = 0; k < N; ++k) { \
+        b[k] = pcm_frame_c8(codes, shifts, idx[k], LAYOUT); \
+        c[k] = pcm_frame_c8(codes, shifts, idx[k] + 1, LAYOUT); \
+    }
+
+#ifdef __x86_64__
+// Frames b and c with 32-bit gathers (scaled by 2, a LUTSAMPLE's size).
+#define PCM_SIMD_FRAMES_GATHER(V, U, N, LAYOUT, table, codes, shifts, idx, b, c) \
+    if (LAYOUT == PCM_LAYOUT_MONO) { \
+        V pair = (V)_mm256_i32gather_epi32((const int *)table, (__m256i)idx, 2); \
+        b = PCM_SIMD_LO(V, pair); \
+        c = PCM_SIMD_HI(V, pair); \
+    } else { \
+        V this_frame = (V)_mm256_i32gather_epi32((const int *)table, (__m256i)(idx << 1), 2); \
+        V next_frame = (V)_mm256_i32gather_epi32((const int *)table, (__m256i)((idx + 1) << 1), 2); \
+        if (LAYOUT == PCM_LAYOUT_LEFT) { \
+            b = PCM_SIMD_LO(V, this_frame); \
+            c = PCM_SIMD_LO(V, next_frame); \
+        } else if (LAYOUT == PCM_LAYOUT_RIGHT) { \
+            b = PCM_SIMD_HI(V, this_frame); \
+            c = PCM_SIMD_HI(V, next_frame); \
+        } else { \
+            b = PCM_SIMD_MIX(V, U, PCM_SIMD_LO(V, this_frame), PCM_SIMD_HI(V, this_frame)); \
+            c = PCM_SIMD_MIX(V, U, PCM_SIMD_LO(V, next_frame), PCM_SIMD_HI(V, next_frame)); \
+        } \
+    }
+
+// Byte k of each lane, sign-extended.
+#define PCM_SIMD_BYTE(V, x, k) (((x) << (24 - 8 * (k))) >> 24)
+
+// Compressed frames b and c with byte-scaled gathers: the shift word at the
+// frame's block gives b's shift in its low byte, and c's too unless c
+// starts the next block.  A mono frame's code word holds b's code and c's, a
+// stereo frame's both channels of b and of c.
+#define PCM_SIMD_FRAMES_GATHER_C8(V, U, N, LAYOUT, table, codes, shifts, idx, b, c) \
+    { \
+        V shift_word = (V)_mm256_i32gather_epi32((const int *)shifts, (__m256i)(idx / PCM_C8_BLOCK), 1); \
+        V b_shift = shift_word & 0xff; \
+        V c_starts_block = (V)((idx + 1) % PCM_C8_BLOCK == 0); \
+        V c_shift = ((shift_word >> 8 & 0xff) & c_starts_block) | (b_shift & ~c_starts_block); \
+        if (LAYOUT == PCM_LAYOUT_MONO) { \
+            V word = (V)_mm256_i32gather_epi32((const int *)codes, (__m256i)idx, 1); \
+            b = (V)((U)PCM_SIMD_BYTE(V, word, 0) << (U)b_shift); \
+            c = (V)((U)PCM_SIMD_BYTE(V, word, 1) << (U)c_shift); \
+        } else { \
+            V word = (V)_mm256_i32gather_epi32((const int *)codes, (__m256i)(idx << 1), 1); \
+            V bl = (V)((U)PCM_SIMD_BYTE(V, word, 0) << (U)b_shift); \
+            V br = (V)((U)PCM_SIMD_BYTE(V, word, 1) << (U)b_shift); \
+            V cl = (V)((U)PCM_SIMD_BYTE(V, word, 2) << (U)c_shift); \
+            V cr = (V)((U)PCM_SIMD_BYTE(V, word, 3) << (U)c_shift); \
+            if (LAYOUT == PCM_LAYOUT_LEFT) { \
+                b = bl; \
+                c = cl; \
+            } else if (LAYOUT == PCM_LAYOUT_RIGHT) { \
+                b = br; \
+                c = cr; \
+            } else { \
+                b = PCM_SIMD_MIX(V, U, bl, br); \
+                c = PCM_SIMD_MIX(V, U, cl, cr); \
+            } \
+        } \
+    }
+#endif
+
+// NAME renders the whole multiples of N of a run into buf, sets *max_value
+// to the largest magnitude it left there, and returns how many it did.
+#define PCM_RUN_SIMD(NAME, ATTR, V, U, N, LAYOUT, FRAMES) \
+static ATTR uint16_t NAME(SAMPLE *buf, uint16_t n, const memorypcm_preset_t *preset, uint32_t base_index_base, \
+                          PHASOR phase, PHASOR step, SAMPLE amp, SAMPLE *max_value) { \
+    const LUTSAMPLE *table = preset->sample_ram; \
+    const int8_t *codes = preset->codes; \
+    const uint8_t *shifts = preset->shifts; \
+    (void)table; (void)codes; (void)shifts; \
+    U lane_phase; \
+    for (int k = 0; k < N; ++k)  lane_phase[k] = ((uint32_t)phase + (uint32_t)step * k) & 0x7fffffff; \
+    uint32_t pass_step = (uint32_t)step * N; \
+    V max_lanes = (V){0}; \
+    uint16_t i = 0; \
+    for (; i + N <= n; i += N) { \
+        U idx = (lane_phase >> PCM_RUN_SHIFT) + base_index_base; \
+        V frac = (V)((lane_phase << (32 - PCM_RUN_SHIFT)) >> (1 + P_FRAC_BITS - S_FRAC_BITS)); \
+        V b, c; \
+        FRAMES(V, U, N, LAYOUT, table, codes, shifts, idx, b, c) \
+        b <<= S_FRAC_BITS - L_FRAC_BITS; \
+        c <<= S_FRAC_BITS - L_FRAC_BITS; \
+        V sample = b + PCM_SIMD_MUL4(V, U, c - b, frac); \
+        V value; \
+        memcpy(&value, buf + i, sizeof(value)); \
+        value += PCM_SIMD_MUL4(V, U, (V){0} + amp, sample); \
+        memcpy(buf + i, &value, sizeof(value)); \
+        V sign = value >> 31; \
+        V magnitude = (value ^ sign) - sign; \
+        V bigger = magnitude > max_lanes; \
+        max_lanes = (magnitude & bigger) | (max_lanes & ~bigger); \
+        lane_phase = (lane_phase + pass_step) & 0x7fffffff; \
+    } \
+    SAMPLE max_run = 0; \
+    for (int k = 0; k < N; ++k)  if (max_lanes[k] > max_run)  max_run = max_lanes[k]; \
+    *max_value = max_run; \
+    return i; \
+}
+
+PCM_RUN_SIMD(pcm_run_mono_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_MONO, PCM_SIMD_FRAMES_LANES)
+PCM_RUN_SIMD(pcm_run_left_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_LEFT, PCM_SIMD_FRAMES_LANES)
+PCM_RUN_SIMD(pcm_run_right_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_RIGHT, PCM_SIMD_FRAMES_LANES)
+PCM_RUN_SIMD(pcm_run_mix_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_MIX, PCM_SIMD_FRAMES_LANES)
+PCM_RUN_SIMD(pcm_run_mono_c8_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_MONO, PCM_SIMD_FRAMES_LANES_C8)
+PCM_RUN_SIMD(pcm_run_left_c8_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_LEFT, PCM_SIMD_FRAMES_LANES_C8)
+PCM_RUN_SIMD(pcm_run_right_c8_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_RIGHT, PCM_SIMD_FRAMES_LANES_C8)
+PCM_RUN_SIMD(pcm_run_mix_c8_simd128, PCM_SIMD128_ATTR, pcm_v4i, pcm_v4u, 4, PCM_LAYOUT_MIX, PCM_SIMD_FRAMES_LANES_C8)
+#ifdef __x86_64__
+PCM_RUN_SIMD(pcm_run_mono_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_MONO, PCM_SIMD_FRAMES_GATHER)
+PCM_RUN_SIMD(pcm_run_left_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_LEFT, PCM_SIMD_FRAMES_GATHER)
+PCM_RUN_SIMD(pcm_run_right_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_RIGHT, PCM_SIMD_FRAMES_GATHER)
+PCM_RUN_SIMD(pcm_run_mix_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_MIX, PCM_SIMD_FRAMES_GATHER)
+PCM_RUN_SIMD(pcm_run_mono_c8_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_MONO, PCM_SIMD_FRAMES_GATHER_C8)
+PCM_RUN_SIMD(pcm_run_left_c8_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_LEFT, PCM_SIMD_FRAMES_GATHER_C8)
+PCM_RUN_SIMD(pcm_run_right_c8_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_RIGHT, PCM_SIMD_FRAMES_GATHER_C8)
+PCM_RUN_SIMD(pcm_run_mix_c8_simd256, PCM_SIMD256_ATTR, pcm_v8i, pcm_v8u, 8, PCM_LAYOUT_MIX, PCM_SIMD_FRAMES_GATHER_C8)
+// Calls pcm_run_KERNEL_simd256 or _simd128 per render_lut_simd.
+#define PCM_SIMD_CALL(KERNEL, ...) \
+    (render_lut_simd == RENDER_LUT_SIMD256 ? pcm_run_##KERNEL##_simd256(__VA_ARGS__) : pcm_run_##KERNEL##_simd128(__VA_ARGS__))
+#else
+#define PCM_SIMD_CALL(KERNEL, ...)  pcm_run_##KERNEL##_simd128(__VA_ARGS__)
+#endif
+
+// The vector part of pcm_run; the caller finishes the rest with the scalar
+// kernel.
+static uint16_t pcm_run_simd(SAMPLE *buf, uint16_t n, const memorypcm_preset_t *preset, uint8_t layout,
+                             bool compressed, uint32_t base_index_base, PHASOR phase, PHASOR step,
+                             SAMPLE amp, SAMPLE *max_value) {
+#define PCM_SIMD_ARGS buf, n, preset, base_index_base, phase, step, amp, max_value
+    switch (layout) {
+        case PCM_LAYOUT_LEFT:
+            return compressed ? PCM_SIMD_CALL(left_c8, PCM_SIMD_ARGS) : PCM_SIMD_CALL(left, PCM_SIMD_ARGS);
+        case PCM_LAYOUT_RIGHT:
+            return compressed ? PCM_SIMD_CALL(right_c8, PCM_SIMD_ARGS) : PCM_SIMD_CALL(right, PCM_SIMD_ARGS);
+        case PCM_LAYOUT_MIX:
+            return compressed ? PCM_SIMD_CALL(mix_c8, PCM_SIMD_ARGS) : PCM_SIMD_CALL(mix, PCM_SIMD_ARGS);
+        default:
+            return compressed ? PCM_SIMD_CALL(mono_c8, PCM_SIMD_ARGS) : PCM_SIMD_CALL(mono, PCM_SIMD_ARGS);
+    }
+#undef PCM_SIMD_ARGS
+}
+
+#endif  // AMY_RENDER_LUT_SIMD
+
+#endif  // __PCM_SIMD_H
@@ -124,6 +124,24 @@ static int parse_live_kwarg(amy_config_t *cfg, const char *key, PyObject *value)
         }
         cfg->max_memory_patches = (uint32_t)llv;
         return 0;
+    } else if (strcmp(key, "max_cached_patches") == 0) {
+        llv = PyLong_AsLongLong(value);
+        if (PyErr_Occurred()) return -1;
+        if (llv < 0 || (unsigned long long)llv > UINT32_MAX) {
+            PyErr_SetString(PyExc_ValueError, "max_cached_patches must be in range [0, 4294967295]");
+            return -1;
+        }
+        cfg->max_cached_patches = (uint32_t)llv;
+        return 0;
+    } else if (strcmp(key, "sample_ram_budget") == 0) {
+        llv = PyLong_AsLongLong(value);
+        if (PyErr_Occurred()) return -1;
+        if (llv < 0 || (unsigned long long)llv > UINT32_MAX) {
+            PyErr_SetString(PyExc_ValueError, "sample_ram_budget must be in range [0, 4294967295]");
+            return -1;
+        }
+        cfg->sample_ram_budget = (uint32_t)llv;
+        return 0;
     } else if (strcmp(key, "capture_device_id") == 0) {
         lv = PyLong_AsLong(value);
         if (PyErr_Occurred()) return -1;
@@ -239,6 +257,52 @@ static PyObject * inject_midi_bytes_wrapper(PyObject *self, PyObject *args) {
     Py_RETURN_NONE;
 }
 
+static PyObject * send_binary_event_wrapper(PyObject *self, PyObject *args) {
+    // Play / schedule a binary event (amy.binary_message() makes them).
+    Py_buffer buf;
+    if (!PyArg_ParseTuple(args, "y*", &buf))
+        return NULL;
+    int used = amy_add_binary_event((const uint8_t *)buf.buf, (size_t)buf.len);
+    PyBuffer_Release(&buf);
+    if (used < 0) {
+        PyErr_SetString(PyExc_ValueError, "not a binary event this AMY can read");
+        return NULL;
+    }
+    return PyLong_FromLong(used);
+}
+
+static PyObject * send_binary_events_wrapper(PyObject *self, PyObject *args) {
+    // Play / schedule binary events back to back in one buffer, as a batch.
+    Py_buffer buf;
+    if (!PyArg_ParseTuple(args, "y*", &buf))
+        return NULL;
+    int events = amy_add_binary_events((const uint8_t *)buf.buf, (size_t)buf.len);
+    PyBuffer_Release(&buf);
+    if (events < 0) {
+        PyErr_SetString(PyExc_ValueError, "not binary events this AMY can read");
+        return NULL;
+    }
+    return PyLong_FromLong(events);
+}
+
+static PyObject * binary_event_to_wire_wrapper(PyObject *self, PyObject *args) {
+    // Decode a binary event and return it as the wire string sprint_event()
+    // writes for it, so the two encodings can be compared.
+    Py_buffer buf;
+    if (!PyArg_ParseTuple(args, "y*", &buf))
+        return NULL;
+    amy_event e;
+    int used = amy_binary_to_event((const uint8_t *)buf.buf, (size_t)buf.len, &e);
+    PyBuffer_Release(&buf);
+    if (used < 0) {
+        PyErr_SetString(PyExc_ValueError, "not a binary event this AMY can read");
+        return NULL;
+    }
+    char s[MAX_MESSAGE_LEN];
+    sprint_event(&e, s, MAX_MESSAGE_LEN, /* wirecode */ true);
+    return PyUnicode_FromString(s);
+}
+
 static PyMethodDef c_amyMethods[] = {
     {"render_to_list", render_wrapper, METH_VARARGS, "Render audio"},
     {"live", (PyCFunction)live_wrapper, METH_VARARGS | METH_KEYWORDS, "Live AMY"},
@@ -246,6 +310,9 @@ static PyMethodDef c_amyMethods[] = {
     {"stop", amystop_wrapper, METH_VARARGS, "Stop AMY"},
     {"config", config_wrapper, METH_VARARGS, "Return config"},
     {"inject_midi_bytes", inject_midi_bytes_wrapper, METH_VARARGS, "Inject a raw MIDI byte stream through the parser"},
+    {"send_binary_event", send_binary_event_wrapper, METH_VARARGS, "Play / schedule a binary event"},
+    {"send_binary_events", send_binary_events_wrapper, METH_VARARGS, "Play / schedule binary events as a batch"},
+    {"binary_event_to_wire", binary_event_to_wire_wrapper, METH_VARARGS, "Decode a binary event to its wire string"},
 #include "amy_c_api_py_table.inc"
     { NULL, NULL, 0, NULL }
 };
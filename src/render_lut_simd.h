@@ -0,0 +1,555 @@
+// render_lut_simd.h
+// Vectorized versions of the render_lut kernels, included by oscillators.c.
+//
+// Each kernel renders N consecutive samples per pass, one per lane.  Lane k
+// starts at phase + k*step and amp incoming + k*incremental, and every pass
+// moves all lanes on by N steps, so each lane walks exactly the phases and
+// amps the scalar loop would.  All the arithmetic is the same 32-bit integer
+// math as RENDER_LUT_GUTS (wrapping multiplies, arithmetic shifts), so the
+// output is bit-identical to the scalar kernels -- tests/test_lut_simd.c
+// checks that for every wave and lut size.
+//
+// The float build (AMY_USE_FLOAT) has its own kernels on float lanes.  As
+// in the float RENDER_LUT_GUTS, sample i is at phase + i * step and amp
+// incoming + i * incremental, and the table index and fraction come from
+// one truncating floor, so each lane does the same float operations as the
+// scalar loop and the output matches it; tests/test_lut_simd-float checks
+// that.  The table reads, below, are shared: both builds' tables are int16.
+//
+// The kernels are written once with GCC/Clang vector extensions and built
+// for 128-bit (SSE4.1 on x86-64, NEON on AArch64) and, on x86-64, 256-bit
+// (AVX2) vectors.  x86 builds don't assume either, so the level is picked at
+// startup from the CPU (render_lut_simd_init).  Each sample needs the pair
+// of table entries its phase falls between.  The 128-bit kernels (SSE4.1,
+// NEON) load each pair lane by lane.  The AVX2 kernels fetch each lane's pair
+// with one 32-bit gather.  The saw and triangle tables have no guard point,
+// so a lane whose pair starts at the last entry is masked off the gather,
+// which would read past the table's end, and takes the wrapped pair (the
+// last entry and the first) instead.  The sine table has a guard point and
+// gathers every lane unmasked (see LUT_SIMD_PAIRS_*).
+//
+// The *_lanes kernels run the other way round, one osc per lane, so oscs
+// from different voices that share a LUT render in lockstep (see the
+// cross-voice batching in amy.c), and MIX_LUT_LANES_KERNEL pans them all
+// into the mix in one pass.
+//
+// The feedback kernels (render_lut_fb, render_lut_fm_fb) need each sample
+// before the next phase, so they stay scalar.
+
+#ifndef __RENDER_LUT_SIMD_H
+#define __RENDER_LUT_SIMD_H
+
+#ifdef AMY_RENDER_LUT_SIMD  // see amy.h
+
+typedef int32_t lut_v4i __attribute__((vector_size(16)));
+typedef uint32_t lut_v4u __attribute__((vector_size(16)));
+#ifndef AMY_USE_FIXEDPOINT
+typedef float lut_v4f __attribute__((vector_size(16)));
+#endif
+#ifdef __x86_64__
+typedef int32_t lut_v8i __attribute__((vector_size(32)));
+typedef uint32_t lut_v8u __attribute__((vector_size(32)));
+#ifndef AMY_USE_FIXEDPOINT
+typedef float lut_v8f __attribute__((vector_size(32)));
+#endif
+#define LUT_SIMD128_ATTR __attribute__((target("sse4.1")))
+#define LUT_SIMD256_ATTR __attribute__((target("avx2")))
+#else
+#define LUT_SIMD128_ATTR
+#endif
+
+// Table reads, as pairs: lo gets table[at] and hi the entry after it, for
+// each lane.  The 128-bit kernels read lane by lane.  The AVX2 kernels fetch
+// each pair with one 32-bit gather; a pair starting at the last entry would
+// read past a table with no guard point, so those lanes are masked off the
+// gather and take the wrapped pair instead.
+#define LUT_SIMD_PAIRS_4(V, at, lo, hi) \
+            for (int k = 0; k < 4; ++k) { \
+                lo[k] = table[at[k]]; \
+                hi[k] = table[(at[k] + 1) & lut_mask]; \
+            }
+// The sine table has a guard point, so its pairs never wrap.
+#define LUT_SIMD_GUARDED_PAIRS_4(V, at, lo, hi) \
+            for (int k = 0; k < 4; ++k) { \
+                lo[k] = table[at[k]]; \
+                hi[k] = table[at[k] + 1]; \
+            }
+#ifdef __x86_64__
+#include <immintrin.h>
+#define LUT_SIMD_PAIRS_8(V, at, lo, hi) { \
+                V in_range = (V)at != lut_mask; \
+                V pair = (V)_mm256_mask_i32gather_epi32((__m256i)((V){0} + wrapped_pair), (const int *)table, \
+                                                        (__m256i)at, (__m256i)in_range, 2); \
+                lo = (pair << 16) >> 16; \
+                hi = pair >> 16; \
+            }
+#define LUT_SIMD_GUARDED_PAIRS_8(V, at, lo, hi) { \
+                V pair = (V)_mm256_i32gather_epi32((const int *)table, (__m256i)at, 2); \
+                lo = (pair << 16) >> 16; \
+                hi = pair >> 16; \
+            }
+#endif
+
+// Per-kernel table setup for LUT_SIMD_PAIRS_*.
+#define LUT_SIMD_TABLE \
+    int lut_mask = lut->table_size - 1; \
+    int lut_bits = lut->log_2_table_size; \
+    const LUTSAMPLE *table = lut->table; \
+    int32_t wrapped_pair = (int32_t)(((uint32_t)(uint16_t)table[0] << 16) | (uint16_t)table[lut_mask]); \
+    (void)wrapped_pair; (void)lut_bits;
+
+#ifdef AMY_USE_FIXEDPOINT
+
+// FXMUL_TEMPLATE on lanes.  The product is formed unsigned so it wraps the
+// way the scalar multiply does in practice.
+#define LUT_SIMD_MUL(V, U, a, b, a_bitloss, b_bitloss) \
+    ((V)((U)((a) >> a_bitloss) * (U)((b) >> b_bitloss)) >> (S_FRAC_BITS - a_bitloss - b_bitloss))
+
+#define LUT_SIMD_INTERP_LINEAR(V, U, N) \
+            V b, c; \
+            LUT_SIMD_PAIRS_##N(V, idx, b, c) \
+            b <<= S_FRAC_BITS - L_FRAC_BITS; \
+            c <<= S_FRAC_BITS - L_FRAC_BITS; \
+            V sample = b + LUT_SIMD_MUL(V, U, c - b, frac, 8, 7);
+
+#define LUT_SIMD_INTERP_CUBIC(V, U, N) \
+            V a, b, c, d; \
+            U prev_idx = (idx - 1) & lut_mask; \
+            U next_idx = (idx + 1) & lut_mask; \
+            LUT_SIMD_PAIRS_##N(V, prev_idx, a, b) \
+            LUT_SIMD_PAIRS_##N(V, next_idx, c, d) \
+            a <<= S_FRAC_BITS - L_FRAC_BITS; \
+            b <<= S_FRAC_BITS - L_FRAC_BITS; \
+            c <<= S_FRAC_BITS - L_FRAC_BITS; \
+            d <<= S_FRAC_BITS - L_FRAC_BITS; \
+            V cminusb = c - b; \
+            V fr_d_ma_m3cmb = LUT_SIMD_MUL(V, U, d - a - cminusb - (cminusb << 1), frac, 8, 7); \
+            V one_minus_frac = F2S(1.0f) - frac; \
+            V next_bit = LUT_SIMD_MUL(V, U, fr_d_ma_m3cmb + d + ((a - b) << 1) - b, \
+                                      LUT_SIMD_MUL(V, U, one_minus_frac, one_sixth, 8, 7), 8, 7); \
+            V sample = b + LUT_SIMD_MUL(V, U, cminusb - next_bit, frac, 8, 7);
+
+// Sine: a 256-entry table with a guard point, phase held as _32.
+#define LUT_SIMD_INTERP_SINE(V, U, N) \
+            V b, c; \
+            LUT_SIMD_GUARDED_PAIRS_##N(V, idx, b, c) \
+            b <<= S_FRAC_BITS - L_FRAC_BITS; \
+            c <<= S_FRAC_BITS - L_FRAC_BITS; \
+            V sample = b + LUT_SIMD_MUL(V, U, c - b, frac, 8, 7);
+
+#define LUT_SIMD_MOD_NONE(V, U)
+#define LUT_SIMD_MOD_FM(V, U) \
+            V m; \
+            memcpy(&m, mod + i, sizeof(m)); \
+            total_phase += (U)m << (P_FRAC_BITS - S_FRAC_BITS);
+
+// Accumulate into buf, track the largest magnitude, step amp.
+#define LUT_SIMD_LOOP_END(V, U) \
+            V value; \
+            memcpy(&value, buf + i, sizeof(value)); \
+            value += LUT_SIMD_MUL(V, U, sample, amp, 9, 11); \
+            memcpy(buf + i, &value, sizeof(value)); \
+            V sign = value >> 31; \
+            V mag = (value ^ sign) - sign; \
+            V bigger = mag > max_lanes; \
+            max_lanes = (mag & bigger) | (max_lanes & ~bigger); \
+            amp += amp_step;
+
+#define LUT_SIMD_MAX_VALUE(N) \
+    SAMPLE max_value = 0; \
+    for (int k = 0; k < N; ++k)  if (max_lanes[k] > max_value)  max_value = max_lanes[k]; \
+    *pmax_value = max_value;
+
+// Same arguments as render_lut_fm; mod is ignored by the kernels without FM.
+#define RENDER_LUT_SIMD_KERNEL(NAME, ATTR, V, U, N, MOD_PART, INTERP_PART) \
+static ATTR PHASOR NAME(SAMPLE *buf, PHASOR phase, PHASOR step, \
+                        SAMPLE incoming_amp, SAMPLE ending_amp, \
+                        const LUT *lut, SAMPLE *mod, SAMPLE *pmax_value) { \
+    LUT_SIMD_TABLE \
+    SAMPLE incremental_amp = SHIFTR(ending_amp - incoming_amp, BLOCK_SIZE_BITS); \
+    const V one_sixth = (V){0} + F2S(0.16666666666667f); \
+    (void)one_sixth; \
+    V lane; \
+    for (int k = 0; k < N; ++k)  lane[k] = k; \
+    U lane_phase = ((U)lane * (uint32_t)step + (uint32_t)phase) & 0x7fffffff; \
+    uint32_t phase_step = (uint32_t)step * N; \
+    V amp = lane * incremental_amp + incoming_amp; \
+    SAMPLE amp_step = incremental_amp * N; \
+    V max_lanes = {0}; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; i += N) { \
+            U total_phase = lane_phase; \
+            MOD_PART(V, U) \
+            U idx = (total_phase << 1) >> (P_FRAC_BITS + 1 - lut_bits); \
+            V frac = (V)((total_phase << (lut_bits + 1)) >> (1 + P_FRAC_BITS - S_FRAC_BITS)); \
+            INTERP_PART(V, U, N) \
+            LUT_SIMD_LOOP_END(V, U) \
+            lane_phase = (lane_phase + phase_step) & 0x7fffffff; \
+    } \
+    LUT_SIMD_MAX_VALUE(N) \
+    return (PHASOR)(((uint32_t)phase + (uint32_t)step * AMY_BLOCK_SIZE) & 0x7fffffff); \
+}
+
+// render_lut_256: phase held as _32, so the wrap is free, and the sine table
+// has a guard point, so no index masking.
+#define RENDER_LUT_256_SIMD_KERNEL(NAME, ATTR, V, U, N) \
+static ATTR PHASOR NAME(SAMPLE *buf, PHASOR phase, PHASOR step, \
+                        SAMPLE incoming_amp, SAMPLE ending_amp, \
+                        const LUT *lut, SAMPLE *mod, SAMPLE *pmax_value) { \
+    const LUTSAMPLE *table = lut->table; \
+    SAMPLE incremental_amp = SHIFTR(ending_amp - incoming_amp, BLOCK_SIZE_BITS); \
+    uint32_t phase32 = (uint32_t)phase << 1; \
+    uint32_t step32 = (uint32_t)step << 1; \
+    V lane; \
+    for (int k = 0; k < N; ++k)  lane[k] = k; \
+    U lane_phase = (U)lane * step32 + phase32; \
+    uint32_t phase_step = step32 * N; \
+    V amp = lane * incremental_amp + incoming_amp; \
+    SAMPLE amp_step = incremental_amp * N; \
+    V max_lanes = {0}; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; i += N) { \
+            U idx = lane_phase >> 24; \
+            V frac = (V)((lane_phase << 8) >> 9); \
+            LUT_SIMD_INTERP_SINE(V, U, N) \
+            LUT_SIMD_LOOP_END(V, U) \
+            lane_phase += phase_step; \
+    } \
+    LUT_SIMD_MAX_VALUE(N) \
+    return SHIFTR((PHASOR)(phase32 + step32 * AMY_BLOCK_SIZE), 1); \
+}
+
+// Cross-voice kernels: lane k is a whole osc rather than a sample, so each
+// pass renders the same sample of N oscs that share a LUT.  Each lane's block
+// is what the single-osc kernel would write into a zeroed buffer, laid out
+// lane-interleaved, tile[i * N + k], for MIX_LUT_LANES_KERNEL to pan into
+// the mix.  lanes[k].phase is advanced as the single-osc kernel would return it.
+#define LUT_LANES_SETUP(V, U, N) \
+    U lane_phase, step; \
+    V amp, amp_step; \
+    for (int k = 0; k < N; ++k) { \
+        lane_phase[k] = (uint32_t)lanes[k].phase; \
+        step[k] = (uint32_t)lanes[k].step; \
+        amp[k] = lanes[k].incoming_amp; \
+        amp_step[k] = SHIFTR(lanes[k].ending_amp - lanes[k].incoming_amp, BLOCK_SIZE_BITS); \
+    } \
+    V max_lanes = {0};
+
+#define LUT_LANES_LOOP_END(V, U, N) \
+            V value = LUT_SIMD_MUL(V, U, sample, amp, 9, 11); \
+            memcpy(tile + i * N, &value, sizeof(value)); \
+            V sign = value >> 31; \
+            V mag = (value ^ sign) - sign; \
+            V bigger = mag > max_lanes; \
+            max_lanes = (mag & bigger) | (max_lanes & ~bigger); \
+            amp += amp_step;
+
+#define RENDER_LUT_LANES_KERNEL(NAME, ATTR, V, U, N, INTERP_PART) \
+static ATTR void NAME(const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values) { \
+    LUT_SIMD_TABLE \
+    const V one_sixth = (V){0} + F2S(0.16666666666667f); \
+    (void)one_sixth; \
+    LUT_LANES_SETUP(V, U, N) \
+    lane_phase &= 0x7fffffff; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            U total_phase = lane_phase; \
+            U idx = (total_phase << 1) >> (P_FRAC_BITS + 1 - lut_bits); \
+            V frac = (V)((total_phase << (lut_bits + 1)) >> (1 + P_FRAC_BITS - S_FRAC_BITS)); \
+            INTERP_PART(V, U, N) \
+            LUT_LANES_LOOP_END(V, U, N) \
+            lane_phase = (lane_phase + step) & 0x7fffffff; \
+    } \
+    for (int k = 0; k < N; ++k) { \
+        max_values[k] = max_lanes[k]; \
+        lanes[k].phase = (PHASOR)lane_phase[k]; \
+    } \
+}
+
+#define RENDER_LUT_256_LANES_KERNEL(NAME, ATTR, V, U, N) \
+static ATTR void NAME(const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values) { \
+    const LUTSAMPLE *table = lut->table; \
+    LUT_LANES_SETUP(V, U, N) \
+    lane_phase <<= 1; \
+    step <<= 1; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            U idx = lane_phase >> 24; \
+            V frac = (V)((lane_phase << 8) >> 9); \
+            LUT_SIMD_INTERP_SINE(V, U, N) \
+            LUT_LANES_LOOP_END(V, U, N) \
+            lane_phase += step; \
+    } \
+    for (int k = 0; k < N; ++k) { \
+        max_values[k] = max_lanes[k]; \
+        lanes[k].phase = SHIFTR((PHASOR)lane_phase[k], 1); \
+    } \
+}
+
+// mix_with_pan for a whole tile: each lane's samples get its own gain ramp
+// (MUL8_SS), and the lanes' products are summed into the stereo block.
+#define MIX_LUT_LANES_KERNEL(NAME, ATTR, V, U, N) \
+static ATTR void NAME(SAMPLE *stereo_dest, const SAMPLE *tile, const lut_lane_t *lanes) { \
+    V gain_l, gain_r, d_gain_l, d_gain_r; \
+    for (int k = 0; k < N; ++k) { \
+        gain_l[k] = lanes[k].gain_l; \
+        gain_r[k] = lanes[k].gain_r; \
+        d_gain_l[k] = lanes[k].d_gain_l; \
+        d_gain_r[k] = lanes[k].d_gain_r; \
+    } \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+        V value; \
+        memcpy(&value, tile + i * N, sizeof(value)); \
+        V left = LUT_SIMD_MUL(V, U, gain_l, value, 12, 11); \
+        V right = LUT_SIMD_MUL(V, U, gain_r, value, 12, 11); \
+        SAMPLE sum_l = 0, sum_r = 0; \
+        for (int k = 0; k < N; ++k) { \
+            sum_l += left[k]; \
+            sum_r += right[k]; \
+        } \
+        stereo_dest[i] += sum_l; \
+        stereo_dest[AMY_BLOCK_SIZE + i] += sum_r; \
+        gain_l += d_gain_l; \
+        gain_r += d_gain_r; \
+    } \
+}
+
+RENDER_LUT_SIMD_KERNEL(render_lut_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_fm_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4, LUT_SIMD_MOD_FM, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_cub_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_SIMD_KERNEL(render_lut_256_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4)
+RENDER_LUT_LANES_KERNEL(render_lut_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_LANES_KERNEL(render_lut_cub_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_LANES_KERNEL(render_lut_256_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4)
+MIX_LUT_LANES_KERNEL(mix_lut_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, 4)
+#ifdef __x86_64__
+RENDER_LUT_SIMD_KERNEL(render_lut_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_fm_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8, LUT_SIMD_MOD_FM, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_cub_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_SIMD_KERNEL(render_lut_256_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8)
+RENDER_LUT_LANES_KERNEL(render_lut_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_LANES_KERNEL(render_lut_cub_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_LANES_KERNEL(render_lut_256_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8)
+MIX_LUT_LANES_KERNEL(mix_lut_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, 8)
+#endif
+
+#else  // !AMY_USE_FIXEDPOINT
+
+// RENDER_LUT_FLOOR on lanes (a compare is -1 where true), then the table
+// index and the fraction from it, as the float RENDER_LUT_GUTS takes them.
+#define LUT_SIMD_POSITION(V, U, F, table_pos, mask) \
+            V table_floor = __builtin_convertvector(table_pos, V); \
+            table_floor += (V)(table_pos < __builtin_convertvector(table_floor, F)); \
+            U idx = (U)(table_floor & (mask)); \
+            F frac = table_pos - __builtin_convertvector(table_floor, F);
+
+// L2S on lanes of table entries.
+#define LUT_SIMD_L2S(F, l) (__builtin_convertvector(l, F) / 32768.0f)
+
+#define LUT_SIMD_INTERP_LINEAR(V, U, F, N) \
+            V lo, hi; \
+            LUT_SIMD_PAIRS_##N(V, idx, lo, hi) \
+            F b = LUT_SIMD_L2S(F, lo); \
+            F c = LUT_SIMD_L2S(F, hi); \
+            F sample = b + (c - b) * frac;
+
+#define LUT_SIMD_INTERP_CUBIC(V, U, F, N) \
+            V a_l, b_l, c_l, d_l; \
+            U prev_idx = (idx - 1) & lut_mask; \
+            U next_idx = (idx + 1) & lut_mask; \
+            LUT_SIMD_PAIRS_##N(V, prev_idx, a_l, b_l) \
+            LUT_SIMD_PAIRS_##N(V, next_idx, c_l, d_l) \
+            F a = LUT_SIMD_L2S(F, a_l); \
+            F b = LUT_SIMD_L2S(F, b_l); \
+            F c = LUT_SIMD_L2S(F, c_l); \
+            F d = LUT_SIMD_L2S(F, d_l); \
+            F cminusb = c - b; \
+            F fr_d_ma_m3cmb = (d - a - cminusb - cminusb * 2.0f) * frac; \
+            F next_bit = (fr_d_ma_m3cmb + d + (a - b) * 2.0f - b) * ((1.0f - frac) * 0.16666666666667f); \
+            F sample = b + (cminusb - next_bit) * frac;
+
+#define LUT_SIMD_INTERP_SINE(V, U, F, N) \
+            V lo, hi; \
+            LUT_SIMD_GUARDED_PAIRS_##N(V, idx, lo, hi) \
+            F b = LUT_SIMD_L2S(F, lo); \
+            F c = LUT_SIMD_L2S(F, hi); \
+            F sample = b + (c - b) * frac;
+
+#define LUT_SIMD_MOD_NONE(F) \
+            F total_phase = phase_lanes;
+#define LUT_SIMD_MOD_FM(F) \
+            F total_phase; \
+            memcpy(&total_phase, mod + i, sizeof(total_phase)); \
+            total_phase = phase + total_phase;
+
+// S_ABS by clearing the sign bit, and keep the larger magnitude.
+#define LUT_SIMD_TRACK_MAX(V, F, value) { \
+            F mag = (F)((V)(value) & INT32_MAX); \
+            V bigger = mag > max_lanes; \
+            max_lanes = (F)(((V)mag & bigger) | ((V)max_lanes & ~bigger)); \
+        }
+
+// Accumulate into buf and track the largest magnitude.
+#define LUT_SIMD_LOOP_END(V, F) \
+            F value; \
+            memcpy(&value, buf + i, sizeof(value)); \
+            value += sample * (incoming_amp + at * incremental_amp); \
+            memcpy(buf + i, &value, sizeof(value)); \
+            LUT_SIMD_TRACK_MAX(V, F, value)
+
+#define LUT_SIMD_MAX_VALUE(N) \
+    SAMPLE max_value = 0; \
+    for (int k = 0; k < N; ++k)  if (max_lanes[k] > max_value)  max_value = max_lanes[k]; \
+    *pmax_value = max_value;
+
+// Same arguments as render_lut_fm; mod is ignored by the kernels without FM.
+#define RENDER_LUT_SIMD_KERNEL(NAME, ATTR, V, U, F, N, MOD_PART, INTERP_PART) \
+static ATTR PHASOR NAME(SAMPLE *buf, PHASOR phase, PHASOR step, \
+                        SAMPLE incoming_amp, SAMPLE ending_amp, \
+                        const LUT *lut, SAMPLE *mod, SAMPLE *pmax_value) { \
+    LUT_SIMD_TABLE \
+    float lut_size = (float)lut->table_size; \
+    SAMPLE incremental_amp = SHIFTR(ending_amp - incoming_amp, BLOCK_SIZE_BITS); \
+    F lane; \
+    for (int k = 0; k < N; ++k)  lane[k] = k; \
+    const F phase_lanes = (F){0} + phase; \
+    (void)phase_lanes; \
+    F max_lanes = {0}; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; i += N) { \
+            F at = lane + (float)i; \
+            MOD_PART(F) \
+            F table_pos = (total_phase + at * step) * lut_size; \
+            LUT_SIMD_POSITION(V, U, F, table_pos, lut_mask) \
+            INTERP_PART(V, U, F, N) \
+            LUT_SIMD_LOOP_END(V, F) \
+    } \
+    LUT_SIMD_MAX_VALUE(N) \
+    return P_WRAPPED_SUM(phase, AMY_BLOCK_SIZE * step); \
+}
+
+// render_lut_256: the sine table has a guard point, so no index wrapping.
+#define RENDER_LUT_256_SIMD_KERNEL(NAME, ATTR, V, U, F, N) \
+static ATTR PHASOR NAME(SAMPLE *buf, PHASOR phase, PHASOR step, \
+                        SAMPLE incoming_amp, SAMPLE ending_amp, \
+                        const LUT *lut, SAMPLE *mod, SAMPLE *pmax_value) { \
+    const LUTSAMPLE *table = lut->table; \
+    SAMPLE incremental_amp = SHIFTR(ending_amp - incoming_amp, BLOCK_SIZE_BITS); \
+    F lane; \
+    for (int k = 0; k < N; ++k)  lane[k] = k; \
+    F max_lanes = {0}; \
+    for (int i = 0; i < AMY_BLOCK_SIZE; i += N) { \
+            F at = lane + (float)i; \
+            F table_pos = (phase + at * step) * 256.0f; \
+            LUT_SIMD_POSITION(V, U, F, table_pos, 255) \
+            LUT_SIMD_INTERP_SINE(V, U, F, N) \
+            LUT_SIMD_LOOP_END(V, F) \
+    } \
+    LUT_SIMD_MAX_VALUE(N) \
+    return P_WRAPPED_SUM(phase, AMY_BLOCK_SIZE * step); \
+}
+
+// Cross-voice kernels, as in the fixed-point build: lane k is osc k, and
+// tile[i * N + k] is what the single-osc kernel would write into a zeroed
+// buffer.
+#define LUT_LANES_SETUP(F, N) \
+    F lane_phase, step, amp, amp_step; \
+    for (int k = 0; k < N; ++k) { \
+        lane_phase[k] = lanes[k].phase; \
+        step[k] = lanes[k].step; \
+        amp[k] = lanes[k].incoming_amp; \
+        amp_step[k] = SHIFTR(lanes[k].ending_amp - lanes[k].incoming_amp, BLOCK_SIZE_BITS); \
+    } \
+    F max_lanes = {0};
+
+#define LUT_LANES_LOOP_END(V, F, N) \
+            F value = sample * (amp + (float)i * amp_step); \
+            memcpy(tile + i * N, &value, sizeof(value)); \
+            LUT_SIMD_TRACK_MAX(V, F, value)
+
+#define LUT_LANES_FINISH(N) \
+    for (int k = 0; k < N; ++k) { \
+        max_values[k] = max_lanes[k]; \
+        lanes[k].phase = P_WRAPPED_SUM(lanes[k].phase, AMY_BLOCK_SIZE * lanes[k].step); \
+    }
+
+#define RENDER_LUT_LANES_KERNEL(NAME, ATTR, V, U, F, N, INTERP_PART) \
+static ATTR void NAME(const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values) { \
+    LUT_SIMD_TABLE \
+    float lut_size = (float)lut->table_size; \
+    LUT_LANES_SETUP(F, N) \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            F table_pos = (lane_phase + (float)i * step) * lut_size; \
+            LUT_SIMD_POSITION(V, U, F, table_pos, lut_mask) \
+            INTERP_PART(V, U, F, N) \
+            LUT_LANES_LOOP_END(V, F, N) \
+    } \
+    LUT_LANES_FINISH(N) \
+}
+
+#define RENDER_LUT_256_LANES_KERNEL(NAME, ATTR, V, U, F, N) \
+static ATTR void NAME(const LUT *lut, lut_lane_t *lanes, SAMPLE *tile, SAMPLE *max_values) { \
+    const LUTSAMPLE *table = lut->table; \
+    LUT_LANES_SETUP(F, N) \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+            F table_pos = (lane_phase + (float)i * step) * 256.0f; \
+            LUT_SIMD_POSITION(V, U, F, table_pos, 255) \
+            LUT_SIMD_INTERP_SINE(V, U, F, N) \
+            LUT_LANES_LOOP_END(V, F, N) \
+    } \
+    LUT_LANES_FINISH(N) \
+}
+
+// mix_with_pan for a whole tile.  The lanes are added into the stereo block
+// one after another, in osc order, as mixing them one at a time would.
+#define MIX_LUT_LANES_KERNEL(NAME, ATTR, F, N) \
+static ATTR void NAME(SAMPLE *stereo_dest, const SAMPLE *tile, const lut_lane_t *lanes) { \
+    F gain_l, gain_r, d_gain_l, d_gain_r; \
+    for (int k = 0; k < N; ++k) { \
+        gain_l[k] = lanes[k].gain_l; \
+        gain_r[k] = lanes[k].gain_r; \
+        d_gain_l[k] = lanes[k].d_gain_l; \
+        d_gain_r[k] = lanes[k].d_gain_r; \
+    } \
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) { \
+        F value; \
+        memcpy(&value, tile + i * N, sizeof(value)); \
+        F left = (gain_l + (float)i * d_gain_l) * value; \
+        F right = (gain_r + (float)i * d_gain_r) * value; \
+        SAMPLE sum_l = stereo_dest[i], sum_r = stereo_dest[AMY_BLOCK_SIZE + i]; \
+        for (int k = 0; k < N; ++k) { \
+            sum_l += left[k]; \
+            sum_r += right[k]; \
+        } \
+        stereo_dest[i] = sum_l; \
+        stereo_dest[AMY_BLOCK_SIZE + i] = sum_r; \
+    } \
+}
+
+RENDER_LUT_SIMD_KERNEL(render_lut_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_fm_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4, LUT_SIMD_MOD_FM, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_cub_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_SIMD_KERNEL(render_lut_256_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4)
+RENDER_LUT_LANES_KERNEL(render_lut_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_LANES_KERNEL(render_lut_cub_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_LANES_KERNEL(render_lut_256_lanes_simd128, LUT_SIMD128_ATTR, lut_v4i, lut_v4u, lut_v4f, 4)
+MIX_LUT_LANES_KERNEL(mix_lut_lanes_simd128, LUT_SIMD128_ATTR, lut_v4f, 4)
+#ifdef __x86_64__
+RENDER_LUT_SIMD_KERNEL(render_lut_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_fm_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8, LUT_SIMD_MOD_FM, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_SIMD_KERNEL(render_lut_cub_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8, LUT_SIMD_MOD_NONE, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_SIMD_KERNEL(render_lut_256_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8)
+RENDER_LUT_LANES_KERNEL(render_lut_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8, LUT_SIMD_INTERP_LINEAR)
+RENDER_LUT_LANES_KERNEL(render_lut_cub_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8, LUT_SIMD_INTERP_CUBIC)
+RENDER_LUT_256_LANES_KERNEL(render_lut_256_lanes_simd256, LUT_SIMD256_ATTR, lut_v8i, lut_v8u, lut_v8f, 8)
+MIX_LUT_LANES_KERNEL(mix_lut_lanes_simd256, LUT_SIMD256_ATTR, lut_v8f, 8)
+#endif
+
+#endif  // AMY_USE_FIXEDPOINT
+
+#ifdef __x86_64__
+// Calls KERNEL##_simd256 or KERNEL##_simd128 per render_lut_simd.
+#define RENDER_LUT_SIMD_CALL(KERNEL, ...) \
+    (render_lut_simd == RENDER_LUT_SIMD256 ? KERNEL##_simd256(__VA_ARGS__) : KERNEL##_simd128(__VA_ARGS__))
+#else
+#define RENDER_LUT_SIMD_CALL(KERNEL, ...)  KERNEL##_simd128(__VA_ARGS__)
+#endif
+
+#endif  // AMY_RENDER_LUT_SIMD
+
+#endif  // __RENDER_LUT_SIMD_H
@@ -7,11 +7,19 @@
 
 uint32_t sequencer_ticks() { return amy_global.sequencer_tick_count; }
 
-// Sequenced ticks events are stored as the raw wire-message string (with its
+// Sequenced ticks events are stored as the wire-message string (with its
 // leading 'H' command stripped) plus the scheduling metadata needed to play
-// it back.  The string is only parsed when the entry comes due.
+// it back.  A message that does nothing but make events -- nearly all of them
+// -- is also parsed once, when it's stored, into binary events (see
+// amy_event_to_binary), and firing it just decodes those and adds them: no
+// parse and no malloc on the render thread, however often a pattern repeats.
+// Anything else (a patch store, a transfer command, ...) acts as it's parsed,
+// so it's parsed each time it fires, as it always was.
+#define SEQUENCE_EVENTS_MAX_LEN 256  // a longer message is parsed when fired
 typedef struct sequence_info_t {
     char *wire;    // Stored wire message; NULL means the tag is unused.
+    uint8_t *events;  // wire as binary events, or NULL to parse wire when fired
+    uint16_t events_len;
     //uint32_t tag;  // tag is implicit, it's its index in the table
     uint32_t tick; // 0 means not used
     uint32_t period; // 0 means not used
@@ -60,6 +68,8 @@ void sequencer_init(int max_sequencer_tags) {
                                                       amy_global.config.ram_caps_synth);
     for (int32_t i = 0; i < total_slots; ++i) {
         sequences[i].wire = NULL;
+        sequences[i].events = NULL;
+        sequences[i].events_len = 0;
         sequences[i].tick = 0;
         sequences[i].period = 0;
         sequences[i].next_active = -1;
@@ -75,7 +85,10 @@ void sequencer_reset() {
     for (int32_t i = 0; i < max_sequences + AMY_ANON_SEQUENCE_SLOTS; ++i) {
         if (sequences[i].wire) {
             free(sequences[i].wire);
+            free(sequences[i].events);
             sequences[i].wire = NULL;
+            sequences[i].events = NULL;
+            sequences[i].events_len = 0;
             sequences[i].tick = 0;
             sequences[i].period = 0;
         }
@@ -168,6 +181,44 @@ void sequencer_recompute() {
     amy_global.next_amy_tick_us = (amy_sysclock64() * 1000ULL) + (uint64_t)amy_global.us_per_tick;
 }
 
+// Parse wire into binary events, in a buffer for the sequence to keep, or
+// return NULL if it has to be parsed when it fires instead.
+static uint8_t *compile_wire(char *wire, uint16_t *len) {
+    if (!wire_message_parse_is_pure(wire))  return NULL;
+    uint8_t buf[SEQUENCE_EVENTS_MAX_LEN];
+    size_t used = 0;
+    amy_event e;
+    size_t pos = 0;
+    do {
+        amy_clear_event_sparse(&e);
+        pos = yield_event_from_message(wire, &e, pos);
+        if (pos > 0) {
+            size_t n = amy_event_to_binary(&e, buf + used, sizeof(buf) - used);
+            if (n == 0)  return NULL;  // too long: keep it as text
+            used += n;
+        }
+    } while (pos > 0);
+    if (used == 0)  return NULL;
+    uint8_t *events = (uint8_t *)malloc_caps(used, amy_global.config.ram_caps_events);
+    if (events == NULL)  return NULL;  // parse it when it fires, then
+    memcpy(events, buf, used);
+    *len = (uint16_t)used;
+    return events;
+}
+
+// Add the binary events compile_wire made, as amy_play_message would the
+// message they came from.
+static void play_events(const uint8_t *events, uint16_t len) {
+    uint16_t pos = 0;
+    while (pos < len) {
+        amy_event e;
+        int used = amy_binary_to_event(events + pos, len - pos, &e);
+        if (used <= 0)  break;
+        amy_add_event(&e);
+        pos += used;
+    }
+}
+
 // Store a wire message in the sequencer.  Takes ownership of wire (malloc'd).
 //
 // has_tag false means tag wasn't supplied by the caller (a 1- or 2-value
@@ -200,10 +251,17 @@ uint8_t sequencer_add_wire(uint32_t tick, uint32_t period, uint32_t tag, bool ha
         tag = (uint32_t)(max_sequences + anon_cursor);
         anon_cursor = (anon_cursor + 1) % AMY_ANON_SEQUENCE_SLOTS;
     }
+    // Compiled before taking the lock: parsing can't happen under it (see
+    // below), and this is the only parse the message gets if it's pure.
+    uint16_t events_len = 0;
+    uint8_t *events = (tick == 0 && period == 0) ? NULL : compile_wire(wire, &events_len);
     amy_grab_lock();
     // Release any existing message for this tag, even if we're just going to rewrite it.
     if (sequences[tag].wire) free(sequences[tag].wire);
+    free(sequences[tag].events);
     sequences[tag].wire = NULL;
+    sequences[tag].events = NULL;
+    sequences[tag].events_len = 0;
     sequences[tag].tick = 0;
     sequences[tag].period = 0;
     active_unlink(tag);   // out of the list while it has nothing in it
@@ -228,13 +286,17 @@ uint8_t sequencer_add_wire(uint32_t tick, uint32_t period, uint32_t tag, bool ha
         // amy_queue_lock is a plain non-recursive mutex and amy_play_message()
         // re-enters the parser, which can land back in this function.
         amy_release_lock();
-        amy_play_message(wire);
+        if (events) play_events(events, events_len);
+        else amy_play_message(wire);
+        free(events);
         free(wire);
         return 1;
     }
     sequences[tag].tick = tick;
     sequences[tag].period = period;
     sequences[tag].wire = wire;
+    sequences[tag].events = events;
+    sequences[tag].events_len = events_len;
     active_link(tag);   // ...and back in, now that it has a message again
     amy_release_lock();
     return 1;
@@ -271,19 +333,29 @@ static void sequencer_process_tick(void) {
                 if (sequences[tag].tick <= amy_global.sequencer_tick_count) { hit = true; delete = true; }
             }
             if(hit) {
-                // Take the message out (one-shot) or a copy of it (repeating)
-                // under the lock, so an ingest thread rewriting the tag can't
-                // free the string while we parse it.
+                // Take a copy of the events, or the message out (one-shot) or
+                // a copy of it (repeating) under the lock, so an ingest
+                // thread rewriting the tag can't free them while we play them.
                 char *wire = NULL;
+                uint8_t *owned_events = NULL;
+                uint8_t events[SEQUENCE_EVENTS_MAX_LEN];
+                uint16_t events_len = 0;
                 amy_grab_lock();
                 if (sequences[tag].wire != NULL) {
+                    if (sequences[tag].events != NULL) {
+                        events_len = sequences[tag].events_len;
+                        memcpy(events, sequences[tag].events, events_len);
+                    }
                     if (delete) {
                         wire = sequences[tag].wire;
+                        owned_events = sequences[tag].events;
                         sequences[tag].wire = NULL;
+                        sequences[tag].events = NULL;
+                        sequences[tag].events_len = 0;
                         sequences[tag].tick = 0;
                         sequences[tag].period = 0;
                         active_unlink(tag);
-                    } else {
+                    } else if (events_len == 0) {
                         size_t len = strlen(sequences[tag].wire);
                         wire = (char *)malloc_caps(len + 1, amy_global.config.ram_caps_events);
                         if (wire != NULL) memcpy(wire, sequences[tag].wire, len + 1);
@@ -291,8 +363,12 @@ static void sequencer_process_tick(void) {
                     }
                 }
                 amy_release_lock();
-                if (wire != NULL) {
-                    // Parse and play now; the deltas play back within this block.
+                // Play now; the deltas play back within this block.
+                if (events_len > 0) {
+                    play_events(events, events_len);
+                    free(owned_events);
+                    free(wire);
+                } else if (wire != NULL) {
                     amy_play_message(wire);
                     free(wire);
                 }
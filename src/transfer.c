@@ -26,9 +26,16 @@
 
 #if defined(__unix__) || defined(__APPLE__) || defined(_POSIX_VERSION)
 
-// Map from FILE * to a uint32_t handle to pass to AMY
+// Map from FILE * to a uint32_t handle to pass to AMY.  pcm.c's reader
+// thread opens files while the thread sending events may be, so a slot is
+// claimed with a compare-and-swap where there are atomics.
 
+#ifndef __STDC_NO_ATOMICS__
+#include <stdatomic.h>
+static _Atomic(FILE *) g_files[MAX_OPEN_FILES]; // index 1..MAX_OPEN_FILES-1 used
+#else
 static FILE *g_files[MAX_OPEN_FILES]; // index 1..MAX_OPEN_FILES-1 used
+#endif
 #ifdef __EMSCRIPTEN__
 static uint32_t g_em_handle[MAX_OPEN_FILES];
 static uint32_t g_em_pos[MAX_OPEN_FILES];
@@ -37,10 +44,15 @@ static uint32_t g_em_pos[MAX_OPEN_FILES];
 #ifndef __EMSCRIPTEN__
 static uint32_t alloc_handle(FILE *f) {
     for (uint32_t i = 1; i < MAX_OPEN_FILES; i++) {
+#ifndef __STDC_NO_ATOMICS__
+        FILE *none = NULL;
+        if (atomic_compare_exchange_strong(&g_files[i], &none, f))  return i;
+#else
         if (g_files[i] == NULL) {
             g_files[i] = f;
             return i;
         }
+#endif
     }
     return HANDLE_INVALID; // table full
 }
@@ -753,12 +765,15 @@ int wave_parse_header(uint32_t handle, wave_info_t *info, uint32_t *data_bytes)
     }
     uint8_t fmt_found = 0;
     wave_info_t tmp_info = {0};
+    // Bytes into the file, so callers can seek straight back to the frames.
+    uint32_t offset = sizeof(riff_header);
     while (1) {
         uint8_t chunk_header[8];
         if (!read_exact(handle, chunk_header, sizeof(chunk_header))) {
             return 0;
         }
         uint32_t chunk_size = read_u32_le(chunk_header + 4);
+        offset += sizeof(chunk_header);
         if (memcmp(chunk_header, "fmt ", 4) == 0) {
             if (chunk_size < 16) {
                 return 0;
@@ -782,12 +797,14 @@ int wave_parse_header(uint32_t handle, wave_info_t *info, uint32_t *data_bytes)
                 }
             }
             fmt_found = 1;
+            offset += chunk_size + (chunk_size & 1);
             continue;
         }
         if (memcmp(chunk_header, "data", 4) == 0) {
             if (!fmt_found) {
                 return 0;
             }
+            tmp_info.data_offset = offset;
             *info = tmp_info;
             *data_bytes = chunk_size;
             return 1;
@@ -800,6 +817,7 @@ int wave_parse_header(uint32_t handle, wave_info_t *info, uint32_t *data_bytes)
                 return 0;
             }
         }
+        offset += chunk_size + (chunk_size & 1);
     }
     return 0;
 }
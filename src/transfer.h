@@ -26,6 +26,7 @@ void transfer_init();
 typedef struct {
     uint16_t channels;
     uint32_t sample_rate;
+    uint32_t data_offset;  // where the data chunk's frames start in the file
 } wave_info_t;
 
 int wave_parse_header(uint32_t handle, wave_info_t *info, uint32_t *data_bytes);
@@ -0,0 +1,124 @@
+// Benchmarks what events added from other threads cost the render thread.
+// Two threads add deltas in bursts of 64 (about a patch load's worth), a few
+// hundred microseconds apart, while this one plays the queue a block at a
+// time, every 500 us, for 2000 blocks.  It's run twice:
+//
+//   locked:  each delta is scheduled under the lock, as add_delta_to_queue
+//            used to, so the render thread can queue behind the producers;
+//   ring:    add_delta_to_queue as it is, pushing onto the delta ring without
+//            the lock, drained by the render thread.
+//
+// For each it prints the render thread's wait for the lock and its whole
+// take of the due deltas (the wait, draining the ring, and taking them off
+// the wheel) per block -- median, 99th percentile and worst -- and the
+// producers' nanoseconds per delta added.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "amy.h"
+
+#define PRODUCERS 2
+#define BURST 64
+#define BLOCKS 2000
+
+static volatile int use_ring;
+static volatile int stop;
+static int64_t add_us[PRODUCERS];
+static uint32_t added[PRODUCERS];
+
+static void *produce(void *arg) {
+    uintptr_t p = (uintptr_t)arg;
+    struct delta d = { 0 };
+    d.osc = (uint16_t)p;
+    d.param = NO_PARAM;
+    add_us[p] = 0;
+    added[p] = 0;
+    while (!stop) {
+        int64_t t0 = amy_get_us();
+        for (int i = 0; i < BURST; ++i) {
+            d.data.i = added[p]++;
+            if (use_ring) {
+                add_delta_to_queue(&d, &amy_global.delta_queue);
+            } else {
+                amy_grab_lock();
+                struct delta *nd = delta_get(&d);
+                if (nd)  delta_sched_insert(nd);
+                amy_release_lock();
+            }
+        }
+        add_us[p] += amy_get_us() - t0;
+        usleep(200 + 100 * p);
+    }
+    return NULL;
+}
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static int64_t wait_us[BLOCKS], take_us[BLOCKS];
+
+static void print_spread(const char *what, int64_t *us) {
+    qsort(us, BLOCKS, sizeof(us[0]), cmp_us);
+    printf(" %s median %3d us, 99%% %4d us, worst %5d us;", what, (int)us[BLOCKS / 2],
+           (int)us[BLOCKS * 99 / 100], (int)us[BLOCKS - 1]);
+}
+
+static void run(int ring, const char *name) {
+    use_ring = ring;
+    stop = 0;
+    pthread_t threads[PRODUCERS];
+    for (uintptr_t p = 0; p < PRODUCERS; ++p)
+        pthread_create(&threads[p], NULL, produce, (void *)p);
+    for (int b = 0; b < BLOCKS; ++b) {
+        int64_t t0 = amy_get_us();
+        amy_grab_lock();
+        wait_us[b] = amy_get_us() - t0;
+        delta_ring_drain();
+        struct delta *d = delta_sched_take_due(amy_sysclock());
+        while (d)  d = delta_release(d);
+        amy_release_lock();
+        take_us[b] = amy_get_us() - t0;
+        usleep(500);
+    }
+    stop = 1;
+    for (int p = 0; p < PRODUCERS; ++p)  pthread_join(threads[p], NULL);
+    // Whatever came in after the last block.
+    amy_grab_lock();
+    amy_deltas_reset();
+    amy_release_lock();
+    int64_t total_us = 0;
+    uint32_t total = 0;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        total_us += add_us[p];
+        total += added[p];
+    }
+    printf("%-6s render thread lock wait", name);
+    print_spread("", wait_us);
+    print_spread(" take", take_us);
+    printf(" producers %5.1f ns per delta (%u deltas)\n", total_us * 1000.0 / total, total);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    amy_grab_lock();
+    amy_deltas_reset();
+    amy_release_lock();
+    // Everything is due as soon as it's in.
+    amy_global.total_blocks = 0;
+    run(0, "locked");
+    run(1, "ring");
+    amy_stop();
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Benchmarks scheduling deltas ahead of time: 100k deltas spread over the
+// next minute -- a long sequence queued in advance, with runs of deltas at
+// the same time as a patch load makes -- pushed into the delta scheduler
+// (the timing wheel behind amy_global.delta_queue), then played out a block
+// at a time.  For comparison, the sorted-list insert the queue used to do
+// (delta_list_insert, still what patches' delta lists use) is timed on the
+// first 20k of them; it's quadratic, so all 100k would take a long while.
+// It prints the nanoseconds per delta scheduled, and the time to take the
+// due deltas off the wheel, per block, averaged and at worst.
+//
+// It fails if any one block moved more than WORST_REFILED deltas down the
+// wheel (amy_global.delta_refile_high_water).  The cascade ahead moves 32 per
+// level per block, and finishing a window as it's entered only has what that
+// couldn't keep up with -- none of this sequence's windows are that dense.
+// Moving whole windows as they were entered re-filed a 32 s window, tens of
+// thousands of deltas, in one block.  Counting rather than timing keeps the
+// check steady on a loaded machine.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define EVENTS 100000
+#define LIST_EVENTS 20000
+#define SPAN_MS 60000
+#define WORST_REFILED 256
+
+static uint32_t times[EVENTS];
+
+static void make_times(uint32_t now) {
+    uint32_t rand_state = 12345;
+    for (int i = 0; i < EVENTS; ) {
+        rand_state = rand_state * 1664525u + 1013904223u;
+        uint32_t t = now + (rand_state >> 8) % SPAN_MS;
+        // One in ten is a run of 32 at one time.
+        int run = ((rand_state >> 4) % 10 == 0) ? 32 : 1;
+        for (int j = 0; j < run && i < EVENTS; ++j)  times[i++] = t;
+    }
+}
+
+static double ns_per(int64_t us, int n) {
+    return us * 1000.0 / n;
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    delta_sched_release_all();
+    uint32_t now = amy_sysclock();
+    make_times(now);
+    struct delta d = { 0 };
+    // Take the pool to size first, so neither timing includes growing it.
+    struct delta *all = NULL;
+    for (int i = 0; i < EVENTS; ++i) {
+        struct delta *nd = delta_get(&d);
+        if (nd == NULL)  break;
+        nd->next = all;
+        all = nd;
+    }
+    delta_release_list(all);
+
+    struct delta *list = NULL;
+    int64_t t0 = amy_get_us();
+    for (int i = 0; i < LIST_EVENTS; ++i) {
+        d.time = times[i];
+        delta_list_insert(&list, delta_get(&d));
+    }
+    int64_t list_us = amy_get_us() - t0;
+    delta_release_list(list);
+
+    t0 = amy_get_us();
+    for (int i = 0; i < LIST_EVENTS; ++i) {
+        d.time = times[i];
+        delta_sched_insert(delta_get(&d));
+    }
+    int64_t wheel_small_us = amy_get_us() - t0;
+    delta_sched_release_all();
+
+    t0 = amy_get_us();
+    for (int i = 0; i < EVENTS; ++i) {
+        d.time = times[i];
+        delta_sched_insert(delta_get(&d));
+    }
+    int64_t wheel_us = amy_get_us() - t0;
+
+    // Play them out, a block at a time.
+    int64_t take_us = 0, worst_us = 0;
+    int blocks = 0, taken = 0, worst_taken = 0;
+    uint32_t worst_refiled = 0;
+    while (taken < EVENTS) {
+        amy_global.total_blocks++;
+        amy_global.delta_refile_high_water = 0;
+        t0 = amy_get_us();
+        struct delta *due = delta_sched_take_due(amy_sysclock());
+        int64_t us = amy_get_us() - t0;
+        take_us += us;
+        if (us > worst_us)  worst_us = us;
+        blocks++;
+        if (amy_global.delta_refile_high_water > worst_refiled)  worst_refiled = amy_global.delta_refile_high_water;
+        int n = 0;
+        while (due) {
+            due = delta_release(due);
+            n++;
+        }
+        taken += n;
+        if (n > worst_taken) worst_taken = n;
+    }
+    printf("scheduling deltas over %d s, ns per delta: sorted list (%dk) %7.1f, wheel (%dk) %5.1f, wheel (%dk) %5.1f\n",
+           SPAN_MS / 1000, LIST_EVENTS / 1000, ns_per(list_us, LIST_EVENTS), LIST_EVENTS / 1000,
+           ns_per(wheel_small_us, LIST_EVENTS), EVENTS / 1000, ns_per(wheel_us, EVENTS));
+    printf("taking %dk due deltas over %d blocks: %.2f us per block, worst %d us\n",
+           EVENTS / 1000, blocks, (double)take_us / blocks, (int)worst_us);
+    printf("most due in one block %d, most re-filed in one block %" PRIu32 " (bound %d)\n",
+           worst_taken, worst_refiled, WORST_REFILED);
+    amy_stop();
+    if (worst_refiled > WORST_REFILED) {
+        printf("FAIL: a block re-filed more than %d deltas\n", WORST_REFILED);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Benchmarks compute_breakpoint_scale the way hold_and_modify calls it --
+// both envelopes, at the start and end of the block -- for 512 oscs with
+// 8-breakpoint envelopes, as a big additive patch's partials have.
+//
+// It's timed twice over the same notes: once with every osc's envelope
+// cursor marked stale before each call, so it rescans the breakpoints and
+// redoes the curve constants every time (as before the cursor), and once
+// letting the cursor carry over.  The oscs are driven directly, without
+// rendering, so the envelope calls are all that's timed.  It prints the
+// median block for each.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define ENV_OSCS 512
+#define ENV_BREAKPOINTS 8
+#define BENCH_BLOCKS 600
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static int64_t one_block(bool rescan) {
+    int64_t t0 = amy_get_us();
+    for (uint16_t osc = 0; osc < ENV_OSCS; ++osc)
+        for (uint16_t offset = 0; offset <= AMY_BLOCK_SIZE; offset += AMY_BLOCK_SIZE)
+            for (uint8_t bp_set = 0; bp_set < MAX_BREAKPOINT_SETS; ++bp_set) {
+                if (rescan)  osc_envelope_changed(synth[osc], bp_set);
+                compute_breakpoint_scale(osc, bp_set, offset);
+            }
+    return amy_get_us() - t0;
+}
+
+static void start_notes(void) {
+    for (uint16_t osc = 0; osc < ENV_OSCS; ++osc) {
+        synth[osc]->note_on_clock = amy_global.total_blocks * AMY_BLOCK_SIZE;
+        AMY_UNSET(synth[osc]->note_off_clock);
+    }
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = ENV_OSCS + 8;
+    amy_start(c);
+    char m[32];
+    for (uint16_t osc = 0; osc < ENV_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw0", osc);
+        amy_add_message(m);
+    }
+    amy_simple_fill_buffer();
+    // Segments of 10 to 80 blocks, so over the run the oscs are spread
+    // across attack, decays and sustain; half of them true exponential.
+    for (uint16_t osc = 0; osc < ENV_OSCS; ++osc)
+        for (uint8_t bp_set = 0; bp_set < MAX_BREAKPOINT_SETS; ++bp_set) {
+            synth[osc]->eg_type[bp_set] = (osc & 1) ? ENVELOPE_TRUE_EXPONENTIAL : ENVELOPE_NORMAL;
+            for (int i = 0; i < ENV_BREAKPOINTS; ++i) {
+                synth[osc]->breakpoint_times[bp_set][i] = (10 + (osc * 7 + i * 13) % 70) * AMY_BLOCK_SIZE;
+                synth[osc]->breakpoint_values[bp_set][i] = (i == ENV_BREAKPOINTS - 1) ? 0 : 1.0f / (1 + i);
+            }
+            osc_envelope_changed(synth[osc], bp_set);
+        }
+    static int64_t us[2][BENCH_BLOCKS];
+    for (int rescan = 1; rescan >= 0; --rescan) {
+        amy_global.total_blocks = 0;
+        start_notes();
+        for (int b = 0; b < BENCH_BLOCKS; ++b) {
+            us[rescan][b] = one_block(rescan);
+            amy_global.total_blocks++;
+        }
+        qsort(us[rescan], BENCH_BLOCKS, sizeof(us[0][0]), cmp_us);
+    }
+    printf("%d oscs x 2 envelopes of %d breakpoints: median block rescanning every call %6.1f us, with cursor %6.1f us\n",
+           ENV_OSCS, ENV_BREAKPOINTS, (double)us[1][BENCH_BLOCKS / 2], (double)us[0][BENCH_BLOCKS / 2]);
+    amy_stop();
+    return 0;
+}
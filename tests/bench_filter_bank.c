@@ -0,0 +1,93 @@
+// Benchmarks the cross-voice filter bank: 64 oscs' filters, one block each,
+// run one osc at a time through filter_process and then a lane per osc
+// through filter_lanes (filter_simd.h).
+//
+// The oscs are set up as a 64-voice patch's filters would be -- every one
+// with its own cutoff, resonance and state -- and fed noise.  Both ways
+// design each osc's coefficients the same way, so the difference is the
+// serial biquads against the vector pass.  The two alternate block by block
+// so both see the same machine load, and it prints the median block for
+// each, for the LPF24 (the Juno voices' filter) and a plain LPF.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define FILTER_OSCS 64
+#define BENCH_BLOCKS 1000
+
+static SAMPLE blocks[FILTER_OSCS][AMY_BLOCK_SIZE];
+
+static void fill_noise(void) {
+    static uint32_t rand_state = 12345;
+    for (int osc = 0; osc < FILTER_OSCS; ++osc)
+        for (int i = 0; i < AMY_BLOCK_SIZE; ++i) {
+            rand_state = rand_state * 1664525u + 1013904223u;
+            blocks[osc][i] = F2S(0.1f * ((int32_t)rand_state / 2147483648.0f));
+        }
+}
+
+static void filter_serial(void) {
+    for (int osc = 0; osc < FILTER_OSCS; ++osc)
+        filter_process(blocks[osc], osc, F2S(0.1f));
+}
+
+static void filter_banked(void) {
+    static filter_lane_t lanes[FILTER_MAX_LANES];
+    SAMPLE max_values[FILTER_MAX_LANES];
+    uint8_t width = filter_lane_width();
+    uint8_t kind = FILTER_LANE_NONE;
+    for (int osc = 0; osc < FILTER_OSCS; osc += width) {
+        for (int k = 0; k < width; ++k)
+            kind = osc_filter_lane(osc + k, blocks[osc + k], F2S(0.1f), &lanes[k]);
+        filter_lanes(kind, lanes, width, max_values);
+    }
+}
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static void bench_filter(const char *name, int filter_type) {
+    char m[64];
+    for (int osc = 0; osc < FILTER_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw0G%dF%dR%.2fl0.01", osc, filter_type, 300 + 40 * osc, 0.7f + (osc % 8) * 0.5f);
+        amy_add_message(m);
+    }
+    amy_simple_fill_buffer();
+    static int64_t us[2][BENCH_BLOCKS];
+    for (int b = 0; b < 2 * BENCH_BLOCKS; ++b) {
+        int banked = b & 1;
+        fill_noise();
+        int64_t t0 = amy_get_us();
+        if (banked) filter_banked();
+        else filter_serial();
+        us[banked][b / 2] = amy_get_us() - t0;
+    }
+    qsort(us[0], BENCH_BLOCKS, sizeof(us[0][0]), cmp_us);
+    qsort(us[1], BENCH_BLOCKS, sizeof(us[1][0]), cmp_us);
+    printf("%d %-5s filters: median block one at a time %6.1f us, %d-lane bank %6.1f us\n", FILTER_OSCS, name,
+           (double)us[0][BENCH_BLOCKS / 2], filter_lane_width(), (double)us[1][BENCH_BLOCKS / 2]);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = FILTER_OSCS + 8;
+    amy_start(c);
+    if (filter_lane_width() == 0) {
+        printf("no filter bank on this CPU\n");
+        return 0;
+    }
+    bench_filter("LPF24", FILTER_LPF24);
+    bench_filter("LPF", FILTER_LPF);
+    amy_stop();
+    return 0;
+}
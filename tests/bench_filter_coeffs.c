@@ -0,0 +1,79 @@
+// Benchmarks FILTER_PROCESS_STAGE0 -- designing each filtered osc's biquad
+// for the block -- for 64 LPF oscs, three ways:
+//
+//   redesigned: every block, as before the per-osc coefficient cache (the
+//               cache is cleared first, so it's the full exp2, sin/cos and
+//               divides each time);
+//   steady:     the cutoff and resonance hold still, so the cache's design
+//               is reused;
+//   swept:      the cutoff moves every block, as under an envelope or LFO,
+//               so there's a new design each block.
+//
+// `make bench` also builds it as tests/bench_filter_coeffs-table, against the
+// precomputed (cutoff, Q) table (-DAMY_FILTER_COEFF_TABLE), where the swept
+// designs are interpolated from the table.  Each number is the median over
+// many passes of nanoseconds per osc per block, timed through
+// osc_filter_lane, which is stage 0 plus a few loads.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define FILTER_OSCS 64
+#define PASS_BLOCKS 50
+#define BENCH_PASSES 400
+
+static SAMPLE blocks[FILTER_OSCS][AMY_BLOCK_SIZE];
+static filter_lane_t lane;
+
+static int cmp_ns(const void *a, const void *b) {
+    double d = *(const double *)a - *(const double *)b;
+    return (d > 0) - (d < 0);
+}
+
+enum { REDESIGNED, STEADY, SWEPT };
+
+static double median_ns(int mode) {
+    static double ns[BENCH_PASSES];
+    for (int p = 0; p < BENCH_PASSES; ++p) {
+        int64_t t0 = amy_get_us();
+        for (int b = 0; b < PASS_BLOCKS; ++b)
+            for (int osc = 0; osc < FILTER_OSCS; ++osc) {
+                if (mode == REDESIGNED)  synth[osc]->filter_coeffs_type = FILTER_NONE;
+                else if (mode == SWEPT)  msynth[osc]->filter_logfreq = 1.0f + 0.01f * ((p * PASS_BLOCKS + b) % 200);
+                osc_filter_lane(osc, blocks[osc], F2S(0.1f), &lane);
+            }
+        ns[p] = (amy_get_us() - t0) * 1000.0 / (PASS_BLOCKS * FILTER_OSCS);
+    }
+    qsort(ns, BENCH_PASSES, sizeof(ns[0]), cmp_ns);
+    return ns[BENCH_PASSES / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = FILTER_OSCS + 8;
+    amy_start(c);
+    char m[64];
+    for (int osc = 0; osc < FILTER_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw0G%dF%dR%.2fl0.01", osc, FILTER_LPF, 300 + 40 * osc, 0.7f + (osc % 8) * 0.5f);
+        amy_add_message(m);
+    }
+    amy_simple_fill_buffer();
+#ifdef AMY_FILTER_COEFF_TABLE
+    const char *designs = "table";
+#else
+    const char *designs = "exact";
+#endif
+    double redesigned = median_ns(REDESIGNED), steady = median_ns(STEADY), swept = median_ns(SWEPT);
+    printf("%d LPF oscs, biquad design (%s), ns per osc per block: redesigned %5.1f, steady %5.1f, swept %5.1f\n",
+           FILTER_OSCS, designs, redesigned, steady, swept);
+    amy_stop();
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Benchmarks hold_and_modify for 512 oscs set up like a pad's: amp from
+// velocity and EG0, pitch from note and bend, a filter following note and
+// EG1, constant duty and pan.  Two phases of the notes are timed:
+//
+//   moving:  a long attack, so both envelopes move every block;
+//   held:    the sustain, where no input moves at all.
+//
+// Each is timed twice over the same notes: once with every osc's control
+// cache marked stale before each call, so it combines every control every
+// block (as before the cache), and once letting the cache carry over.  The
+// oscs are driven directly, without rendering, so hold_and_modify is all
+// that's timed.  It prints the median block for each.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define PAD_OSCS 512
+#define ATTACK_BLOCKS 400
+#define BENCH_BLOCKS 300
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static int64_t one_block(bool recombine) {
+    int64_t t0 = amy_get_us();
+    for (uint16_t osc = 0; osc < PAD_OSCS; ++osc) {
+        if (recombine)  osc_coefs_changed(synth[osc]);
+        hold_and_modify(osc);
+    }
+    return amy_get_us() - t0;
+}
+
+// Median block over BENCH_BLOCKS, starting skip blocks into the notes.
+static int64_t median_us(bool recombine, int skip) {
+    static int64_t us[BENCH_BLOCKS];
+    amy_global.total_blocks = 0;
+    amy_global.total_samples = 0;
+    for (uint16_t osc = 0; osc < PAD_OSCS; ++osc) {
+        synth[osc]->note_on_clock = 0;
+        AMY_UNSET(synth[osc]->note_off_clock);
+    }
+    for (int b = 0; b < skip + BENCH_BLOCKS; ++b) {
+        int64_t t = one_block(recombine);
+        if (b >= skip)  us[b - skip] = t;
+        amy_global.total_blocks++;
+        amy_global.total_samples += AMY_BLOCK_SIZE;
+    }
+    qsort(us, BENCH_BLOCKS, sizeof(us[0]), cmp_us);
+    return us[BENCH_BLOCKS / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = PAD_OSCS + 8;
+    amy_start(c);
+    char m[128];
+    for (uint16_t osc = 0; osc < PAD_OSCS; ++osc) {
+        // Attack and decay of ATTACK_BLOCKS and more, sustain, release.
+        snprintf(m, sizeof(m), "v%dw0n%dG1F200,0.5,,,1R2A%d,1,%d,0.7,500,0B%d,1,%d,0.5,500,0",
+                 osc, 36 + osc % 48, ATTACK_BLOCKS * AMY_BLOCK_SIZE * 1000 / AMY_SAMPLE_RATE, 1000,
+                 ATTACK_BLOCKS * AMY_BLOCK_SIZE * 1000 / AMY_SAMPLE_RATE, 1000);
+        amy_add_message(m);
+    }
+    amy_simple_fill_buffer();
+    for (uint16_t osc = 0; osc < PAD_OSCS; ++osc) {
+        synth[osc]->velocity = 0.8f;
+        synth[osc]->midi_note = 36 + osc % 48;
+    }
+    int held = ATTACK_BLOCKS * 4;
+    int64_t moving_all = median_us(true, 0), moving_cached = median_us(false, 0);
+    int64_t held_all = median_us(true, held), held_cached = median_us(false, held);
+    printf("%d pad oscs, hold_and_modify median block: moving envelopes: recombining %5.1f us, cached %5.1f us; "
+           "held: recombining %5.1f us, cached %5.1f us\n",
+           PAD_OSCS, (double)moving_all, (double)moving_cached, (double)held_all, (double)held_cached);
+    amy_stop();
+    return 0;
+}
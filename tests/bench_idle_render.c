@@ -0,0 +1,55 @@
+// Benchmarks what a block costs when (almost) nothing is playing, as
+// max_oscs grows.
+//
+// An idle engine should cost next to nothing however many oscs it has room
+// for: render time has to follow what is sounding, not the size of the osc
+// table.  This renders a few hundred blocks with no notes, then with a
+// handful of notes, at several max_oscs, and prints microseconds per block.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include "amy.h"
+
+#define BENCH_BLOCKS 2000
+
+static double us_per_block(void) {
+    int64_t t0 = amy_get_us();
+    for (int i = 0; i < BENCH_BLOCKS; ++i) amy_simple_fill_buffer();
+    return (double)(amy_get_us() - t0) / BENCH_BLOCKS;
+}
+
+static void bench_max_oscs(uint16_t max_oscs) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    // No FX, so the block's fixed cost is just the osc scan and the mix.
+    c.features.reverb = 0;
+    c.features.chorus = 0;
+    c.features.echo = 0;
+    c.max_oscs = max_oscs;
+    amy_start(c);
+    amy_simple_fill_buffer();
+    double idle = us_per_block();
+    // Four sines at the top of the table, held for the whole run.
+    char m[64];
+    for (int i = 0; i < 4; ++i) {
+        snprintf(m, sizeof(m), "v%dw0f%dl0.2", max_oscs - 1 - i, 220 * (i + 1));
+        amy_add_message(m);
+    }
+    double playing = us_per_block();
+    printf("max_oscs %5d: idle %7.2f us/block, 4 oscs playing %7.2f us/block\n",
+           max_oscs, idle, playing);
+    amy_stop();
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    bench_max_oscs(250);
+    bench_max_oscs(1000);
+    bench_max_oscs(4000);
+    bench_max_oscs(16000);
+    return 0;
+}
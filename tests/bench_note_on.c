@@ -0,0 +1,132 @@
+// Benchmarks note-on throughput: how many note-ons a second AMY can take in,
+// which is the rate a sequencer host driving it is bounded by.  Each is
+// "osc 0, note 60, velocity 1" -- two fields of the very large amy_event --
+// sent as:
+//
+//   wire:    amy_add_message("v0n60l1Z"), parsed into a sparse event;
+//   binary:  amy_add_binary_event(), decoded into a sparse event;
+//   event:   amy_default_event() with the fields assigned directly and
+//            amy_add_event(), which has to look at every field;
+//   sparse:  amy_clear_event_sparse() and AMY_EVENT_SET(), so amy_add_event()
+//            looks only at the groups of fields that were set.
+//
+// plus a note-on to a 4-voice synth ("i1n60l1Z") by wire, which adds the
+// voice allocation, and the batch calls, each given all of a batch's
+// note-ons at once:
+//
+//   events:   amy_add_events() of sparse events;
+//   messages: amy_add_messages() of wire messages, one per line.
+//
+// It prints the median nanoseconds per note-on over
+// batches, and note-ons per second.  The deltas they make are dropped
+// between batches, untimed.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "amy.h"
+
+#define BATCH 200  // note-ons; their deltas fit in the delta ring
+#define BATCHES 500
+
+static int cmp_ns(const void *a, const void *b) {
+    double d = *(const double *)a - *(const double *)b;
+    return (d > 0) - (d < 0);
+}
+
+static void drop_deltas(void) {
+    amy_grab_lock();
+    amy_deltas_reset();
+    amy_release_lock();
+}
+
+static uint8_t binary[AMY_BINARY_EVENT_MAX_LEN];
+static size_t binary_len;
+
+static void note_on(int how) {
+    switch (how) {
+    case 0:
+        amy_add_message("v0n60l1Z");
+        break;
+    case 1:
+        amy_add_binary_event(binary, binary_len);
+        break;
+    case 2: {
+        amy_event e = amy_default_event();
+        e.osc = 0;
+        e.midi_note = 60;
+        e.velocity = 1;
+        amy_add_event(&e);
+        break;
+    }
+    case 3: {
+        amy_event e;
+        amy_clear_event_sparse(&e);
+        AMY_EVENT_SET(&e, osc, 0);
+        AMY_EVENT_SET(&e, midi_note, 60);
+        AMY_EVENT_SET(&e, velocity, 1);
+        amy_add_event(&e);
+        break;
+    }
+    case 4:
+        amy_add_message("i1n60l1Z");
+        break;
+    }
+}
+
+static amy_event events[BATCH];
+static char messages[BATCH * 10];
+
+// The whole batch, as one call.
+static void note_ons(int how) {
+    if (how == 5)  amy_add_events(events, BATCH);
+    else  amy_add_messages(messages);
+}
+
+static double ns_per_note_on(int how) {
+    static double ns[BATCHES];
+    for (int b = 0; b < BATCHES; ++b) {
+        int64_t t0 = amy_get_us();
+        if (how >= 5)  note_ons(how);
+        else  for (int i = 0; i < BATCH; ++i)  note_on(how);
+        ns[b] = (amy_get_us() - t0) * 1000.0 / BATCH;
+        drop_deltas();
+    }
+    qsort(ns, BATCHES, sizeof(ns[0]), cmp_ns);
+    return ns[BATCHES / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    amy_add_message("i1iv4K0Z");
+    amy_execute_deltas();
+    drop_deltas();
+    amy_event e = amy_default_event();
+    e.osc = 0;
+    e.midi_note = 60;
+    e.velocity = 1;
+    binary_len = amy_event_to_binary(&e, binary, sizeof(binary));
+    for (int i = 0; i < BATCH; ++i) {
+        amy_clear_event_sparse(&events[i]);
+        AMY_EVENT_SET(&events[i], osc, 0);
+        AMY_EVENT_SET(&events[i], midi_note, 60);
+        AMY_EVENT_SET(&events[i], velocity, 1);
+        strcat(messages, "v0n60l1Z\n");
+    }
+
+    const char *names[] = { "wire", "binary", "event", "sparse", "synth (wire)", "events", "messages" };
+    for (int how = 0; how < 7; ++how) {
+        double ns = ns_per_note_on(how);
+        printf("note-on %-13s %6.1f ns, %5.2f M/s\n", names[how], ns, 1e3 / ns);
+    }
+    amy_stop();
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Benchmarks patch load time against voice count: "i1iv<N>K<patch>" and the
+// deltas it makes, played, for a Juno patch (6 oscs a voice) and a DX7 one
+// (8), on 1 voice and on 32.  Only the first voice plays the patch's deltas;
+// the rest are copied from it (clone_voice_oscs), so each voice past the
+// first should cost a small fraction of the first.  It prints the median
+// microseconds per load, and per voice past the first.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define LOADS 200
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static double us_per_load(int patch, int voices) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = 320;
+    amy_start(c);
+    char message[32];
+    snprintf(message, sizeof(message), "i1iv%dK%dZ", voices, patch);
+    static int64_t us[LOADS];
+    for (int i = 0; i < LOADS; ++i) {
+        int64_t t0 = amy_get_us();
+        amy_add_message(message);
+        amy_execute_deltas();
+        us[i] = amy_get_us() - t0;
+    }
+    amy_stop();
+    qsort(us, LOADS, sizeof(us[0]), cmp_us);
+    return (double)us[LOADS / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    const char *names[] = { "Juno", "DX7" };
+    const int patches[] = { 0, 128 };
+    for (int p = 0; p < 2; ++p) {
+        double one = us_per_load(patches[p], 1);
+        double many = us_per_load(patches[p], 32);
+        printf("patch load %-4s: 1 voice %6.1f us, 32 voices %7.1f us (%.1f us per voice past the first)\n",
+               names[p], one, many, (many - one) / 31);
+    }
+    return 0;
+}
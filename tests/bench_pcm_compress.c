@@ -0,0 +1,105 @@
+// Benchmarks compressed PCM presets (pcm.c, "Compressed presets") against
+// the int16 ones they came from: the builtin drum kit copied into RAM twice,
+// once compressed with pcm_compress_preset, played by 128 oscs retriggered
+// every few blocks, and a stereo sample looping on 128 oscs.
+//
+// It prints the RAM each copy holds and microseconds per block for each,
+// with the scalar render_pcm kernels and the widest vector ones
+// (pcm_simd.h).  The four alternate in short runs so they all see the same
+// machine load.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+#define OSCS 128
+#define RUNS 100
+#define RUN_BLOCKS 20
+#define INT16_BASE 1024
+#define C8_BASE 1100
+#define FRAMES 20000
+
+enum { KIT, STEREO };
+
+// Copies of what's at each preset (or makes up a stereo one), at base + k.
+static uint16_t load_copies(int kind, uint16_t base, bool compress) {
+    uint16_t presets = (kind == KIT) ? pcm_wavetable_base : 1;
+    for (uint16_t k = 0; k < presets; ++k) {
+        uint32_t length = FRAMES;
+        const int16_t *rom = (kind == KIT) ? pcm_get_sample_ram_for_preset(k, &length) : NULL;
+        uint8_t channels = (kind == KIT) ? 1 : 2;
+        int16_t *ram = pcm_load(base + k, length, PCM_AMY_SAMPLE_RATE, channels, 60, 1000, 1000 + 441);
+        if (rom != NULL) {
+            memcpy(ram, rom, length * sizeof(int16_t));
+        } else {
+            for (uint32_t i = 0; i < length * channels; ++i)  ram[i] = (int16_t)((i % 211) * 150 - 15000);
+        }
+        if (compress)  pcm_compress_preset(base + k);
+    }
+    return presets;
+}
+
+static void play(uint16_t base, uint16_t presets, int kind, int first_osc, int every) {
+    for (int osc = first_osc; osc < OSCS; osc += every) {
+        amy_event e = amy_default_event();
+        e.osc = osc;
+        e.wave = PCM;
+        e.preset = base + osc % presets;
+        e.amp_coefs[COEF_CONST] = 0.05f;
+        e.midi_note = (kind == KIT) ? 50 + osc % 20 : 48 + osc % 24;
+        if (kind == STEREO)  e.mode = PCM_LOOP;
+        e.velocity = 1;
+        amy_add_event(&e);
+    }
+}
+
+static void bench(const char *name, int kind) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    // No FX, so the block's cost is the oscs and the mix.
+    c.features.reverb = 0;
+    c.features.chorus = 0;
+    c.features.echo = 0;
+    c.max_oscs = OSCS + 8;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    uint16_t presets = load_copies(kind, INT16_BASE, false);
+    uint32_t int16_bytes = amy_global.pcm_resident_bytes;
+    load_copies(kind, C8_BASE, true);
+    uint32_t c8_bytes = amy_global.pcm_resident_bytes - int16_bytes;
+    double total_us[2][2] = {{0, 0}, {0, 0}};
+    for (int run = 0; run < RUNS * 2; ++run) {
+        int compressed = (run >> 1) & 1;
+        int vector = run & 1;
+        uint16_t base = compressed ? C8_BASE : INT16_BASE;
+        render_lut_simd = vector ? best : RENDER_LUT_SCALAR;
+        play(base, presets, kind, 0, 1);
+        amy_simple_fill_buffer();
+        int64_t t0 = amy_get_us();
+        for (int i = 0; i < RUN_BLOCKS; ++i) {
+            // Hits land a few at a time, as a pattern's would.
+            if (kind == KIT)  play(base, presets, kind, (run * RUN_BLOCKS + i) % 8, 8);
+            amy_simple_fill_buffer();
+        }
+        total_us[compressed][vector] += (double)(amy_get_us() - t0);
+    }
+    double per_block = (double)(RUNS / 2 * RUN_BLOCKS);
+    int width = (best == RENDER_LUT_SIMD256) ? 256 : 128;
+    printf("%3d %-6s int16 %8" PRIu32 " bytes: scalar %7.1f us/block, %d-bit %7.1f us/block\n", OSCS, name,
+           int16_bytes, total_us[0][0] / per_block, width, total_us[0][1] / per_block);
+    printf("%3d %-6s c8    %8" PRIu32 " bytes: scalar %7.1f us/block, %d-bit %7.1f us/block\n", OSCS, name,
+           c8_bytes, total_us[1][0] / per_block, width, total_us[1][1] / per_block);
+    amy_stop();
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    bench("kit", KIT);
+    bench("stereo", STEREO);
+    return 0;
+}
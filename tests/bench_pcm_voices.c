@@ -0,0 +1,90 @@
+// Benchmarks render_pcm with many voices of samples at once, as a drum
+// machine plays them: 128 oscs of the builtin (Gamma 808) drum kit
+// retriggered every few blocks, 128 oscs looping a short mono sample, and
+// 128 oscs playing a stereo sample mixed to mono.
+//
+// Each osc runs straight through to its next loop or sample end with one of
+// the render_pcm kernels, scalar or vector (pcm_simd.h).  The two alternate
+// in short runs so both see the same machine load, and it prints
+// microseconds per block for each.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include "amy.h"
+
+#define OSCS 128
+#define RUNS 100
+#define RUN_BLOCKS 20
+#define PRESET 1024
+#define FRAMES 20000
+
+enum { KIT, LOOPED, STEREO };
+
+static void bench(const char *name, int kind) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    // No FX, so the block's cost is the oscs and the mix.
+    c.features.reverb = 0;
+    c.features.chorus = 0;
+    c.features.echo = 0;
+    c.max_oscs = OSCS + 8;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    if (kind != KIT) {
+        uint8_t channels = (kind == STEREO) ? 2 : 1;
+        int16_t *ram = pcm_load(PRESET, FRAMES, 44100, channels, 60, 1000, 1000 + 441);
+        for (int i = 0; i < FRAMES * channels; ++i)  ram[i] = (int16_t)((i % 211) * 150 - 15000);
+    }
+    for (int osc = 0; osc < OSCS; ++osc) {
+        amy_event e = amy_default_event();
+        e.osc = osc;
+        e.wave = PCM;
+        e.amp_coefs[COEF_CONST] = 0.05f;
+        if (kind == KIT) {
+            e.preset = osc % pcm_samples;
+            e.midi_note = 50 + osc % 20;
+        } else {
+            e.preset = PRESET;
+            e.mode = PCM_LOOP;
+            e.midi_note = 48 + osc % 24;
+        }
+        e.velocity = 1;
+        amy_add_event(&e);
+    }
+    amy_simple_fill_buffer();
+    double total_us[2] = {0, 0};
+    for (int run = 0; run < RUNS; ++run) {
+        int vector = run & 1;
+        render_lut_simd = vector ? best : RENDER_LUT_SCALAR;
+        int64_t t0 = amy_get_us();
+        for (int i = 0; i < RUN_BLOCKS; ++i) {
+            // Hits land a few at a time, as a pattern's would.
+            if (kind == KIT) {
+                for (int osc = (run * RUN_BLOCKS + i) % 8; osc < OSCS; osc += 8) {
+                    amy_event e = amy_default_event();
+                    e.osc = osc;
+                    e.velocity = 1;
+                    amy_add_event(&e);
+                }
+            }
+            amy_simple_fill_buffer();
+        }
+        total_us[vector] += (double)(amy_get_us() - t0);
+    }
+    double per_block = (double)(RUNS / 2 * RUN_BLOCKS);
+    printf("%3d %-8s scalar %7.1f us/block, %d-bit %7.1f us/block\n", OSCS, name,
+           total_us[0] / per_block, best == RENDER_LUT_SIMD256 ? 256 : 128, total_us[1] / per_block);
+    amy_stop();
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    bench("kit", KIT);
+    bench("looped", LOOPED);
+    bench("stereo", STEREO);
+    return 0;
+}
@@ -0,0 +1,61 @@
+// Benchmarks one mixed workload -- a 64-osc pad of plain oscs, 16 held Juno
+// voices (saw/pulse through the resonant filter), reverb and chorus -- in
+// whichever SAMPLE format it was compiled for.
+//
+// `make bench` builds it twice, as tests/bench_sample_format (s8.23 fixed
+// point) and tests/bench_sample_format-float (AMY_USE_FLOAT), and runs both,
+// so the two lines it prints compare the formats on this host.  Both have
+// vector kernels; on an x86-64 desktop the float build comes out a little
+// ahead, since its reverb and output mix are plain float math.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define PAD_OSCS 64
+#define JUNO_VOICES 16
+#define BENCH_BLOCKS 600
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = PAD_OSCS + JUNO_VOICES * 5 + 16;
+    amy_start(c);
+    char m[64];
+    for (int osc = 0; osc < PAD_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw%df%dP%.2fl0.01", osc, (osc & 1) ? SAW_DOWN : SINE,
+                 100 + 7 * osc, (osc % 10) / 10.0f);
+        amy_add_message(m);
+    }
+    snprintf(m, sizeof(m), "i1iv%dK0", JUNO_VOICES);
+    amy_add_message(m);
+    for (int n = 0; n < JUNO_VOICES; ++n) {
+        snprintf(m, sizeof(m), "i1n%dl0.2", 36 + 2 * n);
+        amy_add_message(m);
+    }
+    amy_add_message("h0.5,0.85,0.5,3000");
+    amy_add_message("k0.5,320,0.5,0.5");
+    for (int i = 0; i < 20; ++i) amy_simple_fill_buffer();
+    static int64_t us[BENCH_BLOCKS];
+    for (int i = 0; i < BENCH_BLOCKS; ++i) {
+        int64_t t0 = amy_get_us();
+        amy_simple_fill_buffer();
+        us[i] = amy_get_us() - t0;
+    }
+    qsort(us, BENCH_BLOCKS, sizeof(us[0]), cmp_us);
+    printf("%-5s SAMPLE: %d-osc pad + %d Juno voices + reverb + chorus, median block %7.1f us\n",
+           ARITH, PAD_OSCS, JUNO_VOICES, (double)us[BENCH_BLOCKS / 2]);
+    amy_stop();
+    return 0;
+}
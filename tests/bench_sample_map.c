@@ -0,0 +1,107 @@
+// Benchmarks loading a long WAV as a preset two ways: read into sample RAM
+// (pcm_load, then the frames copied in, as load_sample does), and mapped in
+// place (pcm_map_file).  It prints the median load time of each, and how
+// much resident memory each has taken after a note has played the first
+// second of the file: a mapped preset only holds the pages that were read.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "amy.h"
+
+#define PRESET 1024
+#define SECONDS 60
+#define FRAMES (44100 * SECONDS)
+#define CHANNELS 2
+#define LOADS 9
+
+static char filename[MAX_FILENAME_LEN];
+static int16_t *frames;
+
+static void put_u16(FILE *f, uint16_t v) { fputc(v & 0xff, f); fputc(v >> 8, f); }
+static void put_u32(FILE *f, uint32_t v) { put_u16(f, v & 0xffff); put_u16(f, v >> 16); }
+
+static void write_wav(void) {
+    frames = malloc(FRAMES * CHANNELS * sizeof(int16_t));
+    for (uint32_t i = 0; i < FRAMES * CHANNELS; ++i)  frames[i] = (int16_t)((i % 331) * 90 - 15000);
+    FILE *f = fopen(filename, "wb");
+    uint32_t data_bytes = FRAMES * CHANNELS * 2;
+    fwrite("RIFF", 1, 4, f);  put_u32(f, 36 + data_bytes);  fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f);  put_u32(f, 16);  put_u16(f, 1);  put_u16(f, CHANNELS);
+    put_u32(f, 44100);  put_u32(f, 44100 * CHANNELS * 2);  put_u16(f, CHANNELS * 2);  put_u16(f, 16);
+    fwrite("data", 1, 4, f);  put_u32(f, data_bytes);
+    fwrite(frames, sizeof(int16_t), FRAMES * CHANNELS, f);
+    fclose(f);
+}
+
+// Resident kB (Linux; 0 elsewhere).
+static long resident_kb(void) {
+    long pages = 0, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (f == NULL)  return 0;
+    if (fscanf(f, "%ld %ld", &pages, &resident) != 2)  resident = 0;
+    fclose(f);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static void load(bool mapped) {
+    if (mapped) {
+        pcm_map_file(PRESET, filename, 60);
+        return;
+    }
+    // What reading the file into sample RAM costs: the read and the copy.
+    int16_t *ram = pcm_load(PRESET, FRAMES, 44100, CHANNELS, 60, 0, 0);
+    FILE *f = fopen(filename, "rb");
+    fseek(f, 44, SEEK_SET);
+    if (fread(ram, sizeof(int16_t), FRAMES * CHANNELS, f) != FRAMES * CHANNELS)  printf("short read\n");
+    fclose(f);
+}
+
+static void bench(bool mapped) {
+    static int64_t us[LOADS];
+    long grown = 0;
+    for (int l = 0; l < LOADS; ++l) {
+        amy_config_t c = amy_default_config();
+        c.features.startup_bleep = 0;
+        amy_start(c);
+        long kb = resident_kb();
+        int64_t t0 = amy_get_us();
+        load(mapped);
+        us[l] = amy_get_us() - t0;
+        amy_event e = amy_default_event();
+        e.osc = 0;
+        e.wave = PCM;
+        e.preset = PRESET;
+        e.midi_note = 60;
+        e.velocity = 0.5f;
+        amy_add_event(&e);
+        for (int b = 0; b < AMY_SAMPLE_RATE / AMY_BLOCK_SIZE; ++b)  amy_simple_fill_buffer();
+        // After the first, a load can reuse what the last one freed.
+        if (l == 0)  grown = resident_kb() - kb;
+        amy_stop();
+    }
+    qsort(us, LOADS, sizeof(us[0]), cmp_us);
+    printf("sample map: %-6s %d s stereo, loaded in %8.1f us, %6ld kB resident after 1 s played\n",
+           mapped ? "mapped" : "read", SECONDS, (double)us[LOADS / 2], grown);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    snprintf(filename, sizeof(filename), "/tmp/amy_bench_sample_map_%d.wav", (int)getpid());
+    write_wav();
+    bench(false);
+    bench(true);
+    unlink(filename);
+    free(frames);
+    return 0;
+}
@@ -0,0 +1,64 @@
+// Benchmarks what a fired sequencer step costs the render thread: 32 oscs
+// each switched on and off by a pair of repeating sequences, every other
+// tick, at a tempo that makes that well over a hundred steps a block.  It
+// prints the median microseconds per block with the pattern and without,
+// and the difference per step (which includes rendering the notes).  Stored
+// messages that only make events are parsed when they're stored, so a step
+// is decoding and adding its events, not parsing (or copying) its wire
+// string.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define OSCS 32
+#define BLOCKS 2000
+#define TEMPO 1000
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+static double us_per_block(bool pattern, uint32_t *steps) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    char message[64];
+    snprintf(message, sizeof(message), "j%dZ", TEMPO);
+    amy_add_message(message);
+    for (int o = 0; pattern && o < OSCS; ++o) {
+        snprintf(message, sizeof(message), "H0,2,%dZv%dw1n%da0.01l1Z", 2 * o, o, 40 + o);
+        amy_add_message(message);
+        snprintf(message, sizeof(message), "H1,2,%dZv%dl0Z", 2 * o + 1, o);
+        amy_add_message(message);
+    }
+    amy_execute_deltas();
+    uint32_t tick0 = amy_global.sequencer_tick_count;
+    static int64_t us[BLOCKS];
+    for (int b = 0; b < BLOCKS; ++b) {
+        int64_t t0 = amy_get_us();
+        amy_simple_fill_buffer();
+        us[b] = amy_get_us() - t0;
+    }
+    *steps = pattern ? (amy_global.sequencer_tick_count - tick0) * OSCS : 0;
+    amy_stop();
+    qsort(us, BLOCKS, sizeof(us[0]), cmp_us);
+    return (double)us[BLOCKS / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    uint32_t steps = 0, none = 0;
+    double quiet = us_per_block(false, &none);
+    double busy = us_per_block(true, &steps);
+    double steps_per_block = (double)steps / BLOCKS;
+    printf("sequencer fire: %.1f steps a block, %.1f us a block (%.1f without), %.2f us a step\n",
+           steps_per_block, busy, quiet, (busy - quiet) / steps_per_block);
+    return 0;
+}
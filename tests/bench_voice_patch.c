@@ -0,0 +1,93 @@
+// Benchmarks a 200-voice patch -- 100 Juno voices and 100 DX7 voices, as
+// eight 25-voice synths, all held -- to show what osc state layout costs in
+// cache misses.
+//
+// Every block walks well over a thousand oscs' synthinfo, mod_synthinfo
+// and breakpoints, more than fits in cache.  "warm" renders blocks back to
+// back; "cold" sweeps a buffer bigger than the last-level cache between
+// blocks (outside the timed part), the way an audio callback finds the
+// cache after the rest of the program has run.  The gap between the two is
+// the cost of pulling osc state back in, which is what the hot/cold split
+// of synthinfo (amy.h) is meant to shrink.  On the machines it's been run on
+// that gap swings from run to run by more than any layout change has moved
+// it, so it shows no timing win for the layout.  It also prints how many
+// cache lines synthinfo's per-block group (everything before its filter
+// state) spans, which only the layout moves.
+//
+// Build/run with `make bench`.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "amy.h"
+
+#define BENCH_BLOCKS 400
+#define EVICT_BYTES (32 * 1024 * 1024)
+
+static uint8_t *evict_buf;
+
+static void evict_cache(void) {
+    for (int i = 0; i < EVICT_BYTES; i += 64) evict_buf[i]++;
+}
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t d = *(const int64_t *)a - *(const int64_t *)b;
+    return (d > 0) - (d < 0);
+}
+
+// Median block time: the machine's other load only ever adds time, and a
+// median shrugs off the blocks it lands on.
+static double us_per_block(bool cold) {
+    static int64_t us[BENCH_BLOCKS];
+    for (int i = 0; i < BENCH_BLOCKS; ++i) {
+        if (cold) evict_cache();
+        int64_t t0 = amy_get_us();
+        amy_simple_fill_buffer();
+        us[i] = amy_get_us() - t0;
+    }
+    qsort(us, BENCH_BLOCKS, sizeof(us[0]), cmp_us);
+    return (double)us[BENCH_BLOCKS / 2];
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    evict_buf = calloc(EVICT_BYTES, 1);
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    // No FX, so the block's cost is the voices and the mix.
+    c.features.reverb = 0;
+    c.features.chorus = 0;
+    c.features.echo = 0;
+    c.max_oscs = 1800;
+    c.max_voices = 200;
+    amy_start(c);
+    // Odd synths get Juno patch 0 (5 oscs a voice), even ones DX7 patch 0
+    // (9 oscs a voice).
+    char m[32];
+    for (int s = 1; s <= 8; ++s) {
+        snprintf(m, sizeof(m), "i%div25K%d", s, (s & 1) ? 0 : 128);
+        amy_add_message(m);
+        for (int n = 0; n < 25; ++n) {
+            snprintf(m, sizeof(m), "i%dn%dl0.1", s, 40 + n);
+            amy_add_message(m);
+        }
+    }
+    for (int i = 0; i < 20; ++i) amy_simple_fill_buffer();
+    int audible = 0;
+    for (int osc = 0; osc < AMY_OSCS; ++osc)
+        if (synth[osc] != NULL && synth[osc]->status == SYNTH_AUDIBLE) audible++;
+    printf("200 voices, %d oscs audible, %d bytes of synthinfo + mod_synthinfo per osc\n",
+           audible, (int)(sizeof(struct synthinfo) + sizeof(struct mod_synthinfo)));
+    int hot = (int)offsetof(struct synthinfo, filter_delay);
+    printf("per-block synthinfo group: %d bytes, %d 64-byte lines\n", hot, (hot + 63) / 64);
+    double warm = us_per_block(false);
+    double cold = us_per_block(true);
+    printf("median block: warm %7.1f us, cold %7.1f us (%.1f us refilling the cache)\n",
+           warm, cold, cold - warm);
+    amy_stop();
+    free(evict_buf);
+    return 0;
+}
@@ -0,0 +1,293 @@
+// Tests adding events as a batch (amy_add_events, amy_add_messages,
+// amy_add_binary_events): a thread's deltas held back and handed to the
+// scheduler together.
+//
+//   - Four threads add batches at once while another drains them; every
+//     delta arrives, each thread's in order, each batch all together.
+//   - With the ring too full to take a batch, it goes in under the lock,
+//     behind what the ring already holds.
+//   - A batch longer than a delta batch holds still all arrives, in order.
+//   - A batch's deltas go in time order; those at the same time keep the
+//     order they were made in.
+//   - A batch opened inside another adds to the outer one.
+//   - Chords added with amy_add_events and amy_add_messages leave the synth
+//     as the same events added one by one do.
+//   - A patch load in a batch of messages plays after what came before it,
+//     and a reset of the events drops what came before it.
+//   - amy_add_binary_events counts the events, or says it couldn't read one.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define PRODUCERS 4
+#define PER_BATCH 37
+#define BATCHES 600  // all of them fit in the delta pool at once
+
+static delta_batch_t batches[PRODUCERS];
+
+// Each producer's deltas are for its own osc, numbered in the order it adds them.
+static void *produce(void *arg) {
+    uintptr_t p = (uintptr_t)arg;
+    struct delta d = { 0 };
+    d.osc = (uint16_t)p;
+    d.param = NO_PARAM;
+    d.time = 0;  // due as soon as it's drained
+    for (uint32_t b = 0; b < BATCHES; ++b) {
+        delta_batch_begin(&batches[p]);
+        for (uint32_t i = 0; i < PER_BATCH; ++i) {
+            d.data.i = b * PER_BATCH + i;
+            add_delta_to_queue(&d, &amy_global.delta_queue);
+        }
+        delta_batch_end(&batches[p]);
+    }
+    return NULL;
+}
+
+// Drain the ring and take what's due, as flush_due_deltas does; count the
+// deltas, those out of order for their producer, and those that don't follow
+// the one before them in their batch.
+static uint32_t next_expected[PRODUCERS];
+static uint32_t received = 0, out_of_order = 0, split = 0;
+static struct delta last;
+
+static void drain_and_check(void) {
+    amy_grab_lock();
+    delta_ring_drain();
+    struct delta *d = delta_sched_take_due(amy_sysclock());
+    while (d) {
+        if (d->osc >= PRODUCERS || d->data.i != next_expected[d->osc])  out_of_order++;
+        else  next_expected[d->osc]++;
+        if (d->data.i % PER_BATCH != 0 && (last.osc != d->osc || last.data.i + 1 != d->data.i))  split++;
+        last = *d;
+        received++;
+        amy_global.delta_qsize--;
+        d = delta_release(d);
+    }
+    amy_release_lock();
+}
+
+static void reset_counts(void) {
+    memset(next_expected, 0, sizeof(next_expected));
+    received = out_of_order = split = 0;
+    last.osc = PRODUCERS;
+}
+
+static void test_batches_arrive_together(void) {
+    printf("batches from many threads all arrive, in order and each all together\n");
+    reset_counts();
+    pthread_t threads[PRODUCERS];
+    for (uintptr_t p = 0; p < PRODUCERS; ++p)
+        pthread_create(&threads[p], NULL, produce, (void *)p);
+    while (received < PRODUCERS * BATCHES * PER_BATCH)  drain_and_check();
+    for (int p = 0; p < PRODUCERS; ++p)  pthread_join(threads[p], NULL);
+    drain_and_check();
+    CHECK(received == PRODUCERS * BATCHES * PER_BATCH && out_of_order == 0 && split == 0,
+          "%d threads x %d batches of %d: %u received, %u out of order, %u split (ring full %u times)",
+          PRODUCERS, BATCHES, PER_BATCH, received, out_of_order, split, amy_global.delta_ring_full);
+    CHECK(delta_ring_len() == 0 && delta_sched_len() == 0, "ring and scheduler left empty");
+}
+
+static void test_full_ring(void) {
+    printf("a batch the ring hasn't room for goes in under the lock, behind the ring\n");
+    reset_counts();
+    struct delta d = { 0 };
+    d.param = NO_PARAM;
+    uint32_t capacity = 0;
+    for (; delta_ring_push(&d); ++capacity)  d.data.i = capacity + 1;
+    uint32_t full_before = amy_global.delta_ring_full;
+    delta_batch_begin(&batches[0]);
+    for (uint32_t i = 0; i < 10; ++i, d.data.i++)  add_delta_to_queue(&d, &amy_global.delta_queue);
+    delta_batch_end(&batches[0]);
+    CHECK(amy_global.delta_ring_full == full_before + 1, "ring holding %u was full once", capacity);
+    drain_and_check();
+    CHECK(received == capacity + 10 && out_of_order == 0, "all %u arrived in order (%u received, %u out of order)",
+          capacity + 10, received, out_of_order);
+}
+
+static void test_long_batch(void) {
+    printf("a batch longer than a delta batch holds\n");
+    reset_counts();
+    struct delta d = { 0 };
+    d.param = NO_PARAM;
+    uint32_t n = 5 * AMY_DELTA_BATCH_LEN + 3;
+    delta_batch_begin(&batches[0]);
+    for (uint32_t i = 0; i < n; ++i, d.data.i++)  add_delta_to_queue(&d, &amy_global.delta_queue);
+    delta_batch_end(&batches[0]);
+    drain_and_check();
+    CHECK(received == n && out_of_order == 0, "all %u arrived in order (%u received, %u out of order)",
+          n, received, out_of_order);
+}
+
+static void test_time_order(void) {
+    printf("a batch's deltas go in time order, same-time ones as they were made\n");
+    uint32_t now = amy_sysclock();
+    uint32_t offsets[] = { 5, 1, 3, 1, 0, 5, 3 };
+    int32_t expected[] = { 4, 1, 3, 2, 6, 0, 5 };  // the indices, by (time, then order made)
+    int n = sizeof(offsets) / sizeof(offsets[0]);
+    struct delta d = { 0 };
+    d.param = NO_PARAM;
+    delta_batch_begin(&batches[0]);
+    for (int i = 0; i < n; ++i) {
+        d.time = now + offsets[i];
+        d.data.i = i;
+        add_delta_to_queue(&d, &amy_global.delta_queue);
+    }
+    delta_batch_end(&batches[0]);
+    amy_grab_lock();
+    delta_ring_drain();
+    struct delta *due = delta_sched_take_due(now + 10);
+    int i = 0, wrong = 0;
+    while (due) {
+        if (i >= n || due->data.i != (uint32_t)expected[i])  wrong++;
+        i++;
+        amy_global.delta_qsize--;
+        due = delta_release(due);
+    }
+    amy_release_lock();
+    CHECK(i == n && wrong == 0, "%d of %d came out, %d in the wrong place", i, n, wrong);
+}
+
+static void test_nested(void) {
+    printf("a batch opened inside another adds to it\n");
+    reset_counts();
+    struct delta d = { 0 };
+    d.param = NO_PARAM;
+    delta_batch_begin(&batches[0]);
+    add_delta_to_queue(&d, &amy_global.delta_queue);
+    bool opened = delta_batch_begin(&batches[1]);
+    d.data.i++;
+    add_delta_to_queue(&d, &amy_global.delta_queue);
+    delta_batch_end(&batches[1]);  // not open, so does nothing
+    CHECK(!opened && batches[0].len == 2 && delta_ring_len() == 0, "the inner one didn't open; the outer holds both");
+    delta_batch_end(&batches[0]);
+    drain_and_check();
+    CHECK(received == 2 && out_of_order == 0, "both arrived when the outer one closed");
+}
+
+// Whether the voices of synths a and b are all in the same state.
+static bool same_voices(int a, int b) {
+    uint16_t va[MAX_VOICES_PER_INSTRUMENT], vb[MAX_VOICES_PER_INSTRUMENT];
+    int n = instrument_get_num_voices(a, va);
+    if (n != instrument_get_num_voices(b, vb))  return false;
+    int oscs = instrument_get_oscs_per_voice(a);
+    for (int v = 0; v < n; ++v) {
+        for (int i = 0; i < oscs; ++i) {
+            struct synthinfo *sa = synth[voice_to_base_osc[va[v]] + i];
+            struct synthinfo *sb = synth[voice_to_base_osc[vb[v]] + i];
+            if (sa == NULL || sb == NULL) {
+                if (sa != sb)  return false;
+                continue;
+            }
+            // Bitwise: an unused osc's note is NAN.
+            if (sa->status != sb->status || memcmp(&sa->midi_note, &sb->midi_note, sizeof(float)) != 0
+                || memcmp(&sa->velocity, &sb->velocity, sizeof(float)) != 0
+                || sa->note_on_clock != sb->note_on_clock || sa->note_off_clock != sb->note_off_clock)
+                return false;
+        }
+    }
+    return true;
+}
+
+static amy_event note(int synth_number, int midi_note, float velocity) {
+    amy_event e;
+    amy_clear_event_sparse(&e);
+    AMY_EVENT_SET(&e, synth, synth_number);
+    AMY_EVENT_SET(&e, midi_note, midi_note);
+    AMY_EVENT_SET(&e, velocity, velocity);
+    return e;
+}
+
+static void test_as_one_by_one(void) {
+    printf("a batch plays as its events added one by one do\n");
+    amy_add_message("i1iv4K1Z");
+    amy_add_message("i2iv4K1Z");
+    amy_add_message("i3iv4K1Z");
+    amy_execute_deltas();
+    int notes[] = { 60, 64, 67, 71, 74 };  // one more than there are voices
+    amy_event events[6];
+    for (int i = 0; i < 5; ++i)  events[i] = note(2, notes[i], 1);
+    events[5] = note(2, 64, 0);
+    amy_add_events(events, 6);
+    char wire[256] = "";
+    for (int i = 0; i < 6; ++i) {
+        amy_event e = events[i];
+        e.synth = 1;
+        amy_add_event(&e);
+        size_t used = strlen(wire);
+        snprintf(wire + used, sizeof(wire) - used, "i3n%dl%dZ\n", (int)e.midi_note, (int)e.velocity);
+    }
+    amy_add_messages(wire);
+    amy_execute_deltas();
+    CHECK(same_voices(1, 2), "amy_add_events: the same as one by one");
+    CHECK(same_voices(1, 3), "amy_add_messages: the same as one by one");
+}
+
+static void test_loads_and_resets(void) {
+    printf("patch loads and resets in a batch of messages\n");
+    amy_add_messages("v110w1Z\ni4iv2K2Z\ni4n60l1Z");
+    amy_execute_deltas();
+    uint16_t voices[MAX_VOICES_PER_INSTRUMENT];
+    int n = instrument_get_num_voices(4, voices);
+    struct synthinfo *s = (n > 0) ? synth[voice_to_base_osc[voices[0]]] : NULL;
+    CHECK(synth[110] != NULL && synth[110]->wave == 1, "what came before a patch load played");
+    CHECK(s != NULL && s->status == SYNTH_AUDIBLE && s->midi_note == 60, "a note-on after the load played");
+    char wire[64];
+    snprintf(wire, sizeof(wire), "v111w2Z\nS%dZ\nv112w3Z", RESET_EVENTS);
+    amy_add_messages(wire);
+    amy_execute_deltas();
+    CHECK((synth[111] == NULL || synth[111]->wave != 2) && synth[112] != NULL && synth[112]->wave == 3,
+          "a reset of the events dropped what came before it, and not what came after");
+}
+
+static void test_binary_events(void) {
+    printf("amy_add_binary_events\n");
+    uint8_t buf[3 * AMY_BINARY_EVENT_MAX_LEN];
+    size_t len = 0;
+    for (int i = 0; i < 3; ++i) {
+        amy_event e = amy_default_event();
+        e.osc = 113 + i;
+        e.wave = SAW_DOWN;
+        len += amy_event_to_binary(&e, buf + len, sizeof(buf) - len);
+    }
+    int n = amy_add_binary_events(buf, len);
+    amy_execute_deltas();
+    CHECK(n == 3 && synth[115] != NULL && synth[115]->wave == SAW_DOWN, "three events, all played (%d)", n);
+    CHECK(amy_add_binary_events(buf, len - 1) == -1, "a cut-off one can't be read");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    // Start from an empty queue.
+    amy_grab_lock();
+    amy_deltas_reset();
+    amy_release_lock();
+    test_batches_arrive_together();
+    test_full_ring();
+    test_long_batch();
+    test_time_order();
+    test_nested();
+    test_as_one_by_one();
+    test_loads_and_resets();
+    test_binary_events();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Tests binary events (amy_event_to_binary / amy_binary_to_event /
+// amy_add_binary_event) against the wire strings sprint_event() writes:
+//
+//   - Random events come back from encoding and decoding identical, field for
+//     field, and print the same.
+//   - Wire strings parsed, encoded and decoded print as the parse did.
+//   - Every field set at once still fits in AMY_BINARY_EVENT_MAX_LEN; a
+//     buffer too short for an event gets nothing.
+//   - A note-on is a handful of bytes.
+//   - Anything cut short, of another version, or with fields this version
+//     doesn't know is refused.
+//   - amy_add_binary_event plays an event as amy_add_message plays its wire
+//     string, and says how much it used, so a run of them can be walked.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define SPRINT_LEN 4096
+
+static uint32_t rand_state = 1;
+static uint32_t rnd(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state >> 8;
+}
+static int coin(void) { return (rnd() & 3) == 0; }
+// Values that print exactly to 3 places, so the wire form is exact too.
+static float rnd_float(void) { return (float)((int)(rnd() % 20001) - 10000) / 8.0f; }
+
+#define MAYBE(FIELD, VAL) if (coin()) (FIELD) = (VAL)
+#define MAYBE_EACH(FIELD, LEN, VAL) for (int i = 0; i < (LEN); ++i) MAYBE(FIELD[i], VAL)
+
+// A cleared event, padding and all, so two can be compared with memcmp.
+static void clear_event(amy_event *e) {
+    memset(e, 0, sizeof(*e));
+    amy_clear_event(e);
+}
+
+static void random_event(amy_event *e) {
+    clear_event(e);
+    MAYBE(e->time, rnd());
+    MAYBE(e->osc, rnd() % AMY_OSCS);
+    MAYBE(e->wave, rnd() % WAVETABLE);
+    MAYBE(e->mode, rnd() % 4);
+    MAYBE(e->preset, (int16_t)(rnd() % 2000) - 1000);
+    MAYBE(e->midi_note, rnd_float());
+    MAYBE(e->patch_number, rnd() % 1100);
+    MAYBE_EACH(e->amp_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->freq_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->filter_freq_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->duty_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->pan_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE(e->feedback, rnd_float());
+    MAYBE(e->velocity, rnd_float());
+    MAYBE(e->trigger_phase, rnd_float());
+    MAYBE(e->sample_offset, rnd() % AMY_BLOCK_SIZE);
+    MAYBE(e->fit_ticks, rnd_float());
+    MAYBE(e->fit_search, rnd() % 1000);
+    MAYBE(e->volume, rnd_float());
+    MAYBE(e->pitch_bend, rnd_float());
+    MAYBE(e->tempo, rnd_float());
+    MAYBE(e->latency_ms, rnd() % 1000);
+    MAYBE(e->ratio, rnd_float());
+    MAYBE(e->resonance, rnd_float());
+    MAYBE(e->portamento_ms, rnd() % 1000);
+    MAYBE(e->chained_osc, rnd() % AMY_OSCS);
+    MAYBE_EACH(e->mod_source, NUM_MOD_SOURCES, rnd() % AMY_OSCS);
+    MAYBE(e->algorithm, rnd() % 32);
+    MAYBE(e->filter_type, rnd() % 5);
+    MAYBE(e->dist_type, rnd() % 4);
+    MAYBE(e->dist_drive, rnd_float());
+    MAYBE(e->dist_bits, rnd() % 25);
+    MAYBE(e->dist_rate, rnd() % 48000);
+    MAYBE(e->dist_mix, rnd_float());
+    MAYBE(e->eq_l, rnd_float());
+    MAYBE(e->eq_m, rnd_float());
+    MAYBE(e->eq_h, rnd_float());
+    MAYBE_EACH(e->bp_is_set, MAX_BREAKPOINT_SETS, 1);
+    MAYBE_EACH(e->algo_source, MAX_ALGO_OPS, (int16_t)(rnd() % 200) - 100);
+    MAYBE_EACH(e->eg0_times, MAX_BPS, rnd() % 100000);
+    MAYBE_EACH(e->eg0_values, MAX_BPS, rnd_float());
+    MAYBE_EACH(e->eg1_times, MAX_BPS, rnd() % 100000);
+    MAYBE_EACH(e->eg1_values, MAX_BPS, rnd_float());
+    MAYBE_EACH(e->eg_type, MAX_BREAKPOINT_SETS, rnd() % 4);
+    MAYBE(e->synth, rnd() % 32);
+    MAYBE(e->synth_flags, rnd() % 16);
+    MAYBE(e->synth_level, rnd_float());
+    MAYBE(e->synth_delay_ms, rnd() % 1000);
+    MAYBE(e->to_synth, rnd() % 32);
+    MAYBE(e->grab_midi_notes, rnd() % 2);
+    MAYBE(e->pedal, rnd() % 128);
+    MAYBE(e->num_voices, rnd() % 16);
+    MAYBE(e->oscs_per_voice, rnd() % 16);
+    MAYBE_EACH(e->ticks, 3, rnd());
+    MAYBE(e->note_source_channel, rnd() % 16);
+    // Not RESET_AMY or RESET_EVENTS: parsing those acts on them.
+    MAYBE(e->reset_osc, rnd() % RESET_AMY);
+    MAYBE(e->bus, rnd() % 4);
+    MAYBE(e->echo_level, rnd_float());
+    MAYBE(e->echo_delay_ms, rnd_float());
+    MAYBE(e->echo_max_delay_ms, rnd_float());
+    MAYBE(e->echo_feedback, rnd_float());
+    MAYBE(e->echo_filter_coef, rnd_float());
+    MAYBE(e->chorus_level, rnd_float());
+    MAYBE(e->chorus_max_delay, rnd_float());
+    MAYBE(e->chorus_lfo_freq, rnd_float());
+    MAYBE(e->chorus_depth, rnd_float());
+    MAYBE(e->reverb_level, rnd_float());
+    MAYBE(e->reverb_liveness, rnd_float());
+    MAYBE(e->reverb_damping, rnd_float());
+    MAYBE(e->reverb_xover_hz, rnd_float());
+}
+
+// Encode and decode e into out; false if either step fails.
+static bool round_trip(amy_event *e, amy_event *out, size_t *nbytes) {
+    uint8_t buf[AMY_BINARY_EVENT_MAX_LEN];
+    size_t n = amy_event_to_binary(e, buf, sizeof(buf));
+    if (nbytes)  *nbytes = n;
+    if (n == 0)  return false;
+    clear_event(out);
+    if (amy_binary_to_event(buf, n, out) != (int)n)  return false;
+    // Decoded events are sparse, marking only the groups they set (which
+    // test_event_presence checks); here it's the fields that are compared.
+    out->present = e->present;
+    return true;
+}
+
+static bool same_print(amy_event *a, amy_event *b, bool wirecode) {
+    static char sa[SPRINT_LEN], sb[SPRINT_LEN];
+    sprint_event(a, sa, SPRINT_LEN, wirecode);
+    sprint_event(b, sb, SPRINT_LEN, wirecode);
+    return strcmp(sa, sb) == 0;
+}
+
+static void test_random_events(void) {
+    printf("random events come back from binary unchanged\n");
+    int bad_trip = 0, bad_fields = 0, bad_print = 0;
+    size_t most = 0;
+    for (int i = 0; i < 5000; ++i) {
+        amy_event e, d;
+        size_t n;
+        random_event(&e);
+        if (!round_trip(&e, &d, &n)) { bad_trip++; continue; }
+        if (n > most)  most = n;
+        if (memcmp(&e, &d, sizeof(e)) != 0)  bad_fields++;
+        if (!same_print(&e, &d, false) || !same_print(&e, &d, true))  bad_print++;
+    }
+    CHECK(bad_trip == 0 && bad_fields == 0 && bad_print == 0,
+          "5000 events: %d failed to round-trip, %d differ, %d print differently (longest %d bytes)",
+          bad_trip, bad_fields, bad_print, (int)most);
+}
+
+static void test_wire_strings(void) {
+    printf("wire strings parsed, then through binary, print as parsed\n");
+    const char *wires[] = {
+        "v0w1n60l1Z",
+        "v3f440,1,,,0.5a0,0,0.8A10,1,200,0.5,500,0T1Z",
+        "i1iv6in2K257Z",
+        "v2G1R2.5F500,,,,2GH8,4000GD2GM0.5Z",
+        "v5L3,4O1,-1,2,,3Z",
+        "x1,-2,3h0.5,0.8,0.3,3000M0.2,300,500,0.4Z",
+        "y1V2.5k0.5,320,0.5,0.5Z",
+        "ww2pF3.5po12pS40Z",
+    };
+    int n_wires = sizeof(wires) / sizeof(wires[0]);
+    int bad = 0;
+    for (int i = 0; i < n_wires; ++i) {
+        char m[MAX_MESSAGE_LEN];
+        strcpy(m, wires[i]);
+        amy_event e, d;
+        clear_event(&e);
+        amy_parse_message(m, &e);
+        if (!round_trip(&e, &d, NULL) || !same_print(&e, &d, true)) {
+            printf("       %s\n", wires[i]);
+            bad++;
+        }
+    }
+    // And random events, by way of their wire strings.
+    int bad_random = 0;
+    for (int i = 0; i < 1000; ++i) {
+        amy_event r, e, d;
+        static char m[SPRINT_LEN];
+        random_event(&r);
+        sprint_event(&r, m, SPRINT_LEN, /* wirecode */ true);
+        clear_event(&e);
+        amy_parse_message(m, &e);
+        if (!round_trip(&e, &d, NULL) || memcmp(&e, &d, sizeof(e)) != 0 || !same_print(&e, &d, true))
+            bad_random++;
+    }
+    CHECK(bad == 0 && bad_random == 0, "%d of %d set strings and %d of 1000 random ones differ",
+          bad, n_wires, bad_random);
+}
+
+static void test_sizes(void) {
+    printf("sizes\n");
+    amy_event e, d;
+    char m[] = "v0n60l1Z";
+    clear_event(&e);
+    amy_parse_message(m, &e);
+    size_t n;
+    bool ok = round_trip(&e, &d, &n);
+    CHECK(ok && n <= 11, "note-on \"v0n60l1\" is %d bytes", (int)n);
+
+    // Every field and element set, to values that take the most bytes.
+    clear_event(&e);
+    e.time = 0xFFFFFFF0; e.osc = 0; e.wave = 0xFFF0; e.mode = 0xFFF0; e.preset = INT16_MIN;
+    e.midi_note = 1; e.patch_number = 0xFFF0;
+    for (int i = 0; i < NUM_COMBO_COEFS; ++i)
+        e.amp_coefs[i] = e.freq_coefs[i] = e.filter_freq_coefs[i] = e.duty_coefs[i] = e.pan_coefs[i] = 1;
+    e.feedback = e.velocity = e.trigger_phase = e.fit_ticks = e.volume = e.pitch_bend = e.tempo = 1;
+    e.ratio = e.resonance = e.dist_drive = e.dist_mix = e.eq_l = e.eq_m = e.eq_h = e.synth_level = 1;
+    e.sample_offset = e.fit_search = e.latency_ms = e.portamento_ms = e.chained_osc = 0xFFF0;
+    e.dist_rate = e.synth_delay_ms = e.num_voices = e.bus = 0xFFF0;
+    e.mod_source[0] = e.mod_source[1] = 0xFFF0;
+    e.algorithm = e.filter_type = e.dist_type = e.dist_bits = e.synth = e.to_synth = 0xF0;
+    e.grab_midi_notes = e.pedal = e.oscs_per_voice = e.note_source_channel = 0xF0;
+    e.eg_type[0] = e.eg_type[1] = 0xF0;
+    e.bp_is_set[0] = e.bp_is_set[1] = 0xFFF0;
+    for (int i = 0; i < MAX_ALGO_OPS; ++i)  e.algo_source[i] = INT16_MIN;
+    for (int i = 0; i < MAX_BPS; ++i) {
+        e.eg0_times[i] = e.eg1_times[i] = 0xFFFFFFF0;
+        e.eg0_values[i] = e.eg1_values[i] = 1;
+    }
+    e.synth_flags = e.reset_osc = 0xFFFFFFF0;
+    e.ticks[0] = e.ticks[1] = e.ticks[2] = 0xFFFFFFF0;
+    e.echo_level = e.echo_delay_ms = e.echo_max_delay_ms = e.echo_feedback = e.echo_filter_coef = 1;
+    e.chorus_level = e.chorus_max_delay = e.chorus_lfo_freq = e.chorus_depth = 1;
+    e.reverb_level = e.reverb_liveness = e.reverb_damping = e.reverb_xover_hz = 1;
+    ok = round_trip(&e, &d, &n);
+    CHECK(ok && memcmp(&e, &d, sizeof(e)) == 0, "every field set: %d bytes, within %d", (int)n,
+          AMY_BINARY_EVENT_MAX_LEN);
+    uint8_t buf[AMY_BINARY_EVENT_MAX_LEN];
+    CHECK(amy_event_to_binary(&e, buf, n - 1) == 0 && amy_event_to_binary(&e, buf, n) == n,
+          "a buffer a byte short gets nothing, one just big enough gets it all");
+}
+
+static void test_refused(void) {
+    printf("binary events this version can't read are refused\n");
+    amy_event e, d;
+    char m[] = "v1w0f440,1a0,0,0.8A10,1,200,0Z";
+    clear_event(&e);
+    amy_parse_message(m, &e);
+    uint8_t buf[AMY_BINARY_EVENT_MAX_LEN];
+    size_t n = amy_event_to_binary(&e, buf, sizeof(buf));
+    int short_read = 0;
+    for (size_t len = 0; len < n; ++len)
+        if (amy_binary_to_event(buf, len, &d) != -1)  short_read++;
+    CHECK(n > 0 && short_read == 0, "every one of the %d shorter prefixes is refused", (int)n);
+    CHECK(amy_binary_to_event(buf, n + 10, &d) == (int)n, "trailing bytes are left for the next one");
+
+    uint8_t other_version[] = { AMY_BINARY_EVENT_VERSION + 1, 0x00 };
+    CHECK(amy_binary_to_event(other_version, sizeof(other_version), &d) == -1, "another version");
+    uint8_t wire[] = "v0n60Z";
+    CHECK(amy_binary_to_event(wire, sizeof(wire), &d) == -1, "a wire string");
+    // Mask bit 77: past any field there is.
+    uint8_t unknown[] = { AMY_BINARY_EVENT_VERSION, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+    CHECK(amy_binary_to_event(unknown, sizeof(unknown), &d) == -1, "a field this version doesn't know");
+    // synth (bit 5) is a uint8_t; 300 doesn't fit.
+    uint8_t too_big[] = { AMY_BINARY_EVENT_VERSION, 1 << 5, 0xAC, 0x02 };
+    CHECK(amy_binary_to_event(too_big, sizeof(too_big), &d) == -1, "a value too big for its field");
+    uint8_t endless[] = { AMY_BINARY_EVENT_VERSION, 1 << 1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+    CHECK(amy_binary_to_event(endless, sizeof(endless), &d) == -1, "a varint longer than 32 bits");
+    CHECK(amy_add_binary_event(other_version, sizeof(other_version)) == -1, "amy_add_binary_event refuses them too");
+}
+
+static void test_plays(void) {
+    printf("amy_add_binary_event plays what amy_add_message would\n");
+    amy_add_message("v1w0f220a0.5n50l1Z");
+    amy_event e;
+    char m[] = "v2w0f220a0.5n50l1Z";
+    clear_event(&e);
+    amy_parse_message(m, &e);
+    // Two events back to back: osc 2's note-on, then osc 3's wave.
+    uint8_t buf[2 * AMY_BINARY_EVENT_MAX_LEN];
+    size_t n = amy_event_to_binary(&e, buf, AMY_BINARY_EVENT_MAX_LEN);
+    clear_event(&e);
+    e.osc = 3;
+    e.wave = SAW_DOWN;
+    size_t n2 = amy_event_to_binary(&e, buf + n, AMY_BINARY_EVENT_MAX_LEN);
+    size_t pos = 0;
+    int events = 0;
+    while (pos < n + n2) {
+        int used = amy_add_binary_event(buf + pos, n + n2 - pos);
+        if (used <= 0)  break;
+        pos += used;
+        events++;
+    }
+    CHECK(events == 2 && pos == n + n2, "walked %d events, %d of %d bytes", events, (int)pos, (int)(n + n2));
+    amy_execute_deltas();
+    CHECK(synth[2] && synth[1]->logfreq_coefs[COEF_CONST] == synth[2]->logfreq_coefs[COEF_CONST]
+          && synth[1]->amp_coefs[COEF_CONST] == synth[2]->amp_coefs[COEF_CONST]
+          && synth[1]->status == synth[2]->status && synth[1]->midi_note == synth[2]->midi_note,
+          "osc 2 (binary) is set up and playing as osc 1 (wire) is");
+    CHECK(synth[3] && synth[3]->wave == SAW_DOWN, "osc 3's wave came from the second event");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_random_events();
+    test_wire_strings();
+    test_sizes();
+    test_refused();
+    test_plays();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,215 @@
+// Tests hold_and_modify's control cache: each osc only combining its
+// logfreq, filter, duty, pan and amp controls again when an input its coefs
+// read (note, velocity, envelopes, mod sources, bend, ext CV) has moved.
+//
+// Two oscs get the same random coefs -- mostly zero, as patches' are --
+// envelopes, notes and portamento, and share an LFO as mod source.  Pitch
+// bend and the CV inputs wander, notes come and go, and coefs are edited
+// mid-note.  One osc's cache is marked stale before every hold_and_modify,
+// so it combines everything every block as the code did before the cache;
+// the other's isn't.  Their msynth outputs have to agree bit for bit on
+// every block.  The oscs are driven directly, without rendering.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define CACHED_OSC 0
+#define FORCED_OSC 1
+#define SCENARIOS 300
+#define SCENARIO_BLOCKS 200
+
+static uint32_t rand_state = 12345;
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state >> 8;
+}
+static float rand_float(float lo, float hi) {
+    return lo + (next_rand() % 10000) / 10000.0f * (hi - lo);
+}
+
+static void next_block(void) {
+    amy_global.total_blocks++;
+    amy_global.total_samples += AMY_BLOCK_SIZE;
+}
+
+// The same random coef vector in both oscs, about a third of it nonzero.
+static void random_coefs(int which) {
+    for (int i = 0; i < NUM_COMBO_COEFS; ++i) {
+        float v = (next_rand() % 3 == 0) ? rand_float(-1.0f, 2.0f) : 0;
+        for (uint16_t osc = CACHED_OSC; osc <= FORCED_OSC; ++osc) {
+            float *coefs[] = { synth[osc]->amp_coefs, synth[osc]->logfreq_coefs, synth[osc]->filter_logfreq_coefs,
+                               synth[osc]->duty_coefs, synth[osc]->pan_coefs };
+            coefs[which][i] = v;
+            osc_coefs_changed(synth[osc]);
+        }
+    }
+}
+
+static void random_envelope(uint8_t bp_set) {
+    int n = 1 + next_rand() % 4;
+    for (int i = 0; i < DEFAULT_NUM_BREAKPOINTS; ++i) {
+        uint32_t t = next_rand() % (30 * AMY_BLOCK_SIZE);
+        float v = rand_float(0, 1.0f);
+        for (uint16_t osc = CACHED_OSC; osc <= FORCED_OSC; ++osc) {
+            if (i < n) {
+                synth[osc]->breakpoint_times[bp_set][i] = t;
+                synth[osc]->breakpoint_values[bp_set][i] = v;
+            } else {
+                AMY_UNSET(synth[osc]->breakpoint_times[bp_set][i]);
+                AMY_UNSET(synth[osc]->breakpoint_values[bp_set][i]);
+            }
+            osc_envelope_changed(synth[osc], bp_set);
+        }
+    }
+}
+
+static void note_on(void) {
+    float note = 30 + next_rand() % 60, velocity = rand_float(0.1f, 1.0f);
+    for (uint16_t osc = CACHED_OSC; osc <= FORCED_OSC; ++osc) {
+        synth[osc]->midi_note = note;
+        synth[osc]->velocity = velocity;
+        synth[osc]->note_on_clock = amy_global.total_samples;
+        AMY_UNSET(synth[osc]->note_off_clock);
+    }
+}
+
+static void note_off(void) {
+    for (uint16_t osc = CACHED_OSC; osc <= FORCED_OSC; ++osc) {
+        AMY_UNSET(synth[osc]->note_on_clock);
+        synth[osc]->note_off_clock = amy_global.total_samples;
+    }
+}
+
+// The msynth values hold_and_modify writes.
+static int outputs_differ(void) {
+    struct mod_synthinfo *a = msynth[CACHED_OSC], *b = msynth[FORCED_OSC];
+    float va[] = { a->amp, a->last_amp, a->pan, a->last_pan, a->duty, a->logfreq, a->last_logfreq,
+                   a->filter_logfreq, a->last_filter_logfreq };
+    float vb[] = { b->amp, b->last_amp, b->pan, b->last_pan, b->duty, b->logfreq, b->last_logfreq,
+                   b->filter_logfreq, b->last_filter_logfreq };
+    return memcmp(va, vb, sizeof(va)) != 0;
+}
+
+static void test_cache_matches_recombining(void) {
+    printf("the cache gives what combining every block does\n");
+    int bad = 0, bad_scenarios = 0, edits = 0, probes = 0;
+    for (int s = 0; s < SCENARIOS; ++s) {
+        for (int which = 0; which < NUM_CTRL_OUTPUTS; ++which)  random_coefs(which);
+        for (uint8_t bp_set = 0; bp_set < MAX_BREAKPOINT_SETS; ++bp_set)  random_envelope(bp_set);
+        float alpha = (next_rand() % 3 == 0) ? rand_float(0.5f, 0.99f) : 0;
+        float resonance = rand_float(0.7f, 8.0f);
+        for (uint16_t osc = CACHED_OSC; osc <= FORCED_OSC; ++osc) {
+            synth[osc]->portamento_alpha = alpha;
+            synth[osc]->resonance = resonance;
+            synth[osc]->wave = (s % 5 == 0) ? PARTIAL : SINE;
+        }
+        note_on();
+        int scenario_bad = 0;
+        uint32_t off_block = 40 + next_rand() % 120;
+        for (int b = 0; b < SCENARIO_BLOCKS; ++b) {
+            if (b == (int)off_block)  note_off();
+            uint32_t r = next_rand() % 100;
+            if (r < 3)  amy_global.pitch_bend = rand_float(-0.5f, 0.5f);
+            else if (r < 5)  cv_inputs[next_rand() % 2] = rand_float(0, 1.0f);
+            else if (r < 6) {
+                random_coefs(next_rand() % NUM_CTRL_OUTPUTS);  // edit mid-note
+                edits++;
+            } else if (r < 7)  note_on();
+            hold_and_modify(CACHED_OSC);
+            osc_coefs_changed(synth[FORCED_OSC]);
+            hold_and_modify(FORCED_OSC);
+            probes++;
+            scenario_bad += outputs_differ();
+            next_block();
+        }
+        bad += scenario_bad;
+        if (scenario_bad)  bad_scenarios++;
+    }
+    CHECK(bad == 0, "%d scenarios (%d coef edits mid-note): %d differ, %d of %d blocks",
+          SCENARIOS, edits, bad_scenarios, bad, probes);
+}
+
+static void test_steady_controls_not_recombined(void) {
+    printf("controls are only combined again when an input they read moves\n");
+    amy_global.pitch_bend = 0;
+    for (int i = 0; i < NUM_COMBO_COEFS; ++i) {
+        synth[CACHED_OSC]->duty_coefs[i] = 0;
+        synth[CACHED_OSC]->pan_coefs[i] = 0;
+    }
+    synth[CACHED_OSC]->duty_coefs[COEF_CONST] = 0.5f;
+    synth[CACHED_OSC]->pan_coefs[COEF_CONST] = 0.5f;
+    synth[CACHED_OSC]->pan_coefs[COEF_BEND] = 1.0f;
+    osc_coefs_changed(synth[CACHED_OSC]);
+    hold_and_modify(CACHED_OSC);
+    next_block();
+    // Mark the kept values, so a recombination would show.
+    synth[CACHED_OSC]->ctrl.combined[CTRL_DUTY] = 0.25f;
+    synth[CACHED_OSC]->ctrl.combined[CTRL_PAN] = 0.25f;
+    hold_and_modify(CACHED_OSC);
+    CHECK(msynth[CACHED_OSC]->duty == 0.25f && msynth[CACHED_OSC]->pan == 0.25f, "nothing moved: neither recombined");
+    next_block();
+    amy_global.pitch_bend = 0.1f;
+    hold_and_modify(CACHED_OSC);
+    CHECK(msynth[CACHED_OSC]->duty == 0.25f, "bend moved: duty, which doesn't read it, isn't recombined");
+    CHECK(msynth[CACHED_OSC]->pan == 0.6f, "bend moved: pan, which does, is (%f)", msynth[CACHED_OSC]->pan);
+    amy_global.pitch_bend = 0;
+}
+
+static void test_coef_messages_mark_stale(void) {
+    printf("coefs set by message recombine the controls\n");
+    hold_and_modify(CACHED_OSC);
+    CHECK(!synth[CACHED_OSC]->ctrl.stale, "not stale once combined");
+    amy_add_message("v0d0.3,0,0,0,0");
+    amy_simple_fill_buffer();
+    CHECK(synth[CACHED_OSC]->ctrl.stale, "a duty message marks the cache stale");
+    hold_and_modify(CACHED_OSC);
+    CHECK(msynth[CACHED_OSC]->duty == 0.3f, "and the new duty is combined (%f)", msynth[CACHED_OSC]->duty);
+}
+
+static void test_partials_note_on_marks_stale(void) {
+    printf("a partials note-on that drops its partials' bend recombines them\n");
+    const uint16_t parent = 4, partial = 5;
+    ensure_osc_allocd(parent, NULL);
+    ensure_osc_allocd(partial, NULL);
+    amy_global.pitch_bend = 0.5f;
+    hold_and_modify(partial);
+    CHECK(!synth[partial]->ctrl.stale, "partial combined with bend (logfreq %f)", msynth[partial]->logfreq);
+    synth[parent]->preset = 1;  // one partial
+    partials_note_on(parent);
+    CHECK(synth[partial]->ctrl.stale, "partials_note_on marks the partial's cache stale");
+    amy_global.pitch_bend = 0;
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    // Allocate the oscs, with no note, so rendering leaves them alone; both
+    // modulated by the same LFO.
+    amy_add_message("v2w3f3");
+    amy_add_message("v0w0L2");
+    amy_add_message("v1w0L2");
+    amy_simple_fill_buffer();
+    test_cache_matches_recombining();
+    test_steady_controls_not_recombined();
+    test_coef_messages_mark_stale();
+    test_partials_note_on_marks_stale();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
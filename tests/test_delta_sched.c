@@ -0,0 +1,203 @@
+// Tests the delta scheduler -- the timing wheel behind amy_global.delta_queue
+// -- against the sorted list it replaced.
+//
+// Every delta scheduled is also insertion-sorted into a plain list, the way
+// add_delta_to_queue used to keep the queue, and whenever the scheduler is
+// asked for the deltas due by the clock, the list gives up its due head.
+// Both have to come out the same deltas in the same order.  The clock mostly
+// runs a block at a time, but also jumps ahead by hours (past everything the
+// wheel holds, into its overflow), runs backwards (as when a test parks it),
+// crosses the 49.7-day rollover, and is reset with RESET_TIMEBASE's rebase.
+// Deltas are scheduled in the past, now, soon, and days out, and in bursts
+// at a single time, which have to play in the order they were added -- also
+// when more for a time arrive while its window is partway down the wheel.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define STEPS 40000
+
+static uint32_t rand_state = 12345;
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state >> 8;
+}
+
+// Park the synth clock near ms without rendering our way there.
+static void set_clock_ms(uint64_t ms) {
+    amy_global.total_blocks = (uint32_t)((ms * AMY_SAMPLE_RATE) / (1000ULL * AMY_BLOCK_SIZE));
+}
+
+static struct delta *reference = NULL;
+static uint32_t serial = 0;
+static int scheduled = 0, played = 0, out_of_order = 0;
+
+static void schedule(uint32_t time) {
+    struct delta d = { 0 };
+    d.time = time;
+    d.data.i = serial++;
+    delta_sched_insert(delta_get(&d));
+    delta_list_insert(&reference, delta_get(&d));
+    scheduled++;
+}
+
+// Take what's due from both; count the deltas that don't match.
+static void take_due(void) {
+    uint32_t sysclock = amy_sysclock();
+    struct delta *d = delta_sched_take_due(sysclock);
+    while (reference && AMY_TIME_GEQ(sysclock, reference->time)) {
+        if (d == NULL || d->data.i != reference->data.i || d->time != reference->time)  out_of_order++;
+        if (d)  d = delta_release(d);
+        reference = delta_release(reference);
+        played++;
+    }
+    while (d) {  // more due from the scheduler than the list
+        out_of_order++;
+        d = delta_release(d);
+    }
+}
+
+// A time to schedule at, relative to the clock.
+static uint32_t random_time(void) {
+    uint32_t now = amy_sysclock();
+    switch (next_rand() % 8) {
+        case 0: return now - next_rand() % 2000;               // already due
+        case 1: return now;
+        case 2: case 3: return now + next_rand() % 200;        // the next few blocks
+        case 4: return now + next_rand() % 70000;              // a minute or so
+        case 5: return now + next_rand() % (1 << 20);          // minutes
+        case 6: return now + next_rand() % (1 << 27);          // past the wheel, into overflow
+        default: return now + 100 + (next_rand() % 4) * 37;   // a few times shared by many
+    }
+}
+
+static void test_matches_sorted_list(void) {
+    printf("the wheel plays what the sorted list did, in the same order\n");
+    uint64_t clock_ms = 1000;
+    set_clock_ms(clock_ms);
+    int jumps = 0, backwards = 0, rebases = 0;
+    bool wrapped = false;
+    for (int step = 0; step < STEPS; ++step) {
+        uint32_t r = next_rand() % 1000;
+        if (r < 400) {
+            schedule(random_time());
+        } else if (r < 410) {
+            // A burst at one time.
+            uint32_t t = random_time();
+            for (int i = 0; i < 20; ++i)  schedule(t);
+        } else if (r < 413) {
+            clock_ms += next_rand() % (1 << 26);  // hours
+            jumps++;
+        } else if (r < 414) {
+            clock_ms -= MIN(clock_ms, next_rand() % 100000);
+            backwards++;
+        } else if (r < 415 && step > STEPS / 2) {
+            // RESET_TIMEBASE: the scheduler rebases itself; the list gets
+            // what amy_fill_buffer used to do to the queue.
+            uint32_t old_sysclock = amy_sysclock();
+            delta_sched_rebase(old_sysclock);
+            for (struct delta *d = reference; d != NULL; d = d->next) {
+                if (AMY_TIME_GEQ(old_sysclock, d->time)) d->time = 0;
+                else d->time = d->time - old_sysclock;
+            }
+            clock_ms = 0;
+            rebases++;
+        } else if (r == 500 && !wrapped) {
+            clock_ms = (1ULL << 32) - 20000;  // 20 s before the rollover
+            wrapped = true;
+        } else {
+            clock_ms += AMY_BLOCK_SIZE * 1000 / AMY_SAMPLE_RATE + next_rand() % 4;
+        }
+        set_clock_ms(clock_ms);
+        take_due();
+    }
+    // Play out everything left.
+    for (int i = 0; i < 64 && reference; ++i) {
+        clock_ms += 1ULL << 26;
+        set_clock_ms(clock_ms);
+        take_due();
+    }
+    CHECK(out_of_order == 0 && reference == NULL,
+          "%d scheduled, %d played (%d jumps ahead, %d back, %d rebases, rollover %s): %d out of order",
+          scheduled, played, jumps, backwards, rebases, wrapped ? "crossed" : "not crossed", out_of_order);
+}
+
+static void test_same_time_plays_in_order(void) {
+    printf("deltas for the same time play in the order they were added\n");
+    set_clock_ms(5000);
+    uint32_t now = amy_sysclock();
+    // Interleave two times, one far enough out to start in a higher level.
+    uint32_t first = serial;
+    for (int i = 0; i < 100; ++i) {
+        schedule(now + 5000);
+        schedule(now + 20);
+    }
+    set_clock_ms(20000);
+    uint32_t sysclock = amy_sysclock();
+    struct delta *d = delta_sched_take_due(sysclock);
+    int in_order = 1, n = 0;
+    for (; d != NULL; ++n) {
+        uint32_t want = first + (n < 100 ? 2 * n + 1 : 2 * (n - 100));
+        if (d->data.i != want)  in_order = 0;
+        d = delta_release(d);
+    }
+    delta_release_list(reference);
+    reference = NULL;
+    CHECK(in_order && n == 200, "200 deltas at 2 times came out grouped by time, each in order added (%d out)", n);
+}
+
+static void test_added_while_cascading(void) {
+    printf("deltas added while their window moves down the wheel still play in order\n");
+    uint64_t clock_ms = 100000;
+    set_clock_ms(clock_ms);
+    uint32_t t = amy_sysclock() + 40000;
+    int was_played = played, was_out_of_order = out_of_order;
+    // More than the cascade ahead moves per block, so the windows are still
+    // on their way down as the same times keep arriving.
+    for (int i = 0; i < 500; ++i) {
+        schedule(t);
+        schedule(t - next_rand() % 1000);
+    }
+    int added = 1000;
+    while (reference) {
+        if (AMY_TIME_GEQ(t, amy_sysclock())) {
+            schedule(t);
+            schedule(t - next_rand() % 1000);
+            added += 2;
+        }
+        clock_ms += AMY_BLOCK_SIZE * 1000 / AMY_SAMPLE_RATE;
+        set_clock_ms(clock_ms);
+        take_due();
+    }
+    CHECK(out_of_order == was_out_of_order && played - was_played == added,
+          "%d played, %d out of order", played - was_played, out_of_order - was_out_of_order);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    // Start from an empty queue.
+    delta_sched_release_all();
+    test_matches_sorted_list();
+    test_same_time_plays_in_order();
+    test_added_while_cascading();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Tests the envelope cursor: compute_breakpoint_scale keeping each
+// envelope's segment, times, levels and curve constants from call to call
+// rather than rescanning the breakpoints every time.
+//
+// Two oscs get the same random envelopes -- every eg_type, zero-length
+// segments, negative levels -- and the same notes: note ons, note offs,
+// retriggers during attack and release, and breakpoint edits mid-note.  One
+// osc's cursor is marked stale before every call, so it rescans from the
+// breakpoints each time as the code did before the cursor; the other's
+// isn't.  Both are probed as hold_and_modify does (each set, at the start
+// and end of the block) and have to agree bit for bit on every block.  The
+// oscs are driven directly, without rendering, so nothing else calls
+// compute_breakpoint_scale between the probes.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define CURSOR_OSC 0
+#define RESCAN_OSC 1
+#define SCENARIOS 300
+#define SCENARIO_BLOCKS 400
+
+static uint32_t rand_state = 12345;
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state >> 8;
+}
+
+static uint32_t now(void) {
+    return amy_global.total_blocks * AMY_BLOCK_SIZE;
+}
+
+// The same random breakpoints in bp_set of both oscs.
+static void random_envelope(uint8_t bp_set) {
+    int n = 1 + next_rand() % 7;
+    uint8_t eg_type = (uint8_t[]){ ENVELOPE_NORMAL, ENVELOPE_LINEAR, ENVELOPE_DX7, ENVELOPE_TRUE_EXPONENTIAL }[next_rand() % 4];
+    for (int i = 0; i < DEFAULT_NUM_BREAKPOINTS; ++i) {
+        uint32_t t = (i % 3 == 2 && next_rand() % 4 == 0) ? 0 : next_rand() % (40 * AMY_BLOCK_SIZE);
+        float v = (next_rand() % 1000) / 400.0f - ((next_rand() % 8 == 0) ? 2.0f : 0.0f);
+        for (uint16_t osc = CURSOR_OSC; osc <= RESCAN_OSC; ++osc) {
+            synth[osc]->eg_type[bp_set] = eg_type;
+            if (i < n) {
+                synth[osc]->breakpoint_times[bp_set][i] = t;
+                synth[osc]->breakpoint_values[bp_set][i] = v;
+            } else {
+                AMY_UNSET(synth[osc]->breakpoint_times[bp_set][i]);
+                AMY_UNSET(synth[osc]->breakpoint_values[bp_set][i]);
+            }
+            osc_envelope_changed(synth[osc], bp_set);
+        }
+    }
+}
+
+static void note_on(void) {
+    for (uint16_t osc = CURSOR_OSC; osc <= RESCAN_OSC; ++osc) {
+        synth[osc]->note_on_clock = now();
+        AMY_UNSET(synth[osc]->note_off_clock);
+    }
+}
+
+static void note_off(void) {
+    for (uint16_t osc = CURSOR_OSC; osc <= RESCAN_OSC; ++osc) {
+        AMY_UNSET(synth[osc]->note_on_clock);
+        synth[osc]->note_off_clock = now();
+    }
+}
+
+// Probe both oscs' envelopes as hold_and_modify does.  Returns the number of
+// probes where they differ.
+static int probe(void) {
+    int bad = 0;
+    for (uint16_t offset = 0; offset <= AMY_BLOCK_SIZE; offset += AMY_BLOCK_SIZE)
+        for (uint8_t bp_set = 0; bp_set < MAX_BREAKPOINT_SETS; ++bp_set) {
+            SAMPLE cursor = compute_breakpoint_scale(CURSOR_OSC, bp_set, offset);
+            osc_envelope_changed(synth[RESCAN_OSC], bp_set);
+            SAMPLE rescan = compute_breakpoint_scale(RESCAN_OSC, bp_set, offset);
+            if (cursor != rescan || synth[CURSOR_OSC]->last_scale[bp_set] != synth[RESCAN_OSC]->last_scale[bp_set])
+                bad++;
+        }
+    return bad;
+}
+
+static void test_cursor_matches_rescan(void) {
+    printf("the cursor gives what rescanning every call does\n");
+    int bad = 0, bad_scenarios = 0, edits = 0, retriggers = 0;
+    for (int s = 0; s < SCENARIOS; ++s) {
+        for (uint8_t bp_set = 0; bp_set < MAX_BREAKPOINT_SETS; ++bp_set)  random_envelope(bp_set);
+        note_on();
+        int scenario_bad = 0;
+        uint32_t off_block = 20 + next_rand() % 200;
+        for (int b = 0; b < SCENARIO_BLOCKS; ++b) {
+            if (b == (int)off_block)  note_off();
+            uint32_t r = next_rand() % 100;
+            if (r == 0) {
+                note_on();  // retrigger, wherever the envelope is
+                retriggers++;
+            } else if (r == 1) {
+                random_envelope(next_rand() % MAX_BREAKPOINT_SETS);  // edit mid-note
+                edits++;
+            }
+            scenario_bad += probe();
+            amy_global.total_blocks++;
+        }
+        bad += scenario_bad;
+        if (scenario_bad)  bad_scenarios++;
+    }
+    CHECK(bad == 0, "%d scenarios (%d retriggers, %d edits mid-note): %d differ, %d probes",
+          SCENARIOS, retriggers, edits, bad_scenarios, bad);
+}
+
+static void test_breakpoints_read_at_crossings(void) {
+    printf("breakpoints are only read again at a segment crossing or an edit\n");
+    for (uint16_t osc = CURSOR_OSC; osc <= RESCAN_OSC; ++osc) {
+        synth[osc]->eg_type[0] = ENVELOPE_LINEAR;
+        synth[osc]->breakpoint_times[0][0] = AMY_BLOCK_SIZE;
+        synth[osc]->breakpoint_values[0][0] = 1.0f;
+        synth[osc]->breakpoint_times[0][1] = AMY_BLOCK_SIZE;
+        synth[osc]->breakpoint_values[0][1] = 0.5f;
+        synth[osc]->breakpoint_times[0][2] = AMY_BLOCK_SIZE;
+        synth[osc]->breakpoint_values[0][2] = 0.0f;
+        AMY_UNSET(synth[osc]->breakpoint_times[0][3]);
+        osc_envelope_changed(synth[osc], 0);
+    }
+    note_on();
+    for (int b = 0; b < 8; ++b) {
+        compute_breakpoint_scale(CURSOR_OSC, 0, 0);
+        amy_global.total_blocks++;
+    }
+    CHECK(compute_breakpoint_scale(CURSOR_OSC, 0, 0) == F2S(0.5f), "sustaining at 0.5");
+    // Changed behind the cursor's back, the sustain level isn't seen...
+    synth[CURSOR_OSC]->breakpoint_values[0][1] = 0.25f;
+    CHECK(compute_breakpoint_scale(CURSOR_OSC, 0, 0) == F2S(0.5f), "an unannounced edit isn't read");
+    // ...until the edit is announced.
+    osc_envelope_changed(synth[CURSOR_OSC], 0);
+    CHECK(compute_breakpoint_scale(CURSOR_OSC, 0, 0) == F2S(0.25f), "an announced edit is");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    // Allocate the two oscs, with no note, so rendering leaves them alone.
+    amy_add_message("v0w0");
+    amy_add_message("v1w0");
+    amy_simple_fill_buffer();
+    test_cursor_matches_rescan();
+    test_breakpoints_read_at_crossings();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
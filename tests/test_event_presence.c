@@ -0,0 +1,203 @@
+// Tests amy_event's presence bits (amy_clear_event_sparse, AMY_EVENT_SET):
+// an event that marks the groups of fields it sets has to make exactly the
+// deltas the same event does with every group looked at.
+//
+//   - Random events, as wire strings parsed into sparse events, make the
+//     deltas they make parsed into fully-cleared ones.
+//   - Random events through binary (decoded sparse) make the deltas the
+//     originals do.
+//   - A parsed note-on marks only the note and velocity groups.
+//   - A field assigned into a sparse event without marking it is not looked
+//     at -- that's the contract, so check it holds.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define SPRINT_LEN 4096
+
+static uint32_t rand_state = 1;
+static uint32_t rnd(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state >> 8;
+}
+static int coin(void) { return (rnd() & 7) == 0; }
+// Values that print exactly to 3 places, so the wire form is exact too.
+static float rnd_float(void) { return (float)((int)(rnd() % 20001) - 10000) / 8.0f; }
+
+#define MAYBE(FIELD, VAL) if (coin()) (FIELD) = (VAL)
+#define MAYBE_EACH(FIELD, LEN, VAL) for (int i = 0; i < (LEN); ++i) MAYBE(FIELD[i], VAL)
+
+// Everything that turns into osc or bus deltas.  Not the synth-layer fields,
+// patch_number or ticks, which load, store or schedule rather than make
+// deltas.
+static void random_event(amy_event *e) {
+    amy_clear_event(e);
+    MAYBE(e->osc, rnd() % AMY_OSCS);
+    MAYBE(e->wave, rnd() % WAVETABLE);
+    MAYBE(e->mode, rnd() % 4);
+    MAYBE(e->preset, rnd() % 100);
+    MAYBE(e->midi_note, rnd_float());
+    MAYBE_EACH(e->amp_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->freq_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->filter_freq_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->duty_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE_EACH(e->pan_coefs, NUM_COMBO_COEFS, rnd_float());
+    MAYBE(e->feedback, rnd_float());
+    MAYBE(e->velocity, rnd_float());
+    MAYBE(e->trigger_phase, rnd_float());
+    MAYBE(e->sample_offset, rnd() % AMY_BLOCK_SIZE);
+    MAYBE(e->fit_ticks, rnd_float());
+    MAYBE(e->fit_search, rnd() % 1000);
+    MAYBE(e->volume, rnd_float());
+    MAYBE(e->pitch_bend, rnd_float());
+    MAYBE(e->tempo, rnd_float());
+    MAYBE(e->latency_ms, rnd() % 1000);
+    MAYBE(e->ratio, rnd_float());
+    MAYBE(e->resonance, rnd_float());
+    MAYBE(e->portamento_ms, rnd() % 1000);
+    MAYBE(e->chained_osc, rnd() % AMY_OSCS);
+    MAYBE_EACH(e->mod_source, NUM_MOD_SOURCES, rnd() % AMY_OSCS);
+    MAYBE(e->algorithm, rnd() % 32);
+    MAYBE(e->filter_type, rnd() % 5);
+    MAYBE(e->dist_type, rnd() % 4);
+    MAYBE(e->dist_drive, rnd_float());
+    MAYBE(e->dist_bits, rnd() % 25);
+    MAYBE(e->dist_rate, rnd() % 48000);
+    MAYBE(e->dist_mix, rnd_float());
+    MAYBE(e->eq_l, rnd_float());
+    MAYBE(e->eq_m, rnd_float());
+    MAYBE(e->eq_h, rnd_float());
+    MAYBE_EACH(e->algo_source, MAX_ALGO_OPS, (int16_t)(rnd() % 200) - 100);
+    for (int s = 0; s < MAX_BREAKPOINT_SETS; ++s) {
+        if (!coin())  continue;
+        e->bp_is_set[s] = 1;
+        uint32_t *times = s ? e->eg1_times : e->eg0_times;
+        float *values = s ? e->eg1_values : e->eg0_values;
+        int n = rnd() % 5;  // what fits in a wire string's MAX_PARAM_LEN
+        for (int i = 0; i < n; ++i) {
+            times[i] = rnd() % 100000;
+            values[i] = rnd_float();
+        }
+    }
+    MAYBE_EACH(e->eg_type, MAX_BREAKPOINT_SETS, rnd() % 4);
+    MAYBE(e->note_source_channel, rnd() % 16);
+    MAYBE(e->reset_osc, rnd() % AMY_OSCS);
+    MAYBE(e->bus, rnd() % 2);
+    MAYBE(e->echo_level, rnd_float());
+    MAYBE(e->echo_delay_ms, rnd_float());
+    MAYBE(e->echo_feedback, rnd_float());
+    MAYBE(e->chorus_level, rnd_float());
+    MAYBE(e->chorus_lfo_freq, rnd_float());
+    MAYBE(e->reverb_level, rnd_float());
+    MAYBE(e->reverb_liveness, rnd_float());
+}
+
+// The deltas e makes, as a list of our own.
+static struct delta *deltas_of(amy_event *e) {
+    struct delta *list = NULL;
+    amy_event_to_deltas_queue(e, 0, /* oscs_per_voice= */ 0, &list);
+    return list;
+}
+
+static bool same_deltas(amy_event *a, amy_event *b) {
+    struct delta *la = deltas_of(a), *lb = deltas_of(b);
+    struct delta *da = la, *db = lb;
+    while (da && db && da->time == db->time && da->osc == db->osc
+           && da->param == db->param && da->data.i == db->data.i) {
+        da = da->next;
+        db = db->next;
+    }
+    bool same = (da == NULL && db == NULL && la != NULL);
+    amy_grab_lock();
+    delta_release_list(la);
+    delta_release_list(lb);
+    amy_release_lock();
+    return same;
+}
+
+static void test_parsed(void) {
+    printf("parsed sparse events make the deltas parsed full ones do\n");
+    int bad = 0;
+    for (int i = 0; i < 2000; ++i) {
+        amy_event r, full, sparse;
+        static char m[SPRINT_LEN];
+        random_event(&r);
+        sprint_event(&r, m, SPRINT_LEN, /* wirecode */ true);
+        amy_clear_event(&full);
+        amy_parse_message(m, &full);
+        amy_clear_event_sparse(&sparse);
+        amy_parse_message(m, &sparse);
+        if (!same_deltas(&full, &sparse)) {
+            if (bad++ < 3)  printf("       %s\n", m);
+        }
+    }
+    CHECK(bad == 0, "%d of 2000 random events differ", bad);
+}
+
+static void test_binary(void) {
+    printf("decoded binary events make the deltas the originals do\n");
+    int bad = 0;
+    for (int i = 0; i < 2000; ++i) {
+        amy_event e, d;
+        uint8_t buf[AMY_BINARY_EVENT_MAX_LEN];
+        random_event(&e);
+        size_t n = amy_event_to_binary(&e, buf, sizeof(buf));
+        if (n == 0 || amy_binary_to_event(buf, n, &d) != (int)n || !same_deltas(&e, &d))  bad++;
+    }
+    CHECK(bad == 0, "%d of 2000 random events differ", bad);
+}
+
+static void test_marks(void) {
+    printf("what gets marked\n");
+    amy_event e;
+    char m[] = "v0n60l1Z";
+    amy_clear_event_sparse(&e);
+    amy_parse_message(m, &e);
+    CHECK(e.present == (AMY_EV_NOTE | AMY_EV_VELOCITY), "a note-on marks note and velocity (0x%x)",
+          (unsigned)e.present);
+    amy_clear_event(&e);
+    CHECK(e.present == AMY_EV_ALL, "amy_clear_event leaves every group to be looked at");
+
+    amy_clear_event_sparse(&e);
+    e.osc = 0;
+    e.wave = SAW_DOWN;
+    AMY_EVENT_SET(&e, midi_note, 60);
+    struct delta *list = deltas_of(&e);
+    int waves = 0, notes = 0;
+    for (struct delta *d = list; d; d = d->next) {
+        waves += (d->param == WAVE);
+        notes += (d->param == MIDI_NOTE);
+    }
+    amy_grab_lock();
+    delta_release_list(list);
+    amy_release_lock();
+    CHECK(waves == 0 && notes == 1, "an unmarked field of a sparse event isn't looked at");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_parsed();
+    test_binary();
+    test_marks();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
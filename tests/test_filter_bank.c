@@ -0,0 +1,222 @@
+// Tests that the cross-voice filter bank -- oscs' biquads run as lanes of
+// filter_lanes (filter_simd.h) -- filters exactly as filter_process does.
+//
+// Oscs get random filter types, cutoffs, resonances, filter state and input
+// blocks, and each is filtered once alone through filter_process and once
+// as a lane, at every vector width the CPU supports.  The block, the filter
+// state and the returned max all have to match bit for bit, since the
+// python tests hold rendered audio to tests/ref.  Then whole renders --
+// Juno voices (LPF24) and plain oscs through each biquad filter type, next
+// to filtered oscs that can't join the bank -- have to come out the same at
+// every width as with no vector kernels at all.  test_filter_bank-float
+// holds the float build's lanes to the same.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define TRIALS 200
+#define FILTER_STATE 8  // 2 * FILT_NUM_DELAYS in filters.c
+
+static uint32_t rand_state = 12345;
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state;
+}
+// Uniform in [-range, range).
+static SAMPLE rand_sample(SAMPLE range) {
+#ifdef AMY_USE_FIXEDPOINT
+    return (SAMPLE)((int64_t)(next_rand() % (2 * (uint32_t)range)) - range);
+#else
+    return range * ((float)next_rand() / 2147483648.0f - 1.0f);
+#endif
+}
+
+typedef struct {
+    SAMPLE block[AMY_BLOCK_SIZE];
+    SAMPLE state[FILTER_STATE];
+    SAMPLE max_val;
+} trial_t;
+
+static void make_trial(trial_t *t, int n) {
+    // Mostly ordinary levels, some near-silent blocks, and every so often a
+    // silent block into a silent filter, which filter_process skips.
+    SAMPLE range = (n % 3 == 0) ? F2S(0.001f) : F2S(1.0f);
+    bool silent = (n % 17 == 0);
+    t->max_val = 0;
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) {
+        t->block[i] = silent ? 0 : rand_sample(range);
+        if (S_ABS(t->block[i]) > t->max_val)  t->max_val = S_ABS(t->block[i]);
+    }
+    for (int i = 0; i < FILTER_STATE; ++i)
+        t->state[i] = silent ? 0 : rand_sample(F2S(0.5f));
+}
+
+// Count trials of one filter type where filtering a lane of the given width
+// differs from filtering alone.
+static int mismatches(int filter_type, uint8_t level) {
+    static trial_t t[RENDER_LUT_MAX_LANES];
+    static SAMPLE want[RENDER_LUT_MAX_LANES][AMY_BLOCK_SIZE];
+    static SAMPLE want_state[RENDER_LUT_MAX_LANES][FILTER_STATE];
+    static filter_lane_t lanes[FILTER_MAX_LANES];
+    SAMPLE want_max[RENDER_LUT_MAX_LANES], got_max[FILTER_MAX_LANES];
+    char m[64];
+    int bad = 0;
+    rand_state = 12345;
+    render_lut_simd = level;
+    uint8_t width = filter_lane_width();
+    for (int n = 0; n < TRIALS; ++n) {
+        // A short last group leaves spare lanes.
+        uint8_t used = (n % 4 == 3) ? 1 + n % width : width;
+        for (int k = 0; k < used; ++k) {
+            snprintf(m, sizeof(m), "v%dw0G%dF%dR%.2f", k, filter_type, 40 + next_rand() % 12000,
+                     0.5f + (next_rand() % 100) / 10.0f);
+            amy_add_message(m);
+        }
+        amy_simple_fill_buffer();
+        for (int k = 0; k < used; ++k) {
+            make_trial(&t[k], n * width + k);
+            memcpy(want[k], t[k].block, sizeof(want[k]));
+            memcpy(synth[k]->filter_delay, t[k].state, sizeof(t[k].state));
+            want_max[k] = filter_process(want[k], k, t[k].max_val);
+            memcpy(want_state[k], synth[k]->filter_delay, sizeof(want_state[k]));
+        }
+        uint8_t kind = FILTER_LANE_NONE;
+        int lanes_used = 0;
+        for (int k = 0; k < used; ++k) {
+            memcpy(synth[k]->filter_delay, t[k].state, sizeof(t[k].state));
+            uint8_t lane_kind = osc_filter_lane(k, t[k].block, t[k].max_val, &lanes[lanes_used]);
+            if (lane_kind == FILTER_LANE_NONE) {
+                // filter_process left it alone too; check that it said so.
+                got_max[k] = 0;
+                continue;
+            }
+            kind = lane_kind;
+            lanes_used++;
+        }
+        SAMPLE lane_max[FILTER_MAX_LANES];
+        if (lanes_used)  filter_lanes(kind, lanes, lanes_used, lane_max);
+        for (int k = 0, lane = 0; k < used; ++k) {
+            if (lane < lanes_used && lanes[lane].block == t[k].block)  got_max[k] = lane_max[lane++];
+            if (got_max[k] != want_max[k] || memcmp(want[k], t[k].block, sizeof(want[k])) != 0
+                || memcmp(want_state[k], synth[k]->filter_delay, sizeof(want_state[k])) != 0)
+                bad++;
+        }
+    }
+    return bad;
+}
+
+#define RENDER_BLOCKS 48
+
+static int16_t rendered[RENDER_BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+
+// Two Juno patches' worth of LPF24 voices, plain oscs through each biquad
+// filter type, and filtered oscs that render alone: a filtered osc feeding
+// a chain and a phaser.  Then releases, so filters ring out and go quiet.
+static void play_filtered(bool release) {
+    char m[128];
+    if (release) {
+        amy_add_message("i1l0");
+        amy_add_message("i2l0");
+        for (int osc = 0; osc < 48; osc += 2) {
+            snprintf(m, sizeof(m), "v%dl0", osc);
+            amy_add_message(m);
+        }
+        return;
+    }
+    amy_add_message("i1iv16K0");
+    amy_add_message("i2iv16K1");
+    for (int n = 0; n < 16; ++n) {
+        snprintf(m, sizeof(m), "i%dn%dl0.3", 1 + n % 2, 36 + 3 * n);
+        amy_add_message(m);
+    }
+    static const int types[] = { FILTER_LPF, FILTER_BPF, FILTER_HPF, FILTER_LPF24, FILTER_NOTCH };
+    for (int osc = 0; osc < 48; ++osc) {
+        snprintf(m, sizeof(m), "v%dw%df%dG%dF%dR%.2fP%.2fl0.1", osc, (osc & 1) ? SAW_DOWN : PULSE,
+                 80 + 29 * osc, types[osc % 5], 200 + 150 * osc, 0.7f + (osc % 6) * 0.8f, (osc % 11) / 10.0f);
+        amy_add_message(m);
+    }
+    amy_add_message("v48w1f220G1F800c49l0.2");
+    amy_add_message("v49w0f330");
+    amy_add_message("v50w1f110G6F1000R4l0.2");
+}
+
+static void render_at(uint8_t level) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = 300;
+    amy_start(c);
+    render_lut_simd = level;
+    play_filtered(false);
+    for (int b = 0; b < RENDER_BLOCKS; ++b) {
+        if (b == RENDER_BLOCKS / 3)  play_filtered(true);
+        int16_t *block = amy_simple_fill_buffer();
+        memcpy(rendered[b], block, sizeof(rendered[b]));
+    }
+    amy_stop();
+}
+
+static void test_banked_render(uint8_t best) {
+    static int16_t reference[RENDER_BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+    render_at(RENDER_LUT_SCALAR);
+    memcpy(reference, rendered, sizeof(reference));
+    int nonzero = 0;
+    for (int b = 0; b < RENDER_BLOCKS; ++b)
+        for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)
+            if (reference[b][i] != 0)  nonzero++;
+    CHECK(nonzero > 1000, "unbanked render is not silent (%d nonzero samples)", nonzero);
+    for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+        render_at(level);
+        int first_diff = -1;
+        for (int b = 0; b < RENDER_BLOCKS && first_diff < 0; ++b)
+            if (memcmp(reference[b], rendered[b], sizeof(rendered[b])) != 0)  first_diff = b;
+        CHECK(first_diff < 0, "%d-lane banked render is bit-identical over %d blocks (first differing block %d)",
+              level == RENDER_LUT_SIMD128 ? 4 : 8, RENDER_BLOCKS, first_diff);
+    }
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    if (best == RENDER_LUT_SCALAR) {
+        printf("no filter bank on this CPU\n");
+        amy_stop();
+        return 0;
+    }
+    static const struct { int type; const char *name; } types[] = {
+        { FILTER_LPF, "LPF" }, { FILTER_BPF, "BPF" }, { FILTER_HPF, "HPF" },
+        { FILTER_LPF24, "LPF24" }, { FILTER_NOTCH, "notch" },
+    };
+    for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+        render_lut_simd = level;
+        printf("%d-lane filters\n", filter_lane_width());
+        for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+            int bad = mismatches(types[i].type, level);
+            CHECK(bad == 0, "%s lanes match filter_process (%d of %d trials differ)", types[i].name, bad, TRIALS);
+        }
+    }
+    render_lut_simd = best;
+    amy_stop();
+
+    printf("banked filters render as they do alone\n");
+    test_banked_render(best);
+
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
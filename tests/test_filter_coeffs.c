@@ -0,0 +1,192 @@
+// Tests the per-osc biquad coefficient cache in filters.c, and, built as
+// tests/test_filter_coeffs-table (-DAMY_FILTER_COEFF_TABLE), the precomputed
+// (cutoff, Q) coefficient table.
+//
+// filter_process keeps each osc's last design and reuses it while the
+// filter's type, cutoff and resonance hold still.  A steady filter mustn't
+// be redesigned, moving any of the three must redesign it, a fresh design
+// must be exactly what the dsps_biquad_gen_ functions make, and a reset must
+// forget it.  With the table, fresh designs come from interpolating between
+// grid points instead, so they're held to the exact designs' frequency
+// response across the table rather than bit for bit.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <complex.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+// The designers are internal to filters.c.
+extern int8_t dsps_biquad_gen_hpf_f32(SAMPLE *coeffs, float f, float qFactor);
+extern int8_t dsps_biquad_gen_bpf_f32(SAMPLE *coeffs, float f, float qFactor);
+extern int8_t dsps_biquad_gen_notch_f32(SAMPLE *coeffs, float f, float qFactor);
+
+static SAMPLE block[AMY_BLOCK_SIZE];
+
+// Filter one block of noise, so filter_process doesn't skip it as silent.
+static void filter_block(uint16_t osc) {
+    static uint32_t rand_state = 12345;
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) {
+        rand_state = rand_state * 1664525u + 1013904223u;
+        block[i] = F2S(0.1f * ((int32_t)rand_state / 2147483648.0f));
+    }
+    filter_process(block, osc, F2S(0.1f));
+}
+
+// The exact design filter_process would make without the cache or table.
+static void exact_design(uint8_t filter_type, float logfreq, float q, SAMPLE *coeffs) {
+    float ratio = freq_of_logfreq(logfreq) / (float)AMY_SAMPLE_RATE;
+    switch (filter_type) {
+        case FILTER_LPF: case FILTER_LPF24: dsps_biquad_gen_lpf_f32(coeffs, ratio, q); break;
+        case FILTER_BPF: dsps_biquad_gen_bpf_f32(coeffs, ratio, q); break;
+        case FILTER_HPF: dsps_biquad_gen_hpf_f32(coeffs, ratio, q); break;
+        default: dsps_biquad_gen_notch_f32(coeffs, ratio, q); break;
+    }
+}
+
+// Redesign osc's filter for these inputs and return the design.
+static const SAMPLE *design(uint16_t osc, uint8_t filter_type, float logfreq, float q) {
+    synth[osc]->filter_type = filter_type;
+    msynth[osc]->filter_logfreq = logfreq;
+    msynth[osc]->resonance = q;
+    filter_block(osc);
+    return synth[osc]->filter_coeffs;
+}
+
+#ifdef AMY_FILTER_COEFF_TABLE
+// |H| in dB at ratio (a fraction of the sample rate).  The numerator's sign
+// convention differs between the designers, which |H| doesn't see.
+static double response_db(const SAMPLE *coeffs, double ratio) {
+    double complex z1 = cexp(-I * 2 * M_PI * ratio), z2 = z1 * z1;
+    double complex num = S2F(coeffs[0]) + S2F(coeffs[1]) * z1 + S2F(coeffs[2]) * z2;
+    double complex den = 1.0 + S2F(coeffs[3]) * z1 + S2F(coeffs[4]) * z2;
+    return 20 * log10(cabs(num) / cabs(den) + 1e-9);
+}
+#endif
+
+static void test_steady_filter_is_kept(void) {
+    printf("a steady filter keeps its design\n");
+    amy_add_message("v0w1f220G1F1000R2l1");
+    for (int b = 0; b < 4; ++b)  amy_simple_fill_buffer();
+    CHECK(synth[0]->filter_coeffs_type == FILTER_LPF, "designed while playing");
+    // Mark the kept design, so a redesign would show.
+    SAMPLE kept = synth[0]->filter_coeffs[0];
+    synth[0]->filter_coeffs[0] = kept + 1;
+    filter_block(0);
+    CHECK(synth[0]->filter_coeffs[0] == kept + 1, "not redesigned for an unchanged filter");
+    synth[0]->filter_coeffs[0] = kept;
+}
+
+static void test_moved_filter_is_redesigned(void) {
+    printf("moving the type, cutoff or resonance redesigns it\n");
+    static const struct { uint8_t type; const char *name; } types[] = {
+        { FILTER_LPF, "LPF" }, { FILTER_LPF24, "LPF24" }, { FILTER_BPF, "BPF" },
+        { FILTER_HPF, "HPF" }, { FILTER_NOTCH, "notch" },
+    };
+    SAMPLE want[5];
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+        uint8_t t = types[i].type;
+        int exact = 1;
+        const SAMPLE *got = design(0, t, 1.0f, 2.0f);
+        exact_design(t, 1.0f, 2.0f, want);
+        exact &= (memcmp(got, want, sizeof(want)) == 0);
+        got = design(0, t, 1.5f, 2.0f);
+        exact_design(t, 1.5f, 2.0f, want);
+        exact &= (memcmp(got, want, sizeof(want)) == 0);
+        got = design(0, t, 1.5f, 5.0f);
+        exact_design(t, 1.5f, 5.0f, want);
+        exact &= (memcmp(got, want, sizeof(want)) == 0);
+#ifdef AMY_FILTER_COEFF_TABLE
+        // Grid points and Qs off the table are still designed exactly.
+        CHECK(exact == 0, "%s redesigned from the table", types[i].name);
+        got = design(0, t, 1.5f, 40.0f);
+        exact_design(t, 1.5f, 40.0f, want);
+        CHECK(memcmp(got, want, sizeof(want)) == 0, "%s Q past the table designed exactly", types[i].name);
+#else
+        CHECK(exact, "%s redesigned, exactly as dsps_biquad_gen_ makes it", types[i].name);
+#endif
+    }
+    memcpy(want, design(0, FILTER_HPF, 1.5f, 5.0f), sizeof(want));
+    synth[0]->filter_type = FILTER_BPF;
+    filter_block(0);
+    CHECK(synth[0]->filter_coeffs_type == FILTER_BPF && memcmp(synth[0]->filter_coeffs, want, sizeof(want)) != 0,
+          "a new filter_type alone redesigns it");
+}
+
+static void test_reset_forgets_design(void) {
+    printf("a reset forgets the design\n");
+    amy_reset_oscs();
+    amy_add_message("v0w1f220");
+    amy_simple_fill_buffer();
+    CHECK(synth[0]->filter_coeffs_type == FILTER_NONE, "no design kept after a reset");
+}
+
+#ifdef AMY_FILTER_COEFF_TABLE
+#define TABLE_TRIALS 2000
+
+// The worst of it is below 100 Hz, where the exact designs are themselves
+// a few dB from ideal (cos2pi's table error against a tiny 1 - cos w0), and
+// vary more between grid points than the interpolation can follow.
+
+static void test_table_matches_design(void) {
+    printf("table designs respond like exact ones\n");
+    static const struct { uint8_t type; const char *name; } types[] = {
+        { FILTER_LPF, "LPF" }, { FILTER_BPF, "BPF" }, { FILTER_HPF, "HPF" }, { FILTER_NOTCH, "notch" },
+    };
+    uint32_t rand_state = 12345;
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+        double worst = 0;
+        float worst_logfreq = 0, worst_q = 0;
+        for (int n = 0; n < TABLE_TRIALS; ++n) {
+            rand_state = rand_state * 1664525u + 1013904223u;
+            float logfreq = MIN_FILTER_LOGFREQ + (rand_state >> 8) / (float)(1 << 24) * (5.0f - MIN_FILTER_LOGFREQ);
+            rand_state = rand_state * 1664525u + 1013904223u;
+            float q = exp2f(-1.0f + (rand_state >> 8) / (float)(1 << 24) * 4.0f);
+            SAMPLE want[5];
+            exact_design(types[i].type, logfreq, q, want);
+            const SAMPLE *got = design(0, types[i].type, logfreq, q);
+            float ratio = freq_of_logfreq(logfreq) / (float)AMY_SAMPLE_RATE;
+            // At the cutoff and an octave either side, skipping the notch's
+            // own center, where both are deep in the stop band.
+            for (int octave = -1; octave <= 1; ++octave) {
+                if (types[i].type == FILTER_NOTCH && octave == 0)  continue;
+                double r = ratio * exp2(octave);
+                if (r >= 0.45)  continue;
+                double err = fabs(response_db(got, r) - response_db(want, r));
+                if (err > worst) { worst = err; worst_logfreq = logfreq; worst_q = q; }
+            }
+        }
+        CHECK(worst < 1.0, "%s within %.3f dB of exact (worst at logfreq %.2f Q %.2f)",
+              types[i].name, worst, worst_logfreq, worst_q);
+    }
+}
+#endif
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_steady_filter_is_kept();
+    test_moved_filter_is_redesigned();
+    test_reset_forgets_design();
+#ifdef AMY_FILTER_COEFF_TABLE
+    test_table_matches_design();
+#endif
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
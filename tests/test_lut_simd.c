@@ -0,0 +1,241 @@
+// Tests that the vectorized render_lut kernels (render_lut_simd.h), and the
+// cross-voice batching that renders plain oscs through them in lockstep,
+// produce exactly what the scalar kernels do.
+//
+// Every table of the sine, saw and triangle lutsets is rendered through
+// render_lut, render_lut_fm, render_lut_cub and render_lut_256 with random
+// phases, steps, amp ramps, FM input and existing buffer contents, once per
+// vector width the CPU supports.  The block, the returned phase and the max
+// value all have to match the scalar result bit for bit, since the python
+// tests hold rendered audio to tests/ref.  Then whole renders -- batched
+// oscs with pans, envelopes and releases, next to voices that can't batch
+// -- have to come out the same at every width.
+//
+// Built against the float library as test_lut_simd-float, the kernels still
+// have to match the float scalar ones bit for bit.  A whole render may be a
+// last-bit rounding off, within 1 LSB of int16: a batch mixes its oscs in
+// at a different point, and float sums depend on their order.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define TRIALS 200
+
+// The kernels and tables are internal to oscillators.c.
+extern PHASOR render_lut(SAMPLE* buf, PHASOR phase, PHASOR step, SAMPLE incoming_amp, SAMPLE ending_amp,
+                         const LUT* lut, SAMPLE* pmax_value);
+extern PHASOR render_lut_fm(SAMPLE* buf, PHASOR phase, PHASOR step, SAMPLE incoming_amp, SAMPLE ending_amp,
+                            const LUT* lut, SAMPLE* mod, SAMPLE* pmax_value);
+extern PHASOR render_lut_cub(SAMPLE* buf, PHASOR phase, PHASOR step, SAMPLE incoming_amp, SAMPLE ending_amp,
+                             const LUT* lut, SAMPLE* pmax_value);
+extern PHASOR render_lut_256(SAMPLE* buf, PHASOR phase, PHASOR step, SAMPLE incoming_amp, SAMPLE ending_amp,
+                             const LUT* lut, SAMPLE* pmax_value);
+extern LUT sine_fxpt_lutset[], saw_fxpt_lutset[], triangle_fxpt_lutset[];
+
+enum kernel { K_LINEAR, K_FM, K_CUBIC, K_SINE256 };
+static const char *kernel_names[] = { "render_lut", "render_lut_fm", "render_lut_cub", "render_lut_256" };
+
+static uint32_t rand_state = 12345;
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1664525u + 1013904223u;
+    return rand_state;
+}
+// Uniform in [-range, range).
+static SAMPLE rand_sample(SAMPLE range) {
+#ifdef AMY_USE_FIXEDPOINT
+    return (SAMPLE)((int64_t)(next_rand() % (2 * (uint32_t)range)) - range);
+#else
+    return range * ((float)next_rand() / 2147483648.0f - 1.0f);
+#endif
+}
+
+typedef struct {
+    PHASOR phase, step;
+    SAMPLE incoming_amp, ending_amp;
+    SAMPLE buf[AMY_BLOCK_SIZE];
+    SAMPLE mod[AMY_BLOCK_SIZE];
+} trial_t;
+
+static void make_trial(trial_t *t, int n) {
+    // Phases anywhere, including negative ones as render_lut_256 hands back,
+    // and steps from sub-audio up to past Nyquist.
+#ifdef AMY_USE_FIXEDPOINT
+    t->phase = (PHASOR)next_rand();
+    t->step = (PHASOR)(next_rand() >> (1 + n % 12));
+#else
+    t->phase = rand_sample(1.0f);
+    t->step = (float)(next_rand() >> (1 + n % 12)) / 2147483648.0f;
+#endif
+    t->incoming_amp = rand_sample(F2S(4.0f));
+    t->ending_amp = (n % 5 == 0) ? t->incoming_amp : rand_sample(F2S(4.0f));
+    SAMPLE buf_range = (n % 3 == 0) ? F2S(0.001f) : F2S(2.0f);
+    for (int i = 0; i < AMY_BLOCK_SIZE; ++i) {
+        t->buf[i] = rand_sample(buf_range);
+        t->mod[i] = rand_sample(F2S(4.0f));
+    }
+}
+
+static PHASOR run_kernel(enum kernel k, const trial_t *t, const LUT *lut, SAMPLE *buf, SAMPLE *max_value) {
+    static SAMPLE mod[AMY_BLOCK_SIZE];
+    memcpy(buf, t->buf, sizeof(t->buf));
+    memcpy(mod, t->mod, sizeof(t->mod));
+    switch (k) {
+        case K_LINEAR: return render_lut(buf, t->phase, t->step, t->incoming_amp, t->ending_amp, lut, max_value);
+        case K_FM: return render_lut_fm(buf, t->phase, t->step, t->incoming_amp, t->ending_amp, lut, mod, max_value);
+        case K_CUBIC: return render_lut_cub(buf, t->phase, t->step, t->incoming_amp, t->ending_amp, lut, max_value);
+        default: return render_lut_256(buf, t->phase, t->step, t->incoming_amp, t->ending_amp, lut, max_value);
+    }
+}
+
+// Count trials where the given SIMD level differs from scalar on this lut.
+static int mismatches(enum kernel k, uint8_t level, const LUT *lut) {
+    static trial_t t;
+    static SAMPLE want[AMY_BLOCK_SIZE], got[AMY_BLOCK_SIZE];
+    int bad = 0;
+    rand_state = 12345;
+    for (int n = 0; n < TRIALS; ++n) {
+        make_trial(&t, n);
+        SAMPLE want_max = -1, got_max = -1;
+        render_lut_simd = RENDER_LUT_SCALAR;
+        PHASOR want_phase = run_kernel(k, &t, lut, want, &want_max);
+        render_lut_simd = level;
+        PHASOR got_phase = run_kernel(k, &t, lut, got, &got_max);
+        if (want_phase != got_phase || want_max != got_max || memcmp(want, got, sizeof(want)) != 0)
+            bad++;
+    }
+    return bad;
+}
+
+static void test_lutset(enum kernel k, uint8_t level, const char *set_name, const LUT *lutset) {
+    int luts = 0, bad_luts = 0;
+    for (int i = 0; lutset[i].table_size > 0; ++i) {
+        luts++;
+        int bad = mismatches(k, level, &lutset[i]);
+        if (bad) {
+            printf("       %s %d-entry table: %d of %d trials differ\n", set_name, lutset[i].table_size, bad, TRIALS);
+            bad_luts++;
+        }
+    }
+    CHECK(bad_luts == 0, "%s %s: %d tables match scalar", kernel_names[k], set_name, luts);
+}
+
+#define RENDER_BLOCKS 48
+
+static int16_t rendered[RENDER_BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+
+// Plain oscs of every batchable wave across the range, some on bus 1, with
+// pans, envelopes and releases, plus pulses and filtered oscs that render
+// alone, and Juno voices from a patch.
+static void play_mixed(bool release) {
+    char m[128];
+    if (release) {
+        for (int osc = 0; osc < 120; osc += 3) {
+            snprintf(m, sizeof(m), "v%dl0", osc);
+            amy_add_message(m);
+        }
+        amy_add_message("i1l0");
+        return;
+    }
+    for (int osc = 0; osc < 120; ++osc) {
+        int wave = (osc % 6 == 5) ? PULSE : (int[]){SINE, SAW_DOWN, SAW_UP, TRIANGLE, SINE}[osc % 5];
+        snprintf(m, sizeof(m), "v%dw%df%dP%.2fA%d,1,200,0.5,%d,0l%.2f%s", osc, wave, 60 + 37 * osc,
+                 (osc % 11) / 10.0f, 5 + osc % 7, 20 + osc % 50, 0.05f + (osc % 4) / 20.0f,
+                 (osc % 13 == 0) ? "G1F2000" : "");
+        amy_add_message(m);
+    }
+    amy_add_message("v40b1");
+    amy_add_message("v41b1");
+    amy_add_message("i1iv4K1");
+    amy_add_message("i1n48l0.5");
+    amy_add_message("i1n55l0.5");
+}
+
+static void render_at(uint8_t level) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.max_oscs = 300;
+    amy_start(c);
+    render_lut_simd = level;
+    play_mixed(false);
+    for (int b = 0; b < RENDER_BLOCKS; ++b) {
+        if (b == RENDER_BLOCKS / 3)  play_mixed(true);
+        int16_t *block = amy_simple_fill_buffer();
+        memcpy(rendered[b], block, sizeof(rendered[b]));
+    }
+    amy_stop();
+}
+
+static void test_batched_render(uint8_t best) {
+    static int16_t reference[RENDER_BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+    render_at(RENDER_LUT_SCALAR);
+    memcpy(reference, rendered, sizeof(reference));
+    int nonzero = 0;
+    for (int b = 0; b < RENDER_BLOCKS; ++b)
+        for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)
+            if (reference[b][i] != 0)  nonzero++;
+    CHECK(nonzero > 1000, "scalar render is not silent (%d nonzero samples)", nonzero);
+    for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+        render_at(level);
+#ifdef AMY_USE_FIXEDPOINT
+        int first_diff = -1;
+        for (int b = 0; b < RENDER_BLOCKS && first_diff < 0; ++b)
+            if (memcmp(reference[b], rendered[b], sizeof(rendered[b])) != 0)  first_diff = b;
+        CHECK(first_diff < 0, "%d-bit batched render is bit-identical over %d blocks (first differing block %d)",
+              level == RENDER_LUT_SIMD128 ? 128 : 256, RENDER_BLOCKS, first_diff);
+#else
+        // A batch is mixed in when it fills, not at each osc's turn, and
+        // float addition rounds differently in another order.
+        int max_diff = 0, diffs = 0;
+        for (int b = 0; b < RENDER_BLOCKS; ++b)
+            for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i) {
+                int diff = abs(reference[b][i] - rendered[b][i]);
+                if (diff > max_diff)  max_diff = diff;
+                diffs += (diff != 0);
+            }
+        CHECK(max_diff <= 1, "%d-bit batched render is within 1 LSB over %d blocks (%d samples differ, by up to %d)",
+              level == RENDER_LUT_SIMD128 ? 128 : 256, RENDER_BLOCKS, diffs, max_diff);
+#endif
+    }
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    printf("widest render_lut kernels on this CPU: %d-bit\n", best == RENDER_LUT_SCALAR ? 32 : best == RENDER_LUT_SIMD128 ? 128 : 256);
+    for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+        printf("%d-bit kernels\n", level == RENDER_LUT_SIMD128 ? 128 : 256);
+        for (enum kernel k = K_LINEAR; k <= K_CUBIC; ++k) {
+            test_lutset(k, level, "saw", saw_fxpt_lutset);
+            test_lutset(k, level, "triangle", triangle_fxpt_lutset);
+        }
+        test_lutset(K_FM, level, "sine", sine_fxpt_lutset);
+        int bad = mismatches(K_SINE256, level, &sine_fxpt_lutset[0]);
+        CHECK(bad == 0, "render_lut_256 matches scalar (%d of %d trials differ)", bad, TRIALS);
+    }
+    render_lut_simd = best;
+    amy_stop();
+
+    printf("batched oscs render as they do alone\n");
+    test_batched_render(best);
+
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Tests the osc arena: osc state allocated from one block made at amy_start
+// rather than a heap call per osc.
+//
+// Making, growing and freeing oscs happens in play_delta, on the render
+// thread, so none of it should reach the heap in normal use: every osc at
+// the default breakpoint capacity has to fit, grown oscs and PCM fit state
+// have to come from the arena's spare room, freed blocks have to be reused,
+// and a reset has to hand the whole arena back.  Past a full arena, blocks
+// fall back to the heap, and have to go back there when freed.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define MAX_OSCS 64
+
+static amy_osc_arena_stats_t stats(void) {
+    amy_osc_arena_stats_t s;
+    amy_get_osc_arena_stats(&s);
+    return s;
+}
+
+static void send(const char *m) {
+    amy_add_message((char *)m);
+    amy_simple_fill_buffer();
+}
+
+static void test_default_oscs_fit(void) {
+    printf("every osc at the default capacity fits in the arena\n");
+    amy_osc_arena_stats_t s = stats();
+    CHECK(s.arena_bytes > 0, "arena allocated (%u bytes)", (unsigned)s.arena_bytes);
+    char m[32];
+    for (int osc = 0; osc < MAX_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw0f%dl0.01", osc, 100 + osc);
+        send(m);
+    }
+    s = stats();
+    CHECK(s.oscs >= MAX_OSCS, "%u oscs allocated", (unsigned)s.oscs);
+    CHECK(s.heap_blocks == 0, "none from the heap");
+    CHECK(amy_get_osc_arena_occupancy() > 0.5f && amy_get_osc_arena_occupancy() <= 1.0f,
+          "occupancy %.2f", amy_get_osc_arena_occupancy());
+}
+
+static void test_grow_and_fit_state(void) {
+    printf("grown oscs and fit state come from the spare room\n");
+    amy_osc_arena_stats_t before = stats();
+    // 12 breakpoints is more than the default 8, so osc 5 moves to a bigger block.
+    send("v5A10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,200,0");
+    send("v6w7p0pF0l1");
+    amy_osc_arena_stats_t s = stats();
+    CHECK(synth[5]->max_num_breakpoints[0] > DEFAULT_NUM_BREAKPOINTS, "osc 5 grew");
+    CHECK(synth[6]->stretch != NULL, "osc 6 has fit state");
+    CHECK(s.oscs == before.oscs, "still %u oscs", (unsigned)s.oscs);
+    CHECK(s.used_bytes > before.used_bytes, "using more of the arena (%u -> %u bytes)",
+          (unsigned)before.used_bytes, (unsigned)s.used_bytes);
+    CHECK(s.heap_blocks == 0, "none from the heap");
+    // A freed block goes on its class's free list, so freeing and remaking
+    // an osc doesn't carve any more of the arena.
+    uint32_t carved = s.carved_bytes;
+    free_osc(10);
+    send("v10w0f300l0.01");
+    CHECK(stats().carved_bytes == carved, "a remade osc reuses the freed block");
+}
+
+static void test_reset_empties_it(void) {
+    printf("a reset hands the whole arena back\n");
+    amy_reset_oscs();
+    amy_osc_arena_stats_t s = stats();
+    CHECK(s.used_bytes == 0 && s.oscs == 0, "nothing in use (%u bytes, %u oscs)",
+          (unsigned)s.used_bytes, (unsigned)s.oscs);
+    CHECK(s.carved_bytes == 0, "and carving starts again from the top");
+}
+
+static void test_overflow_uses_heap(void) {
+    printf("past a full arena, blocks come from (and go back to) the heap\n");
+    char m[400];
+    // Every osc at the biggest capacity, in both envelopes, is far past the
+    // spare room.
+    char bps[160] = "";
+    for (int bp = 0; bp < MAX_BREAKPOINTS; ++bp)
+        snprintf(bps + strlen(bps), sizeof(bps) - strlen(bps), "%s10,%d", bp ? "," : "", bp & 1);
+    for (int osc = 0; osc < MAX_OSCS; ++osc) {
+        snprintf(m, sizeof(m), "v%dw0f%dl0.01A%sB%s", osc, 100 + osc, bps, bps);
+        send(m);
+    }
+    amy_osc_arena_stats_t s = stats();
+    int all_there = 1;
+    for (int osc = 0; osc < MAX_OSCS; ++osc)
+        if (synth[osc] == NULL || synth[osc]->max_num_breakpoints[0] != MAX_BREAKPOINTS
+            || synth[osc]->max_num_breakpoints[1] != MAX_BREAKPOINTS) all_there = 0;
+    CHECK(all_there, "every osc got its %d breakpoints", MAX_BREAKPOINTS);
+    CHECK(s.heap_blocks > 0, "%u blocks from the heap", (unsigned)s.heap_blocks);
+    amy_reset_oscs();
+    s = stats();
+    CHECK(s.heap_blocks == 0 && s.used_bytes == 0, "all of them freed by a reset");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.features.chorus = 0;
+    c.max_oscs = MAX_OSCS;
+    amy_start(c);
+    test_default_oscs_fit();
+    test_grow_and_fit_state();
+    test_reset_empties_it();
+    test_overflow_uses_heap();
+    amy_stop();
+    CHECK(stats().arena_bytes == 0, "amy_stop frees the arena");
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
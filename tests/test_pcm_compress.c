@@ -0,0 +1,207 @@
+// Tests compressed PCM presets (pcm.c, "Compressed presets"): a preset
+// compressed with pcm_compress_preset ('zK', compress_sample) keeps 8-bit
+// codes and a shift per PCM_C8_BLOCK frames in place of its int16 frames.
+//
+//   - It holds about half the RAM, as pcm_resident_bytes counts it.
+//   - A preset whose samples all fit in a code plays bit for bit as it did.
+//   - A loud one plays as it did within the codes' quantization, looping,
+//     and through the fit stretcher, and retriggers at zero crossings as it
+//     did.
+//   - Its vector kernels (pcm_simd.h) match the scalar ones bit for bit,
+//     mono and stereo (mixed, PCM_LEFT and PCM_RIGHT).
+//   - Only presets of int16 frames in RAM compress, and not while a
+//     transfer is still filling them.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define PRESET 1024
+#define STEREO_PRESET 1025
+#define FRAMES 6000
+#define BLOCKS 150
+
+static int16_t rendered[2][BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS];
+
+// Noise at a level that changes every 100 frames, from full scale down to
+// a few bits, so the blocks take every shift.  quiet keeps it within a code.
+static int16_t frame_of(uint32_t i, bool quiet) {
+    int32_t noise = (int32_t)((i * 2654435761u) >> 16) - 32768;
+    return (int16_t)(noise >> (quiet ? 8 : (i / 100) % 9));
+}
+
+static void restart(void) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+}
+
+static void load(bool quiet, bool compress) {
+    int16_t *ram = pcm_load(PRESET, FRAMES, 44100, 1, 60, 1000, 4321);
+    for (uint32_t i = 0; i < FRAMES; ++i)  ram[i] = frame_of(i, quiet);
+    ram = pcm_load(STEREO_PRESET, FRAMES, 44100, 2, 60, 2000, 5555);
+    for (uint32_t i = 0; i < FRAMES * 2; ++i)  ram[i] = frame_of(i * 7 + 3, quiet);
+    if (compress) {
+        pcm_compress_preset(PRESET);
+        pcm_compress_preset(STEREO_PRESET);
+    }
+}
+
+static void note(uint16_t osc, uint16_t wave, uint16_t preset, uint16_t mode, float midi_note, uint16_t fit) {
+    amy_event e = amy_default_event();
+    e.osc = osc;
+    e.wave = wave;
+    e.preset = preset;
+    e.mode = mode;
+    e.midi_note = midi_note;
+    e.velocity = 0.2f;
+    if (fit)  e.fit_ticks = fit;
+    amy_add_event(&e);
+}
+
+enum { NATIVE, LOOPED, RETRIGGER, STRETCH, CASES };
+static const char *case_names[] = { "native rate", "looping, pitched", "retriggers", "fit" };
+
+static void render(int c, bool quiet, bool compress, uint8_t level, int16_t *out) {
+    restart();
+    render_lut_simd = level;
+    load(quiet, compress);
+    for (int b = 0; b < BLOCKS; ++b) {
+        if (c == NATIVE && b == 0) {
+            // No note: each output sample is a frame.
+            amy_event e = amy_default_event();
+            e.osc = 0;
+            e.wave = PCM;
+            e.preset = PRESET;
+            e.velocity = 0.2f;
+            amy_add_event(&e);
+        } else if (c == LOOPED && b == 0) {
+            for (int osc = 0; osc < 6; ++osc)
+                note(osc, (uint16_t[]){PCM, PCM_LEFT, PCM_RIGHT}[osc % 3], osc < 3 ? PRESET : STEREO_PRESET,
+                     PCM_LOOP, 50 + osc * 3.3f, 0);
+        } else if (c == RETRIGGER && b % 13 == 0) {
+            for (int osc = 0; osc < 4; ++osc)
+                note(osc, osc == 3 ? PCM_RIGHT : PCM, osc & 1 ? STEREO_PRESET : PRESET, PCM_LOOP,
+                     55 + osc * 4.1f + (b % 3), 0);
+        } else if (c == STRETCH && b == 0) {
+            note(0, PCM, PRESET, PCM_LOOP, 62, 100);
+            note(1, PCM_LEFT, STEREO_PRESET, PCM_PLAY, 57, 300);
+        }
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+    }
+}
+
+// Signal to difference, in dB, of b against a.
+static double snr_db(const int16_t *a, const int16_t *b, int n) {
+    double signal = 0, noise = 0;
+    for (int i = 0; i < n; ++i) {
+        signal += (double)a[i] * a[i];
+        noise += (double)(a[i] - b[i]) * (a[i] - b[i]);
+    }
+    if (noise == 0)  return INFINITY;
+    return 10 * log10(signal / noise);
+}
+
+static double level_db(const int16_t *a, int n) {
+    double energy = 0;
+    for (int i = 0; i < n; ++i)  energy += (double)a[i] * a[i];
+    return 10 * log10(energy / n);
+}
+
+static void test_memory(void) {
+    printf("a compressed preset holds about half the RAM\n");
+    restart();
+    load(false, false);
+    uint32_t before = amy_global.pcm_resident_bytes;
+    CHECK(pcm_compress_preset(PRESET) && pcm_compress_preset(STEREO_PRESET), "both compress");
+    uint32_t blocks = (FRAMES + PCM_C8_BLOCK - 1) / PCM_C8_BLOCK;
+    uint32_t expect = FRAMES * 3 + 2 * (blocks + 2 * PCM_C8_PAD);
+    CHECK(amy_global.pcm_resident_bytes == expect, "%" PRIu32 " bytes resident, from %" PRIu32,
+          amy_global.pcm_resident_bytes, before);
+    uint32_t length = 0;
+    CHECK(pcm_get_sample_ram_for_preset(PRESET, &length) == NULL && length == FRAMES,
+          "it has %" PRIu32 " frames, none of them int16", length);
+    pcm_unload_all_presets();
+    CHECK(amy_global.pcm_resident_bytes == 0, "none once they're unloaded");
+}
+
+static void test_plays(void) {
+    int n = BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS;
+    for (int c = 0; c < CASES; ++c) {
+        printf("%s\n", case_names[c]);
+        render(c, true, false, RENDER_LUT_SCALAR, rendered[0]);
+        render(c, true, true, RENDER_LUT_SCALAR, rendered[1]);
+        int loud = 0;
+        for (int i = 0; i < n; ++i)  loud += (rendered[0][i] != 0);
+        CHECK(loud > 1000 && memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0,
+              "samples within a code play bit for bit as before (%d nonzero)", loud);
+        render(c, false, false, RENDER_LUT_SCALAR, rendered[0]);
+        render(c, false, true, RENDER_LUT_SCALAR, rendered[1]);
+        if (c == RETRIGGER) {
+            // The codes can put a zero crossing a frame or two away, so the
+            // restarts needn't line up sample for sample; they're as loud.
+            double level = level_db(rendered[1], n) - level_db(rendered[0], n);
+            CHECK(fabs(level) < 1, "loud ones play as loud as before, %+.2f dB", level);
+        } else {
+            double snr = snr_db(rendered[0], rendered[1], n);
+            CHECK(snr > 35, "loud ones play as before, %.1f dB above the difference", snr);
+        }
+    }
+}
+
+static void test_vector(uint8_t best) {
+    printf("vector kernels match the scalar ones\n");
+    for (int c = NATIVE; c <= RETRIGGER; ++c) {
+        render(c, false, true, RENDER_LUT_SCALAR, rendered[0]);
+        for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+            render(c, false, true, level, rendered[1]);
+            CHECK(memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0, "%s, %d-bit", case_names[c],
+                  level == RENDER_LUT_SIMD128 ? 128 : 256);
+        }
+    }
+}
+
+static void test_refused(void) {
+    printf("only int16 presets in RAM compress\n");
+    restart();
+    CHECK(!pcm_compress_preset(0), "not a ROM preset");
+    CHECK(!pcm_compress_preset(PRESET), "not one that isn't loaded");
+    load(false, false);
+    amy_add_message("zK1024Z");
+    uint32_t length = 0;
+    CHECK(pcm_get_sample_ram_for_preset(PRESET, &length) == NULL && length == FRAMES, "zK compresses one");
+    CHECK(!pcm_compress_preset(PRESET), "not one that's compressed already");
+    amy_add_message("z1026,100,44100,60,0,0Z");
+    CHECK(!pcm_compress_preset(1026), "not one a transfer is filling");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    test_memory();
+    test_plays();
+    test_vector(best);
+    test_refused();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Tests that render_pcm's kernels (pcm_run, and pcm_simd.h's vector ones)
+// produce exactly what the scalar ones do, across every way a PCM note
+// reaches a boundary that sends it back through render_pcm's checks.
+//
+// Each case plays some notes and renders a second or so, once per vector
+// width the CPU supports, and the renders have to match the scalar one bit
+// for bit (the python tests hold PCM output to tests/ref):
+//
+//   - ROM drum presets played to their ends, at pitches up and down.
+//   - A mono preset looping, across many loop ends, at fractional steps.
+//   - A stereo preset looping, as PCM (both channels mixed), PCM_LEFT and
+//     PCM_RIGHT.
+//   - Retriggers while sounding, which loop once to a zero crossing
+//     (PCM_LOOP_ONCE_INTERNAL) before restarting.
+//   - Notes starting partway into a block (sample_offset).
+//   - Steps of several frames a sample, which jump the loop end.
+//   - Presets of one and two frames.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define PRESET 1024
+#define STEREO_PRESET 1025
+#define TINY_PRESET 1026
+#define FRAMES 5000
+#define BLOCKS 200
+
+enum { ROM, LOOPED, STEREO, RETRIGGER, OFFSET, HUGE_STEP, TINY, CASES };
+static const char *case_names[] = {
+    "ROM presets to their ends", "mono looping", "stereo looping, mixed, left and right",
+    "retriggers at zero crossings", "sample_offset starts", "steps of several frames", "one- and two-frame presets",
+};
+
+static int16_t rendered[BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+
+static void note(uint16_t osc, uint16_t wave, uint16_t preset, uint16_t mode, float midi_note,
+                 float velocity, uint16_t sample_offset) {
+    amy_event e = amy_default_event();
+    e.osc = osc;
+    e.wave = wave;
+    e.preset = preset;
+    e.mode = mode;
+    e.midi_note = midi_note;
+    e.velocity = velocity;
+    if (sample_offset)  e.sample_offset = sample_offset;
+    amy_add_event(&e);
+}
+
+// Notes for block b of case c.
+static void play(int c, int b) {
+    switch (c) {
+        case ROM:
+            if (b % 50 == 0)
+                for (int osc = 0; osc < 12; ++osc)
+                    note(osc, PCM, (osc + b / 50) % pcm_samples, PCM_PLAY, 36 + osc * 5.3f, 0.3f, 0);
+            break;
+        case LOOPED:
+            if (b == 0)
+                for (int osc = 0; osc < 8; ++osc)
+                    note(osc, PCM, PRESET, PCM_LOOP, 40.37f + osc * 3.1f, 0.3f, 0);
+            break;
+        case STEREO:
+            if (b == 0)
+                for (int osc = 0; osc < 9; ++osc)
+                    note(osc, (uint16_t[]){PCM, PCM_LEFT, PCM_RIGHT}[osc % 3], STEREO_PRESET, PCM_LOOP,
+                         45.5f + osc * 2.3f, 0.3f, 0);
+            break;
+        case RETRIGGER:
+            if (b % 17 == 0)
+                for (int osc = 0; osc < 4; ++osc)
+                    note(osc, osc == 3 ? PCM_RIGHT : PCM, osc == 3 ? STEREO_PRESET : PRESET,
+                         osc & 1 ? PCM_LOOP : PCM_PLAY, 50 + osc * 4.7f + (b % 3), 0.3f, 0);
+            break;
+        case OFFSET:
+            if (b % 10 == 0)
+                for (int osc = 0; osc < 4; ++osc)
+                    note(osc, PCM, PRESET, PCM_PLAY, 55 + osc, 0.3f, 1 + (b * 7 + osc * 61) % (AMY_BLOCK_SIZE - 1));
+            break;
+        case HUGE_STEP:
+            if (b == 0)
+                for (int osc = 0; osc < 4; ++osc)
+                    note(osc, osc & 1 ? PCM_LEFT : PCM, osc & 1 ? STEREO_PRESET : PRESET, PCM_LOOP,
+                         80 + osc * 2.5f, 0.3f, 0);
+            break;
+        case TINY:
+            if (b % 20 == 0) {
+                note(0, PCM, TINY_PRESET, PCM_LOOP, 60, 0.3f, 0);
+                note(1, PCM, TINY_PRESET + 1, PCM_PLAY, 30 + b / 20, 0.3f, 0);
+            }
+            break;
+    }
+}
+
+static int16_t *load(uint16_t preset, uint32_t frames, uint8_t channels, uint32_t loopstart, uint32_t loopend) {
+    int16_t *ram = pcm_load(preset, frames, 44100, channels, 60, loopstart, loopend);
+    for (uint32_t i = 0; i < frames * channels; ++i)
+        ram[i] = (int16_t)((int32_t)((i * 2654435761u) >> 16) - 32768);
+    return ram;
+}
+
+static void render_at(int c, uint8_t level) {
+    amy_config_t config = amy_default_config();
+    config.features.startup_bleep = 0;
+    amy_start(config);
+    render_lut_simd = level;
+    load(PRESET, FRAMES, 1, 1000, 1441);
+    load(STEREO_PRESET, FRAMES, 2, 2000, 2301);
+    load(TINY_PRESET, 1, 1, 0, 1);
+    load(TINY_PRESET + 1, 2, 1, 0, 2);
+    for (int b = 0; b < BLOCKS; ++b) {
+        play(c, b);
+        memcpy(rendered[b], amy_simple_fill_buffer(), sizeof(rendered[b]));
+    }
+    amy_stop();
+}
+
+static void test_case(int c, uint8_t best) {
+    static int16_t reference[BLOCKS][AMY_BLOCK_SIZE * AMY_NCHANS];
+    printf("%s\n", case_names[c]);
+    render_at(c, RENDER_LUT_SCALAR);
+    memcpy(reference, rendered, sizeof(reference));
+    int nonzero = 0;
+    for (int b = 0; b < BLOCKS; ++b)
+        for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)
+            nonzero += (reference[b][i] != 0);
+    CHECK(nonzero > 1000, "scalar render is not silent (%d nonzero samples)", nonzero);
+    for (uint8_t level = RENDER_LUT_SIMD128; level <= best; ++level) {
+        render_at(c, level);
+        int first_diff = -1;
+        for (int b = 0; b < BLOCKS && first_diff < 0; ++b)
+            if (memcmp(reference[b], rendered[b], sizeof(rendered[b])) != 0)  first_diff = b;
+        CHECK(first_diff < 0, "%d-bit render is bit-identical over %d blocks (first differing block %d)",
+              level == RENDER_LUT_SIMD128 ? 128 : 256, BLOCKS, first_diff);
+    }
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    uint8_t best = render_lut_simd;
+    amy_stop();
+    printf("widest render_pcm kernels on this CPU: %d-bit\n", best == RENDER_LUT_SCALAR ? 32 : best == RENDER_LUT_SIMD128 ? 128 : 256);
+    for (int k = 0; k < CASES; ++k)  test_case(k, best);
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
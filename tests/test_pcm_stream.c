@@ -0,0 +1,217 @@
+// Tests streaming disk samples through the reader thread (pcm.c, "Streaming
+// from files"): the render thread copies frames out of a ring the thread
+// keeps read ahead, instead of reading the file itself.
+//
+//   - 32 files (mono and stereo, at different pitches) streamed at once,
+//     with note-offs and re-triggers partway, render exactly the samples
+//     the render thread reading them itself makes, and every one plays to
+//     its end.
+//   - Rendering with no audio device waits for the reader, so it never
+//     counts an underrun.
+//   - Several oscs on one file preset, rendered across the render pool,
+//     make what one render thread makes.
+//   - A file preset still refuses a loop mode.
+//   - With a device (a deadline), a reader that can't keep up costs blocks,
+//     counted in pcm_stream_underruns, but never holds up the render; once
+//     it catches up the stream plays on to its end.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define STREAMS 32
+#define PRESET 1024
+#define FILE_FRAMES 30000
+#define BLOCKS 200
+
+static char filenames[STREAMS][MAX_FILENAME_LEN];
+
+static void put_u16(FILE *f, uint16_t v) { fputc(v & 0xff, f); fputc(v >> 8, f); }
+static void put_u32(FILE *f, uint32_t v) { put_u16(f, v & 0xffff); put_u16(f, v >> 16); }
+
+// A 44.1 kHz 16-bit WAV of a saw (and, in stereo, a square on the right).
+static void write_wav(const char *filename, uint16_t channels, uint32_t period) {
+    FILE *f = fopen(filename, "wb");
+    uint32_t data_bytes = FILE_FRAMES * channels * 2;
+    fwrite("RIFF", 1, 4, f);  put_u32(f, 36 + data_bytes);  fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f);  put_u32(f, 16);  put_u16(f, 1);  put_u16(f, channels);
+    put_u32(f, 44100);  put_u32(f, 44100 * channels * 2);  put_u16(f, channels * 2);  put_u16(f, 16);
+    fwrite("data", 1, 4, f);  put_u32(f, data_bytes);
+    for (uint32_t i = 0; i < FILE_FRAMES; ++i) {
+        put_u16(f, (uint16_t)(int16_t)((int32_t)(i % period) * 16000 / period - 8000));
+        if (channels == 2)  put_u16(f, (uint16_t)(int16_t)((i % period) < period / 2 ? 6000 : -6000));
+    }
+    fclose(f);
+}
+
+static void restart(bool threaded, uint8_t audio) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.platform.multithread = threaded;
+    c.audio = audio;
+    amy_start(c);
+}
+
+static void load(int stream) {
+    char message[MAX_FILENAME_LEN + 32];
+    snprintf(message, sizeof(message), "zF%d,%.*s,60Z", PRESET + stream, MAX_FILENAME_LEN - 1, filenames[stream]);
+    amy_add_message(message);
+}
+
+static void note(uint16_t osc, float velocity) {
+    amy_event e = amy_default_event();
+    e.osc = osc;
+    e.wave = PCM;
+    e.preset = PRESET + osc;
+    e.midi_note = 60 + (osc % 5) * 3;
+    e.velocity = velocity;
+    amy_add_event(&e);
+}
+
+static int16_t rendered[2][BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS];
+
+// All the streams at once; some stopped, some started again, partway.
+static void play(bool threaded, int16_t *out, int *still_on) {
+    restart(threaded, AMY_AUDIO_IS_NONE);
+    for (int s = 0; s < STREAMS; ++s)  load(s);
+    for (int s = 0; s < STREAMS; ++s)  note(s, 0.05f);
+    for (int b = 0; b < BLOCKS; ++b) {
+        if (b == 30)
+            for (int s = 1; s < STREAMS; s += 4)  note(s, 0);
+        if (b == 45)
+            for (int s = 2; s < STREAMS; s += 4)  note(s, 0.05f);
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+    }
+    *still_on = 0;
+    for (int s = 0; s < STREAMS; ++s)  *still_on += (synth[s]->status != SYNTH_OFF);
+}
+
+static void test_many_streams(void) {
+    printf("%d streams at once play as the render thread reading them would\n", STREAMS);
+    int on_sync, on_threaded;
+    play(false, rendered[0], &on_sync);
+    play(true, rendered[1], &on_threaded);
+    int loud = 0;
+    for (int i = 0; i < BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  loud += (rendered[1][i] != 0);
+    CHECK(loud > 0 && memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0,
+          "%d blocks, %s", BLOCKS, loud ? "identical" : "but silent");
+    CHECK(on_sync == 0 && on_threaded == 0, "every stream played to its end (%d, %d still on)", on_sync, on_threaded);
+    CHECK(amy_global.pcm_stream_underruns == 0, "no underruns without a device (%" PRIu32 ")",
+          amy_global.pcm_stream_underruns);
+}
+
+// Oscs 0..SHARING-1 all on the first file, rendered on `threads` cores.
+#define SHARING 8
+static void play_shared(uint8_t threads, int16_t *out) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.render_threads = threads;
+    amy_start(c);
+    load(0);
+    for (int o = 0; o < SHARING; ++o) {
+        amy_event e = amy_default_event();
+        e.osc = o;
+        e.wave = PCM;
+        e.preset = PRESET;
+        e.midi_note = 60 + o;
+        e.velocity = 0.05f;
+        amy_add_event(&e);
+    }
+    for (int b = 0; b < BLOCKS; ++b)
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+}
+
+static void test_shared_stream_across_cores(void) {
+    printf("%d oscs on one file preset render on 4 cores as on 1\n", SHARING);
+    play_shared(1, rendered[0]);
+    play_shared(4, rendered[1]);
+    int loud = 0;
+    for (int i = 0; i < BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  loud += (rendered[1][i] != 0);
+    CHECK(loud > 0 && memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0,
+          "%d blocks, %s", BLOCKS, loud ? "identical" : "but silent");
+}
+
+static void test_loop_refused(void) {
+    printf("a streamed preset still can't loop\n");
+    restart(true, AMY_AUDIO_IS_NONE);
+    load(0);
+    amy_event e = amy_default_event();
+    e.osc = 0;
+    e.wave = PCM;
+    e.preset = PRESET;
+    e.mode = PCM_LOOP;
+    amy_add_event(&e);
+    amy_execute_deltas();
+    CHECK(synth[0]->mode != PCM_LOOP, "mode %d", synth[0]->mode);
+}
+
+// A disk that takes its time, when asked to.
+static uint32_t (*fast_fread)(uint32_t, uint8_t *, uint32_t);
+static volatile int slow_us = 0;
+static uint32_t slow_fread(uint32_t handle, uint8_t *bytes, uint32_t len) {
+    if (slow_us)  usleep(slow_us);
+    return fast_fread(handle, bytes, len);
+}
+
+static void test_underruns(void) {
+    printf("with a deadline, a slow reader costs blocks, not time\n");
+    restart(true, AMY_AUDIO_IS_I2S);
+    fast_fread = amy_global.config.amy_external_fread_hook;
+    amy_global.config.amy_external_fread_hook = slow_fread;
+    load(0);
+    slow_us = 20000;
+    note(0, 0.5f);
+    int64_t t0 = amy_get_us();
+    for (int b = 0; b < 60; ++b)  amy_simple_fill_buffer();
+    int64_t us = amy_get_us() - t0;
+    uint32_t underruns = amy_global.pcm_stream_underruns;
+    // Each read past the head takes 20 ms; reading on the render thread would
+    // take that for most of these blocks.
+    CHECK(underruns > 0 && us < 200000, "%" PRIu32 " underruns in 60 blocks, rendered in %d ms",
+          underruns, (int)(us / 1000));
+    slow_us = 0;
+    int b = 0;
+    for (; b < 2000 && synth[0]->status != SYNTH_OFF; ++b) {
+        amy_simple_fill_buffer();
+        usleep(2000);
+    }
+    CHECK(synth[0]->status == SYNTH_OFF, "caught up, and played to its end %d blocks later", b);
+    amy_global.config.amy_external_fread_hook = fast_fread;
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    for (int s = 0; s < STREAMS; ++s) {
+        snprintf(filenames[s], sizeof(filenames[s]), "/tmp/amy_test_pcm_stream_%d_%d.wav", (int)getpid(), s);
+        write_wav(filenames[s], 1 + (s & 1), 40 + 7 * s);
+    }
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_many_streams();
+    test_shared_stream_across_cores();
+    test_loop_refused();
+    test_underruns();
+    amy_stop();
+    for (int s = 0; s < STREAMS; ++s)  unlink(filenames[s]);
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,353 @@
+// Tests the PCM preset index and the sample RAM budget (pcm.c, "Sample RAM
+// budget"): presets read from a file (read_sample, 'zR', pcm_read_file) are
+// evicted, least recently played first, to keep the frames presets hold in
+// RAM under config.sample_ram_budget, and read again when next played.
+//
+//   - Hundreds of presets, many sharing an index bucket, each find their own
+//     frames, and unloading some leaves the rest.
+//   - A read_sample preset plays exactly what the same frames loaded with
+//     pcm_load play.
+//   - Reading more than the budget holds evicts the least recently played,
+//     and resident bytes stay within it.
+//   - A note on an evicted preset reads it again (a miss) and plays as it
+//     did before it was evicted; a note on one in RAM is a hit.
+//   - With an audio device (a deadline), that note is silent and the file is
+//     read on the reader thread, never the render side; the next note finds
+//     it back.  With no reader thread, the thread sending events reads it.
+//   - A preset an osc is sounding isn't evicted.
+//   - A load that can't fit even after evicting everything evictable is
+//     refused, and pcm_load presets (which have no file) are never evicted.
+//   - Files read on another thread while notes play and evict keep the
+//     resident bytes counting exactly the frames held.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define PRESET 1024
+#define FILES 4
+#define FRAMES 10000
+#define FILE_BYTES (FRAMES * 2)
+#define BLOCKS 150
+
+static char filenames[FILES][MAX_FILENAME_LEN];
+
+static void put_u16(FILE *f, uint16_t v) { fputc(v & 0xff, f); fputc(v >> 8, f); }
+static void put_u32(FILE *f, uint32_t v) { put_u16(f, v & 0xffff); put_u16(f, v >> 16); }
+
+static int16_t frame_of(int file, uint32_t i) {
+    return (int16_t)((int32_t)(i % (50 + 13 * file)) * 400 - 10000);
+}
+
+// A mono 44.1 kHz WAV of a saw, a different pitch per file.
+static void write_wav(int file) {
+    FILE *f = fopen(filenames[file], "wb");
+    fwrite("RIFF", 1, 4, f);  put_u32(f, 36 + FILE_BYTES);  fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f);  put_u32(f, 16);  put_u16(f, 1);  put_u16(f, 1);
+    put_u32(f, 44100);  put_u32(f, 44100 * 2);  put_u16(f, 2);  put_u16(f, 16);
+    fwrite("data", 1, 4, f);  put_u32(f, FILE_BYTES);
+    for (uint32_t i = 0; i < FRAMES; ++i)  put_u16(f, (uint16_t)frame_of(file, i));
+    fclose(f);
+}
+
+static void restart_with(uint32_t budget, bool threaded, uint8_t audio) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.sample_ram_budget = budget;
+    c.platform.multithread = threaded;
+    c.audio = audio;
+    amy_start(c);
+}
+
+static void restart(uint32_t budget) {
+    restart_with(budget, true, AMY_AUDIO_IS_NONE);
+}
+
+static void read_file(int file) {
+    char message[MAX_FILENAME_LEN + 32];
+    snprintf(message, sizeof(message), "zR%d,%.*s,60Z", PRESET + file, MAX_FILENAME_LEN - 1, filenames[file]);
+    amy_add_message(message);
+}
+
+// (A preset that isn't loaded at all plays a ROM preset's frames.)
+static bool resident(int file) {
+    uint32_t length = 0;
+    return pcm_get_sample_ram_for_preset(PRESET + file, &length) != NULL && length == FRAMES;
+}
+
+static bool frames_match(int file) {
+    uint32_t length = 0;
+    const int16_t *ram = pcm_get_sample_ram_for_preset(PRESET + file, &length);
+    if (ram == NULL || length != FRAMES)  return false;
+    for (uint32_t i = 0; i < FRAMES; ++i)
+        if (ram[i] != frame_of(file, i))  return false;
+    return true;
+}
+
+static void note(uint16_t osc, uint16_t preset, uint16_t mode, float velocity) {
+    amy_event e = amy_default_event();
+    e.osc = osc;
+    e.wave = PCM;
+    e.preset = preset;
+    e.mode = mode;
+    e.midi_note = 62;
+    e.velocity = velocity;
+    amy_add_event(&e);
+    amy_execute_deltas();
+}
+
+static int16_t rendered[3][BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS];
+
+static void render(int16_t *out) {
+    for (int b = 0; b < BLOCKS; ++b)
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+}
+
+static void test_index(void) {
+    printf("hundreds of presets each find their own frames\n");
+    restart(0);
+    // 64 apart share a bucket.
+    int presets = 320, wrong = 0;
+    for (int p = 0; p < presets; ++p) {
+        int16_t *ram = pcm_load(PRESET + p * 16, 4, 44100, 1, 60, 0, 0);
+        for (int i = 0; i < 4; ++i)  ram[i] = (int16_t)(p * 4 + i);
+    }
+    for (int p = 0; p < presets; p += 2)  pcm_unload_preset(PRESET + p * 16);
+    for (int p = 0; p < presets; ++p) {
+        uint32_t length = 0;
+        const int16_t *ram = pcm_get_sample_ram_for_preset(PRESET + p * 16, &length);
+        // The unloaded ones fall back to a ROM preset, not to their frames.
+        bool own = (length == 4 && ram[0] == (int16_t)(p * 4) && ram[3] == (int16_t)(p * 4 + 3));
+        wrong += (own != (p & 1));
+    }
+    CHECK(wrong == 0, "%d presets, every other one unloaded, %d wrong", presets, wrong);
+    CHECK(amy_global.pcm_resident_bytes == (uint32_t)(presets / 2 * 4 * 2), "%" PRIu32 " bytes resident",
+          amy_global.pcm_resident_bytes);
+    pcm_unload_all_presets();
+    CHECK(amy_global.pcm_resident_bytes == 0, "none once they're all unloaded");
+}
+
+static void test_plays_as_loaded(void) {
+    printf("a read_sample preset plays as pcm_load's does\n");
+    restart(0);
+    read_file(0);
+    CHECK(frames_match(0), "it holds the file's frames");
+    note(0, PRESET, PCM_LOOP, 0.5f);
+    render(rendered[0]);
+    restart(0);
+    int16_t *ram = pcm_load(PRESET + 100, FRAMES, 44100, 1, 60, 0, 0);
+    for (uint32_t i = 0; i < FRAMES; ++i)  ram[i] = frame_of(0, i);
+    note(0, PRESET + 100, PCM_LOOP, 0.5f);
+    render(rendered[1]);
+    int loud = 0;
+    for (int i = 0; i < BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  loud += (rendered[0][i] != 0);
+    CHECK(loud > 0 && memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0,
+          "%d blocks, %s", BLOCKS, loud ? "identical" : "but silent");
+}
+
+static void test_eviction(void) {
+    printf("over the budget, the least recently played is evicted and read again\n");
+    // Room for two and a half files.
+    uint32_t budget = FILE_BYTES * 5 / 2;
+    restart(budget);
+    read_file(0);
+    read_file(1);
+    CHECK(resident(0) && resident(1) && amy_global.pcm_cache_evictions == 0, "two fit");
+    // Play 0, so 1 is the least recently played.
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    render(rendered[0]);
+    read_file(2);
+    CHECK(resident(0) && !resident(1) && resident(2) && amy_global.pcm_cache_evictions == 1,
+          "a third evicts the least recently played (%" PRIu32 " evictions)", amy_global.pcm_cache_evictions);
+    CHECK(amy_global.pcm_resident_bytes <= budget, "%" PRIu32 " bytes resident, budget %" PRIu32,
+          amy_global.pcm_resident_bytes, budget);
+    uint32_t hits = amy_global.pcm_cache_hits, misses = amy_global.pcm_cache_misses;
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    CHECK(amy_global.pcm_cache_hits == hits + 1 && amy_global.pcm_cache_misses == misses, "a note on one in RAM is a hit");
+    // Play 2 so 0 is now the oldest; 1 coming back evicts it.
+    note(1, PRESET + 2, PCM_PLAY_STOP, 0.5f);
+    for (int b = 0; b < BLOCKS; ++b)  amy_simple_fill_buffer();
+    note(0, PRESET + 1, PCM_PLAY_STOP, 0.5f);
+    CHECK(amy_global.pcm_cache_misses == misses + 1 && frames_match(1) && !resident(0) && resident(2),
+          "a note on an evicted one is a miss, reads it again, and evicts the oldest");
+    // And it plays as it did: compare with a fresh start reading it in.
+    note(0, PRESET + 1, PCM_PLAY_STOP, 0);
+    note(1, PRESET + 2, PCM_PLAY_STOP, 0);
+    for (int b = 0; b < 4; ++b)  amy_simple_fill_buffer();
+    note(0, PRESET + 1, PCM_PLAY_STOP, 0.5f);
+    render(rendered[1]);
+    restart(0);
+    read_file(1);
+    note(0, PRESET + 1, PCM_PLAY_STOP, 0.5f);
+    render(rendered[2]);
+    CHECK(memcmp(rendered[1], rendered[2], sizeof(rendered[1])) == 0, "it plays as it did");
+}
+
+static void test_sounding_stays(void) {
+    printf("a sounding preset isn't evicted\n");
+    uint32_t budget = FILE_BYTES * 5 / 2;
+    restart(budget);
+    read_file(0);
+    read_file(1);
+    // 0 is the least recently played, but it's looping on osc 0.
+    note(0, PRESET + 0, PCM_LOOP, 0.5f);
+    note(1, PRESET + 1, PCM_PLAY_STOP, 0.5f);
+    note(1, PRESET + 1, PCM_PLAY_STOP, 0);
+    read_file(2);
+    CHECK(resident(0) && !resident(1) && resident(2), "the quiet one went instead");
+}
+
+static void test_refused(void) {
+    printf("a load that can't fit is refused\n");
+    uint32_t budget = FILE_BYTES * 5 / 2;
+    restart(budget);
+    int16_t *pinned = pcm_load(PRESET + 100, FRAMES * 2, 44100, 1, 60, 0, 0);
+    read_file(0);
+    CHECK(pinned != NULL && !resident(0) && amy_global.pcm_cache_evictions == 0,
+          "a file too big for what's left isn't read, and pcm_load's isn't evicted");
+    CHECK(pcm_load(PRESET + 101, FRAMES, 44100, 1, 60, 0, 0) == NULL, "nor is a pcm_load that doesn't fit");
+    CHECK(amy_global.pcm_resident_bytes == FRAMES * 2 * 2, "%" PRIu32 " bytes resident",
+          amy_global.pcm_resident_bytes);
+}
+
+// A disk that takes its time, and notes who's reading it.
+static uint32_t (*fast_fopen)(char *, const char *);
+static void (*fast_fclose)(uint32_t);
+static pthread_t render_side;
+static volatile int opened_on_render_side = 0;
+static volatile int closed = 0;
+static uint32_t slow_fopen(char *filename, const char *mode) {
+    if (pthread_equal(pthread_self(), render_side))  opened_on_render_side++;
+    usleep(20000);
+    return fast_fopen(filename, mode);
+}
+static void counting_fclose(uint32_t handle) {
+    fast_fclose(handle);
+    closed++;
+}
+
+static void slow_disk(bool slow) {
+    if (slow) {
+        fast_fopen = amy_global.config.amy_external_fopen_hook;
+        fast_fclose = amy_global.config.amy_external_fclose_hook;
+        amy_global.config.amy_external_fopen_hook = slow_fopen;
+        amy_global.config.amy_external_fclose_hook = counting_fclose;
+    } else {
+        amy_global.config.amy_external_fopen_hook = fast_fopen;
+        amy_global.config.amy_external_fclose_hook = fast_fclose;
+    }
+}
+
+static void test_reload_off_render(void) {
+    printf("with a deadline, an evicted preset is read back off the render side\n");
+    uint32_t budget = FILE_BYTES * 5 / 2;
+    restart_with(budget, true, AMY_AUDIO_IS_I2S);
+    read_file(0);
+    read_file(1);
+    read_file(2);
+    CHECK(!resident(0), "the first one read was evicted");
+    render_side = pthread_self();
+    opened_on_render_side = 0;
+    slow_disk(true);
+    uint32_t hits = amy_global.pcm_cache_hits, misses = amy_global.pcm_cache_misses;
+    int before = closed;
+    int64_t t0 = amy_get_us();
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    amy_simple_fill_buffer();
+    int64_t us = amy_get_us() - t0;
+    CHECK(amy_global.pcm_cache_misses == misses + 1 && !resident(0) && synth[0]->status == SYNTH_OFF,
+          "a note on it is a miss, and silent");
+    // Opening the file takes 20 ms.
+    CHECK(us < 15000, "the note and its block took %d ms", (int)(us / 1000));
+    for (int i = 0; i < 2000 && closed == before; ++i)  usleep(1000);
+    usleep(20000);
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    amy_simple_fill_buffer();
+    CHECK(amy_global.pcm_cache_hits == hits + 1 && frames_match(0) && synth[0]->status == SYNTH_AUDIBLE,
+          "the next note finds it back, and plays");
+    CHECK(opened_on_render_side == 0 && amy_global.pcm_resident_bytes <= budget,
+          "the file was read on the reader thread, and the budget held");
+    slow_disk(false);
+
+    printf("with no reader thread, the thread sending events reads it back\n");
+    restart_with(budget, false, AMY_AUDIO_IS_I2S);
+    read_file(0);
+    read_file(1);
+    read_file(2);
+    hits = amy_global.pcm_cache_hits;
+    misses = amy_global.pcm_cache_misses;
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    CHECK(amy_global.pcm_cache_misses == misses + 1 && !resident(0), "a note on it is a miss");
+    note(0, PRESET + 0, PCM_PLAY_STOP, 0.5f);
+    amy_simple_fill_buffer();
+    CHECK(amy_global.pcm_cache_hits == hits + 1 && frames_match(0) && synth[0]->status == SYNTH_AUDIBLE,
+          "sending the next note read it, and that note plays");
+}
+
+// Into presets of their own: replacing one an osc is sounding is another matter.
+static volatile bool loading = false;
+static void *loader(void *arg) {
+    (void)arg;
+    for (int i = 0; i < 200; ++i)  pcm_read_file(PRESET + FILES + i % FILES, filenames[i % FILES], 60);
+    loading = false;
+    return NULL;
+}
+
+static void test_load_while_playing(void) {
+    printf("reading files on another thread while notes evict\n");
+    uint32_t budget = FILE_BYTES * 5 / 2;
+    restart(budget);
+    for (int f = 0; f < FILES; ++f)  read_file(f);
+    pthread_t t;
+    loading = true;
+    pthread_create(&t, NULL, loader, NULL);
+    for (int i = 0; loading; ++i) {
+        note(i % 4, PRESET + i % FILES, PCM_PLAY_STOP, 0.5f);
+        amy_simple_fill_buffer();
+    }
+    pthread_join(t, NULL);
+    uint32_t held = 0;
+    for (int f = 0; f < 2 * FILES; ++f)  held += resident(f) ? FILE_BYTES : 0;
+    CHECK(amy_global.pcm_resident_bytes == held && held <= budget,
+          "%" PRIu32 " bytes counted resident, %" PRIu32 " held, budget %" PRIu32,
+          amy_global.pcm_resident_bytes, held, budget);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    for (int f = 0; f < FILES; ++f) {
+        snprintf(filenames[f], sizeof(filenames[f]), "/tmp/amy_test_sample_budget_%d_%d.wav", (int)getpid(), f);
+        write_wav(f);
+    }
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_index();
+    test_plays_as_loaded();
+    test_eviction();
+    test_sounding_stays();
+    test_refused();
+    test_reload_off_render();
+    test_load_while_playing();
+    amy_stop();
+    for (int f = 0; f < FILES; ++f)  unlink(filenames[f]);
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Tests that the sequencer's stored messages, which are now parsed once when
+// they're stored rather than every time they fire, still play as they did.
+//
+//   - A pattern of synth notes and osc-level messages (several events to a
+//     message) renders the same samples as the same messages parsed and
+//     played on the same ticks from the sequencer hook.
+//   - A message that acts as it's parsed isn't parsed when it's stored: a
+//     scheduled RESET_EVENTS doesn't empty the queue in the meantime.
+//   - Such a message, repeating, still acts every time it fires: a synth
+//     loaded from a patch_string is loaded again after it's released.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+#include "sequencer.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+extern int32_t delta_sched_len(void);
+
+static void restart(void (*hook)(uint32_t)) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    c.amy_external_sequencer_hook = hook;
+    amy_start(c);
+}
+
+// The pattern: {tick, period, message}.
+#define STEPS 10
+static const struct { uint32_t tick, period; const char *message; } pattern[STEPS] = {
+    {  1, 48, "i1n48l1Z" }, {  5, 48, "i1n48l0Z" },
+    { 12, 48, "i1n55l0.8Z" }, { 16, 48, "i1n55l0Z" },
+    { 24, 48, "i1n60l1Zi1n64l0.5Z" }, { 40, 48, "i1n60l0Zi1n64l0Z" },
+    {  3, 24, "v100w1f220a0.2l1Zv101w3f331a0.1l1Z" }, { 20, 24, "v100l0Zv101l0Z" },
+    { 30, 48, "v102w0f440a0.1,0,0,1GC1GD4l1Z" }, { 36, 48, "v102l0Z" },
+};
+
+static void play_pattern_from_hook(uint32_t tick) {
+    for (int i = 0; i < STEPS; ++i)
+        if (tick % pattern[i].period == pattern[i].tick)
+            amy_add_message((char *)pattern[i].message);
+}
+
+#define BLOCKS 800
+static int16_t rendered[2][BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS];
+
+static void render(int16_t *out) {
+    for (int b = 0; b < BLOCKS; ++b)
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+}
+
+static void test_pattern(void) {
+    printf("a pattern plays the same as its messages parsed as they fire\n");
+    char message[128];
+    restart(NULL);
+    amy_add_message("i1iv4K0Z");
+    for (int i = 0; i < STEPS; ++i) {
+        snprintf(message, sizeof(message), "H%" PRIu32 ",%" PRIu32 ",%dZ%s",
+                 pattern[i].tick, pattern[i].period, i, pattern[i].message);
+        amy_add_message(message);
+    }
+    render(rendered[0]);
+    restart(play_pattern_from_hook);
+    amy_add_message("i1iv4K0Z");
+    render(rendered[1]);
+    int loud = 0;
+    for (int i = 0; i < BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  loud += (rendered[0][i] != 0);
+    CHECK(loud > 0 && memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0,
+          "%d blocks, %s", BLOCKS, loud ? "identical" : "but silent");
+}
+
+static void test_not_parsed_when_stored(void) {
+    printf("a message that acts as it's parsed isn't parsed when stored\n");
+    restart(NULL);
+    amy_event e = amy_default_event();
+    e.osc = 0;
+    e.velocity = 1;
+    e.time = amy_sysclock() + 10000;
+    amy_add_event(&e);
+    amy_execute_deltas();
+    int32_t before = delta_sched_len();
+    amy_add_message("H100000,0,1S65536Z");
+    amy_execute_deltas();
+    CHECK(before > 0 && delta_sched_len() == before, "queue still holds %" PRIi32 " deltas", delta_sched_len());
+}
+
+static void test_acts_every_time(void) {
+    printf("a message that acts as it's parsed acts every time it fires\n");
+    restart(NULL);
+    amy_add_message("H1,48,2Zi2iv1uv0w1f440Z");
+    int loaded = 0;
+    for (int round = 0; round < 3; ++round) {
+        // Half a second is 48 ticks at the default 120 bpm.
+        for (int b = 0; b < AMY_SAMPLE_RATE / AMY_BLOCK_SIZE / 2 + 2; ++b)  amy_simple_fill_buffer();
+        loaded += instrument_number_exists(2, NULL);
+        amy_add_message("i2iv0Z");
+        amy_execute_deltas();
+    }
+    CHECK(loaded == 3, "loaded %d of 3 times", loaded);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_pattern();
+    test_not_parsed_when_stored();
+    test_acts_every_time();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Tests the PCM fit (granular time-stretch) state now that it lives outside
+// synthinfo.
+//
+// Only fit notes need the stretcher's state, so synthinfo carries a pointer
+// that stays NULL until an osc's first fit note, instead of carrying the
+// state itself in every osc.  That makes it something that can be missing:
+// plain notes must never touch it, a fit note has to allocate it, a plain
+// note after a fit note has to stop using it, and it has to survive the osc
+// being grown for more breakpoints (ensure_osc_allocd() copies the osc into
+// a new block) and be reset with the osc.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+#define OSC 3
+
+// Renders a few blocks and returns the loudest output sample.
+static int render_peak(int blocks) {
+    int peak = 0;
+    for (int b = 0; b < blocks; ++b) {
+        int16_t *block = amy_simple_fill_buffer();
+        for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i) {
+            int v = block[i] < 0 ? -block[i] : block[i];
+            if (v > peak) peak = v;
+        }
+    }
+    return peak;
+}
+
+static void send(const char *m) {
+    amy_add_message((char *)m);
+    amy_simple_fill_buffer();
+}
+
+static bool stretch_active(void) {
+    return synth[OSC]->stretch != NULL && synth[OSC]->stretch->active;
+}
+
+static void test_plain_notes_leave_it_unallocated(void) {
+    printf("plain oscs and plain PCM notes never allocate fit state\n");
+    send("v3w0f440l0.5");
+    CHECK(synth[OSC]->stretch == NULL, "sine osc has no fit state");
+    send("v3l0");
+    render_peak(40);
+    send("v3w7p0l1");
+    CHECK(synth[OSC]->stretch == NULL, "plain PCM note has no fit state");
+    CHECK(render_peak(8) > 0, "and it still plays");
+    send("v3l0");
+    render_peak(40);
+}
+
+static void test_fit_note_allocates_it(void) {
+    printf("a fit note allocates the state and a plain note stops using it\n");
+    send("v3w7p0pF0l1");
+    CHECK(synth[OSC]->stretch != NULL, "fit note allocated the fit state");
+    CHECK(stretch_active(), "and the stretcher is running");
+    CHECK(render_peak(8) > 0, "fit note plays");
+    pcm_stretch_t *st = synth[OSC]->stretch;
+    send("v3pF-1l1");
+    CHECK(synth[OSC]->stretch == st, "a plain note on the same osc keeps the allocation");
+    CHECK(!stretch_active(), "but doesn't render through it");
+    CHECK(render_peak(8) > 0, "plain note plays");
+    send("v3pF0l1");
+    CHECK(synth[OSC]->stretch == st && stretch_active(), "the next fit note reuses it");
+}
+
+static void test_grow_keeps_it(void) {
+    printf("growing the osc for more breakpoints carries the state over\n");
+    struct synthinfo *before = synth[OSC];
+    pcm_stretch_t *st = synth[OSC]->stretch;
+    // 12 breakpoints is more than the default 8, so the osc is reallocated.
+    send("v3A10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,10,1,200,0");
+    CHECK(synth[OSC] != before, "the osc was reallocated");
+    CHECK(synth[OSC]->stretch == st, "and kept its fit state");
+    send("v3l1");
+    CHECK(synth[OSC]->stretch == st && stretch_active(), "which the next fit note runs");
+    CHECK(render_peak(8) > 0, "and plays");
+}
+
+static void test_reset_stops_it(void) {
+    printf("resetting the osc resets the stretcher\n");
+    send("v3l0");
+    render_peak(400);
+    CHECK(synth[OSC]->status == SYNTH_OFF, "the fit note ran out and stopped the osc");
+    CHECK(!stretch_active(), "and its stretcher is inactive");
+    amy_reset_oscs();
+    CHECK(synth[OSC] == NULL, "reset frees the osc (and its fit state)");
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_plain_notes_leave_it_unallocated();
+    test_fit_note_allocates_it();
+    test_grow_keeps_it();
+    test_reset_stops_it();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}
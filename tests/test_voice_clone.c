@@ -0,0 +1,198 @@
+// Tests voice cloning on patch load (clone_voice_oscs): a synth's first voice
+// plays the patch and the others are copied from it, so every copy has to be
+// what playing the patch into that voice would have made.
+//
+//   - A Juno patch (chained oscs and a mod_source LFO), a DX7 one
+//     (algo_sources) and a grown patch_string synth (the live-voice snapshot):
+//     every voice reads back the same config as the same patch played into a
+//     spare block of oscs, and a note on any voice renders the same samples as
+//     that note on the spare block.
+//   - The copies' references to their own voice's oscs are moved with them.
+//   - A voice that's already sounding once configured (a drone patch) is
+//     copied sounding, and rendered.
+//   - No two oscs share fit state.
+//
+// Build/run with `make ctest`.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "amy.h"
+// Our own copy of the patch table, to parse from.  patches.h defines
+// patch_oscs, which patches.o already has, so rename ours.
+#define patch_oscs test_patch_oscs
+#include "patches.h"
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...) do {                                        \
+    if (cond) { printf("  ok   " fmt "\n", ##__VA_ARGS__); }              \
+    else { printf("  FAIL " fmt "\n", ##__VA_ARGS__); failures++; }       \
+} while (0)
+
+extern uint16_t *voice_to_base_osc;
+extern uint32_t *audible_oscs;
+extern int instrument_get_num_voices(int instrument_number, uint16_t *amy_voices);
+extern void set_event_for_osc(int base_osc, int rel_osc, struct amy_event *event);
+
+#define SYNTH 1
+#define VOICES 4
+// Where the patch is played by hand, clear of the synth's voices.
+#define SPARE_BASE 60
+#define BLOCKS 100
+
+static void restart(void) {
+    amy_stop();
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+}
+
+static int voice_bases(uint16_t *bases) {
+    uint16_t voices[MAX_VOICES_PER_INSTRUMENT];
+    int num_voices = instrument_get_num_voices(SYNTH, voices);
+    for (int v = 0; v < num_voices; ++v)  bases[v] = voice_to_base_osc[voices[v]];
+    return num_voices;
+}
+
+// Sets up the synth with setup (and, if grow, then grows it to VOICES), and
+// plays the patch into the spare block by hand, as patches_load_patch did
+// for every voice before cloning.
+static void load(const char *setup, const char *grow, const char *patch, uint16_t oscs) {
+    restart();
+    amy_add_message((char *)setup);
+    amy_execute_deltas();
+    if (grow) {
+        amy_add_message((char *)grow);
+        amy_execute_deltas();
+    }
+    parse_patch_string_to_queue((char *)patch, SPARE_BASE, oscs, &amy_global.delta_queue, SYNTH, 0, false);
+    amy_execute_deltas();
+}
+
+static bool same_config(uint16_t base, uint16_t oscs) {
+    for (uint16_t i = 0; i < oscs; ++i) {
+        amy_event a, b;
+        // memcmp'd, so no stray padding.
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        amy_clear_event(&a);
+        amy_clear_event(&b);
+        set_event_for_osc(base, i, &a);
+        set_event_for_osc(SPARE_BASE, i, &b);
+        if (memcmp(&a, &b, sizeof(a)) != 0)  return false;
+    }
+    return true;
+}
+
+static int16_t rendered[2][BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS];
+
+static void render_note(uint16_t osc, int16_t *out) {
+    amy_event e = amy_default_event();
+    e.osc = osc;
+    e.midi_note = 57;
+    e.velocity = 1;
+    amy_add_event(&e);
+    for (int b = 0; b < BLOCKS; ++b)
+        memcpy(out + b * AMY_BLOCK_SIZE * AMY_NCHANS, amy_simple_fill_buffer(),
+               AMY_BLOCK_SIZE * AMY_NCHANS * sizeof(int16_t));
+}
+
+static bool loud(const int16_t *out) {
+    for (int i = 0; i < BLOCKS * AMY_BLOCK_SIZE * AMY_NCHANS; ++i)
+        if (out[i] != 0)  return true;
+    return false;
+}
+
+static void test_patch(const char *what, const char *setup, const char *grow, const char *patch, uint16_t oscs) {
+    printf("%s: every voice is the patch played into it\n", what);
+    uint16_t bases[MAX_VOICES_PER_INSTRUMENT];
+    load(setup, grow, patch, oscs);
+    int num_voices = voice_bases(bases);
+    int same = 0;
+    for (int v = 0; v < num_voices; ++v)  same += same_config(bases[v], oscs);
+    CHECK(num_voices == VOICES && same == num_voices, "%d of %d voices read back the same", same, num_voices);
+    int same_audio = 0, sounded = 0;
+    for (int v = 0; v < num_voices; ++v) {
+        load(setup, grow, patch, oscs);
+        render_note(SPARE_BASE, rendered[0]);
+        load(setup, grow, patch, oscs);
+        render_note(bases[v], rendered[1]);
+        sounded += loud(rendered[0]);
+        same_audio += (memcmp(rendered[0], rendered[1], sizeof(rendered[0])) == 0);
+    }
+    CHECK(sounded == num_voices && same_audio == num_voices, "%d of %d voices render the same note", same_audio, num_voices);
+}
+
+static void test_references(void) {
+    printf("the copies' references point into their own voice\n");
+    restart();
+    amy_add_message("i1iv4K0Z");   // Juno: osc 0 chains osc 2, modulated by osc 1
+    amy_add_message("i2iv4K128Z"); // DX7: osc 0's algo_sources are oscs 2..7
+    amy_execute_deltas();
+    uint16_t voices[MAX_VOICES_PER_INSTRUMENT];
+    int ok = 0, n = 0;
+    for (int s = 1; s <= 2; ++s) {
+        int num_voices = instrument_get_num_voices(s, voices);
+        for (int v = 0; v < num_voices; ++v, ++n) {
+            uint16_t base = voice_to_base_osc[voices[v]];
+            struct synthinfo *head = synth[base];
+            if (s == 1)
+                ok += (head->chained_osc == base + 2 && head->mod_source[0] == base + 1 && head->osc == base);
+            else
+                ok += (head->algo_source[0] == base + 2 && head->algo_source[5] == base + 7 && head->osc == base);
+        }
+    }
+    CHECK(n == 8 && ok == n, "%d of %d voices", ok, n);
+    int shared = 0;
+    for (uint16_t i = 0; i < AMY_OSCS; ++i)
+        for (uint16_t j = i + 1; j < AMY_OSCS; ++j)
+            if (synth[i] && synth[j] && synth[i]->stretch && synth[i]->stretch == synth[j]->stretch)  ++shared;
+    CHECK(shared == 0, "no fit state is shared (%d)", shared);
+}
+
+static int16_t drone_peak(const char *message) {
+    restart();
+    amy_add_message((char *)message);
+    amy_execute_deltas();
+    int16_t peak = 0;
+    for (int b = 0; b < 4; ++b) {
+        int16_t *out = amy_simple_fill_buffer();
+        for (int i = 0; i < AMY_BLOCK_SIZE * AMY_NCHANS; ++i)  if (out[i] > peak)  peak = out[i];
+    }
+    return peak;
+}
+
+static void test_sounding_voice(void) {
+    printf("a voice sounding once configured is copied sounding\n");
+    int16_t one = drone_peak("i1iv1uv0w0f220a0.1l1Z");
+    int16_t four = drone_peak("i1iv4uv0w0f220a0.1l1Z");
+    uint16_t bases[MAX_VOICES_PER_INSTRUMENT];
+    int num_voices = voice_bases(bases);
+    int audible = 0;
+    for (int v = 0; v < num_voices; ++v)
+        audible += (synth[bases[v]]->status == SYNTH_AUDIBLE
+                    && (audible_oscs[bases[v] >> 5] & (1u << (bases[v] & 31))));
+    CHECK(num_voices == VOICES && audible == num_voices, "%d of %d voices audible and marked so", audible, num_voices);
+    // Four drones in phase are four times one.
+    CHECK(one > 0 && four > 4 * one - 8 && four < 4 * one + 8, "and all of them are rendered (peak %d, one voice %d)", four, one);
+}
+
+// AMY calls these; the test binary has to provide them.
+void delay_ms(uint32_t ms) { (void)ms; }
+
+int main(void) {
+    amy_config_t c = amy_default_config();
+    c.features.startup_bleep = 0;
+    amy_start(c);
+    test_patch("Juno", "i1iv4K0Z", NULL, patch_commands[0], patch_oscs[0]);
+    test_patch("DX7", "i1iv4K128Z", NULL, patch_commands[128], patch_oscs[128]);
+    test_patch("grown patch_string", "i1iv1uv0w1c1L2Zv1w0f0.5a1,0,0,0Zv2w3Zv0a1,0,0,1Z", "i1iv4Z",
+               "v0w1c1L2Zv1w0f0.5a1,0,0,0Zv2w3Zv0a1,0,0,1Z", 3);
+    test_references();
+    test_sounding_voice();
+    amy_stop();
+    if (failures) { printf("%d FAILURES\n", failures); return 1; }
+    printf("all ok\n");
+    return 0;
+}